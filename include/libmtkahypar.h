@@ -143,6 +143,35 @@ MT_KAHYPAR_API mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(mt_kahypar_p
                                                                     const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
                                                                     const mt_kahypar_hypernode_weight_t* vertex_weights);
 
+/**
+ * Constructs a hypergraph from a given adjacency array (same format as in 'mt_kahypar_create_hypergraph').
+ * In contrast to 'mt_kahypar_create_hypergraph', the pins are written directly into the internal incidence
+ * array of the hypergraph without transforming the adjacency array into one vector per hyperedge.
+ *
+ * If borrow_hyperedges is true and the library is compiled with 64-bit vertex IDs, the hypergraph
+ * references the hyperedges array instead of copying it. In that case, the array must not be modified
+ * or deleted before the hypergraph is freed. Otherwise, the pins are copied once in parallel.
+ *
+ * \note num_pins is the length of the hyperedges array. The construction fails (the returned hypergraph
+ *       has type NULLPTR_HYPERGRAPH), if hyperedge_indices does not start with zero, is decreasing or does
+ *       not end with num_pins, or if a pin is not smaller than num_vertices.
+ * \note For unweighted hypergraphs, you can pass nullptr to either hyperedge_weights or vertex_weights.
+ * \note hyperedge_indices can be deleted after construction.
+ * \note The HIGHEST_QUALITY preset uses a dynamic hypergraph, which can not be constructed from an
+ *       adjacency array. It falls back to the construction of 'mt_kahypar_create_hypergraph'.
+ * \note If stats is not nullptr, the construction time and whether the hyperedges array is borrowed are stored in it.
+ */
+MT_KAHYPAR_API mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph_from_csr(const mt_kahypar_preset_type_t preset,
+                                                                             const mt_kahypar_hypernode_id_t num_vertices,
+                                                                             const mt_kahypar_hyperedge_id_t num_hyperedges,
+                                                                             const size_t* hyperedge_indices,
+                                                                             const mt_kahypar_hypernode_id_t* hyperedges,
+                                                                             const size_t num_pins,
+                                                                             const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
+                                                                             const mt_kahypar_hypernode_weight_t* vertex_weights,
+                                                                             const bool borrow_hyperedges,
+                                                                             mt_kahypar_construction_stats_t* stats);
+
 /**
  * Constructs a graph from a given edge list vector.
  *
@@ -254,6 +283,23 @@ MT_KAHYPAR_API bool mt_kahypar_check_compatibility(mt_kahypar_hypergraph_t hyper
 MT_KAHYPAR_API mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition(mt_kahypar_hypergraph_t hypergraph,
                                                                         mt_kahypar_context_t* context);
 
+/**
+ * Partitions a (hyper)graph once for each number of blocks in ks with the configuration specified in
+ * the partitioning context. In multilevel mode, community detection and coarsening are only performed once
+ * and the resulting multilevel hierarchy is reused for initial partitioning and refinement of each k.
+ * The partition for ks[i] is stored in partitioned_hgs[i], which must provide space for num_ks entries.
+ * All partitions refer to the same input hypergraph.
+ *
+ * \note The number of blocks specified in the partitioning context is ignored. Fixed vertices and
+ *       individual target block weights are not supported. If partitioning fails, all entries of
+ *       partitioned_hgs are set to a null partitioned hypergraph.
+ */
+MT_KAHYPAR_API void mt_kahypar_partition_for_multiple_k(mt_kahypar_hypergraph_t hypergraph,
+                                                        mt_kahypar_context_t* context,
+                                                        const mt_kahypar_partition_id_t* ks,
+                                                        const size_t num_ks,
+                                                        mt_kahypar_partitioned_hypergraph_t* partitioned_hgs);
+
 /**
  * Maps a (hyper)graph onto a target graph with the configuration specified in the partitioning context.
  * The number of blocks of the output mapping/partition is the same as the number of nodes in the target graph
@@ -363,6 +409,34 @@ MT_KAHYPAR_API mt_kahypar_hyperedge_weight_t mt_kahypar_soed(const mt_kahypar_pa
 MT_KAHYPAR_API mt_kahypar_hyperedge_weight_t mt_kahypar_steiner_tree(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                                                      mt_kahypar_target_graph_t* target_graph);
 
+/**
+ * Returns a JSON performance report of the partitioned (hyper)graph. The report contains the metrics,
+ * hierarchical timings, all stats, per-level statistics of coarsening and refinement, the objective delta
+ * of each phase, the memory consumption and the context. Timings and stats are accumulated over all
+ * partitioning calls with the given context.
+ *
+ * \note The returned string must be freed with mt_kahypar_free_performance_report(...).
+ */
+MT_KAHYPAR_API char* mt_kahypar_performance_report(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                                   const mt_kahypar_context_t* context);
+
+/**
+ * Deletes a performance report returned by mt_kahypar_performance_report(...).
+ */
+MT_KAHYPAR_API void mt_kahypar_free_performance_report(char* report);
+
+/**
+ * Returns the peak resident set size and the peak number of bytes of all tracked allocations of a
+ * phase (e.g., "coarsening", "initial_partitioning" or "refinement"). If phase is NULL or empty, the
+ * peak memory of the process is returned. Requires that the context parameter MEASURE_PEAK_MEMORY
+ * was set before partitioning.
+ *
+ * \return 0 on success and 1 if no peak memory was measured for the phase.
+ */
+MT_KAHYPAR_API int mt_kahypar_peak_memory(const mt_kahypar_context_t* context,
+                                          const char* phase,
+                                          size_t* peak_rss_bytes,
+                                          size_t* peak_tracked_bytes);
 
 /**
  * Deletes the partitioned (hyper)graph object.
@@ -1,6 +1,9 @@
 #ifndef TYPEDEFS_H
 #define TYPEDEFS_H
 
+#include <stdbool.h>
+#include <stddef.h>
+
 typedef enum {
   STATIC_GRAPH,
   DYNAMIC_GRAPH,
@@ -51,6 +54,17 @@ typedef int mt_kahypar_hypernode_weight_t;
 typedef int mt_kahypar_hyperedge_weight_t;
 typedef int mt_kahypar_partition_id_t;
 
+/**
+ * Statistics of the hypergraph construction from an adjacency array
+ * (see 'mt_kahypar_create_hypergraph_from_csr').
+ */
+typedef struct {
+  // time spent to construct the hypergraph (in seconds)
+  double construction_time;
+  // true, if the hypergraph references the hyperedges array instead of copying it
+  bool borrowed_hyperedges;
+} mt_kahypar_construction_stats_t;
+
 /**
  * Configurable parameters of the partitioning context.
  */
@@ -64,7 +78,13 @@ typedef enum {
   // number of V-cycles
   NUM_VCYCLES,
   // disables or enables logging
-  VERBOSE
+  VERBOSE,
+  // time limit in seconds (0 = no time limit)
+  TIME_LIMIT,
+  // measures the peak memory of each phase (see mt_kahypar_peak_memory(...))
+  MEASURE_PEAK_MEMORY,
+  // memory budget in MB (0 = no memory budget)
+  MAX_MEMORY
 } mt_kahypar_context_parameter_type_t;
 
 /**
@@ -101,7 +121,9 @@ typedef enum {
   // Standard file format for graphs
   METIS,
   // Standard file format for hypergraphs
-  HMETIS
+  HMETIS,
+  // Memory-mappable binary format (see tools/ConvertToBinary)
+  BINARY
 } mt_kahypar_file_format_type_t;
 
 #ifndef MT_KAHYPAR_API
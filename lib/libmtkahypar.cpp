@@ -29,7 +29,11 @@
 #include "include/libmtkahypartypes.h"
 #include "include/helper_functions.h"
 
+#include <cstdlib>
+#include <cstring>
+
 #include "tbb/parallel_for.h"
+#include "tbb/parallel_reduce.h"
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/context.h"
@@ -44,6 +48,8 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/delete.h"
+#include "mt-kahypar/utils/memory_sampler.h"
+#include "mt-kahypar/utils/utilities.h"
 
 #ifndef MT_KAHYPAR_DISABLE_BOOST
 #include "mt-kahypar/io/command_line_options.h"
@@ -63,6 +69,18 @@ namespace {
   using StaticPartitionedGraph = typename StaticGraphTypeTraits::PartitionedHypergraph;
   using DynamicPartitionedGraph = typename DynamicGraphTypeTraits::PartitionedHypergraph;
 
+  // ! Returns true, if f(i) is true for all i in [0, n) (evaluated in parallel)
+  template<typename F>
+  bool allOf(const size_t n, const F& f) {
+    return tbb::parallel_reduce(tbb::blocked_range<size_t>(UL(0), n), true,
+      [&](const tbb::blocked_range<size_t>& range, bool valid) {
+        for ( size_t i = range.begin(); valid && i < range.end(); ++i ) {
+          valid = f(i);
+        }
+        return valid;
+      }, std::logical_and<>());
+  }
+
   PresetType to_preset_type(mt_kahypar_preset_type_t preset) {
     switch ( preset ) {
       case DETERMINISTIC: return PresetType::deterministic;
@@ -155,6 +173,20 @@ int mt_kahypar_set_context_parameter(mt_kahypar_context_t* context,
     case VERBOSE:
       c.partition.verbose_output = atoi(value);
       return 0;
+    case TIME_LIMIT:
+      c.partition.time_limit = atoi(value);
+      if ( c.partition.time_limit >= 0 ) return 0; /** success **/
+      else return 2; /** integer conversion error **/
+    case MEASURE_PEAK_MEMORY:
+      c.partition.measure_peak_memory = atoi(value);
+      return 0;
+    case MAX_MEMORY:
+      {
+        const long long max_memory = atoll(value);
+        if ( max_memory < 0 ) return 2; /** integer conversion error **/
+        c.partition.max_memory = max_memory;
+        return 0;
+      }
   }
   return 1; /** no valid parameter type **/
 }
@@ -218,10 +250,11 @@ mt_kahypar_hypergraph_t mt_kahypar_read_hypergraph_from_file(const char* file_na
                                                              const mt_kahypar_preset_type_t preset,
                                                              const mt_kahypar_file_format_type_t file_format) {
   const PresetType config = to_preset_type(preset);
-  const InstanceType instance = file_format == HMETIS ? InstanceType::hypergraph : InstanceType::graph;
-  const FileFormat format = file_format == HMETIS ? FileFormat::hMetis : FileFormat::Metis;
+  const FileFormat format = file_format == HMETIS ? FileFormat::hMetis :
+    file_format == BINARY ? FileFormat::Binary : FileFormat::Metis;
   const bool stable_construction = preset == DETERMINISTIC ? true : false;
   try {
+    const InstanceType instance = io::instanceTypeOfInputFile(file_name, format);
     return io::readInputFile(file_name, config, instance, format, stable_construction);
   } catch ( std::exception& ex ) {
     LOG << ex.what();
@@ -280,6 +313,71 @@ mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph(const mt_kahypar_preset_typ
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
 
+mt_kahypar_hypergraph_t mt_kahypar_create_hypergraph_from_csr(const mt_kahypar_preset_type_t preset,
+                                                              const mt_kahypar_hypernode_id_t num_vertices,
+                                                              const mt_kahypar_hyperedge_id_t num_hyperedges,
+                                                              const size_t* hyperedge_indices,
+                                                              const mt_kahypar_hypernode_id_t* hyperedges,
+                                                              const size_t num_pins,
+                                                              const mt_kahypar_hyperedge_weight_t* hyperedge_weights,
+                                                              const mt_kahypar_hypernode_weight_t* vertex_weights,
+                                                              const bool borrow_hyperedges,
+                                                              mt_kahypar_construction_stats_t* stats) {
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  try {
+    // The adjacency array is validated before its indices are used to access the hyperedges array
+    if ( hyperedge_indices[0] != 0 ) {
+      throw InvalidInputException("Hyperedge indices must start with zero.");
+    }
+    if ( hyperedge_indices[num_hyperedges] != num_pins ) {
+      throw InvalidInputException("Hyperedge indices end at " + STR(hyperedge_indices[num_hyperedges]) +
+        ", but the hyperedges array contains " + STR(num_pins) + " pins.");
+    }
+    if ( !allOf(num_hyperedges, [&](const size_t he) {
+            return hyperedge_indices[he] <= hyperedge_indices[he + 1]; }) ) {
+      throw InvalidInputException("Hyperedge indices must be non-decreasing.");
+    }
+    if ( !allOf(num_pins, [&](const size_t i) { return hyperedges[i] < num_vertices; }) ) {
+      throw InvalidInputException("Hyperedges array contains a pin that is not smaller than the number of vertices.");
+    }
+
+    if ( preset == HIGHEST_QUALITY ) {
+      return mt_kahypar_create_hypergraph(preset, num_vertices, num_hyperedges,
+        hyperedge_indices, hyperedges, hyperedge_weights, vertex_weights);
+    }
+
+    // We can only reference the hyperedges array if its IDs have the same type as our IDs
+    constexpr bool can_borrow = std::is_same<HypernodeID, mt_kahypar_hypernode_id_t>::value;
+    const bool borrow = can_borrow && borrow_hyperedges;
+    ds::Array<HypernodeID> incidence_array;
+    if ( borrow ) {
+      incidence_array.adopt(const_cast<HypernodeID*>(
+        reinterpret_cast<const HypernodeID*>(hyperedges)), num_pins, nullptr);
+    } else {
+      incidence_array.resizeNoAssign(num_pins);
+      tbb::parallel_for(UL(0), num_pins, [&](const size_t i) {
+        incidence_array[i] = hyperedges[i];
+      });
+    }
+
+    mt_kahypar_hypergraph_t hypergraph {
+      reinterpret_cast<mt_kahypar_hypergraph_s*>(new ds::StaticHypergraph(
+        StaticHypergraphFactory::constructFromCSR(num_vertices, num_hyperedges,
+          hyperedge_indices, std::move(incidence_array), hyperedge_weights, vertex_weights))),
+      STATIC_HYPERGRAPH };
+
+    if ( stats ) {
+      HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+      stats->construction_time = std::chrono::duration<double>(end - start).count();
+      stats->borrowed_hyperedges = borrow;
+    }
+    return hypergraph;
+  } catch ( std::exception& ex ) {
+    LOG << ex.what();
+  }
+  return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+}
+
 mt_kahypar_hypergraph_t mt_kahypar_create_graph(const mt_kahypar_preset_type_t preset,
                                                 const mt_kahypar_hypernode_id_t num_vertices,
                                                 const mt_kahypar_hyperedge_id_t num_edges,
@@ -455,6 +553,42 @@ mt_kahypar_partitioned_hypergraph_t mt_kahypar_partition(mt_kahypar_hypergraph_t
   return mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
 }
 
+void mt_kahypar_partition_for_multiple_k(mt_kahypar_hypergraph_t hypergraph,
+                                         mt_kahypar_context_t* context,
+                                         const mt_kahypar_partition_id_t* ks,
+                                         const size_t num_ks,
+                                         mt_kahypar_partitioned_hypergraph_t* partitioned_hgs) {
+  for ( size_t i = 0; i < num_ks; ++i ) {
+    partitioned_hgs[i] = mt_kahypar_partitioned_hypergraph_t { nullptr, NULLPTR_PARTITION };
+  }
+  if ( num_ks == 0 ) {
+    return;
+  }
+
+  // The context of the caller is not modified
+  Context c(*reinterpret_cast<const Context*>(context));
+  c.partition.k = *std::max_element(ks, ks + num_ks);
+  if ( lib::check_if_all_relavant_parameters_are_set(c) ) {
+    if ( mt_kahypar_check_compatibility(hypergraph, lib::get_preset_c_type(c.partition.preset_type)) ) {
+      c.partition.instance_type = lib::get_instance_type(hypergraph);
+      c.partition.partition_type = to_partition_c_type(
+        c.partition.preset_type, c.partition.instance_type);
+      lib::prepare_context(c);
+      c.partition.num_vcycles = 0;
+      try {
+        const vec<PartitionID> k_values(ks, ks + num_ks);
+        vec<mt_kahypar_partitioned_hypergraph_t> result =
+          PartitionerFacade::partitionForMultipleK(hypergraph, c, k_values);
+        std::copy(result.begin(), result.end(), partitioned_hgs);
+      } catch ( std::exception& ex ) {
+        LOG << ex.what();
+      }
+    } else {
+      WARNING(lib::incompatibility_description(hypergraph));
+    }
+  }
+}
+
 mt_kahypar_partitioned_hypergraph_t mt_kahypar_map(mt_kahypar_hypergraph_t hypergraph,
                                                    mt_kahypar_target_graph_t* target_graph,
                                                    mt_kahypar_context_t* context) {
@@ -744,4 +878,43 @@ mt_kahypar_hyperedge_weight_t mt_kahypar_steiner_tree(const mt_kahypar_partition
     case NULLPTR_PARTITION: return 0;
   }
   return 0;
-}
\ No newline at end of file
+}
+
+char* mt_kahypar_performance_report(const mt_kahypar_partitioned_hypergraph_t partitioned_hg,
+                                    const mt_kahypar_context_t* context) {
+  if ( partitioned_hg.type == NULLPTR_PARTITION ) {
+    return nullptr;
+  }
+  const Context& c = *reinterpret_cast<const Context*>(context);
+  const std::chrono::duration<double> elapsed_seconds(
+    utils::Utilities::instance().getTimer(c.utility_id).totalTime());
+  const std::string report = PartitionerFacade::serializeJSON(partitioned_hg, c, elapsed_seconds);
+  char* result = static_cast<char*>(std::malloc(report.size() + 1));
+  if ( result ) {
+    std::memcpy(result, report.c_str(), report.size() + 1);
+  }
+  return result;
+}
+
+void mt_kahypar_free_performance_report(char* report) {
+  std::free(report);
+}
+
+int mt_kahypar_peak_memory(const mt_kahypar_context_t* context,
+                           const char* phase,
+                           size_t* peak_rss_bytes,
+                           size_t* peak_tracked_bytes) {
+  const Context& c = *reinterpret_cast<const Context*>(context);
+  utils::PeakMemory peak_memory;
+  if ( phase == nullptr || std::string(phase).empty() ) {
+    if ( !c.partition.measure_peak_memory ) {
+      return 1;
+    }
+    peak_memory = utils::MemorySampler::instance().processPeak();
+  } else if ( !utils::Utilities::instance().getTimer(c.utility_id).peakMemory(phase, peak_memory) ) {
+    return 1;
+  }
+  *peak_rss_bytes = peak_memory.rss;
+  *peak_tracked_bytes = peak_memory.tracked;
+  return 0;
+}
@@ -195,7 +195,8 @@ class Array {
     _key(std::move(other._key)),
     _size(other._size),
     _data(std::move(other._data)),
-    _underlying_data(std::move(other._underlying_data)) {
+    _underlying_data(std::move(other._underlying_data)),
+    _external_memory(std::move(other._external_memory)) {
     other._size = 0;
     other._data = nullptr;
     other._underlying_data = nullptr;
@@ -207,6 +208,7 @@ class Array {
     _size = other._size;
     _data = std::move(other._data);
     _underlying_data = std::move(other._underlying_data);
+    _external_memory = std::move(other._external_memory);
     other._size = 0;
     other._data = nullptr;
     other._underlying_data = nullptr;
@@ -299,6 +301,21 @@ class Array {
     assign(size, init_value, assign_parallel);
   }
 
+  // ! Adopts memory that is owned by someone else (e.g., a memory-mapped file).
+  // ! The array does not copy the data. The owner handle is kept alive as long
+  // ! as the array references the memory. If no owner is passed, the caller has
+  // ! to guarantee that the memory outlives the array.
+  void adopt(value_type* data,
+             const size_type size,
+             std::shared_ptr<void> owner) {
+    if ( _data || _underlying_data ) {
+      throw SystemException("Memory of vector already allocated");
+    }
+    _size = size;
+    _underlying_data = data;
+    _external_memory = std::move(owner);
+  }
+
   void resizeNoAssign(const size_type size) {
     if ( _data || _underlying_data ) {
       throw SystemException("Memory of vector already allocated");
@@ -376,6 +393,7 @@ class Array {
   size_type _size;
   parallel::tbb_unique_ptr<value_type> _data;
   value_type* _underlying_data;
+  std::shared_ptr<void> _external_memory;
 };
 
 
@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <initializer_list>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar::ds {
+namespace binary {
+
+/**
+ * Layout of the binary (hyper)graph format. A binary file consists of a
+ * fixed-size header followed by up to MAX_SECTIONS sections. Each section
+ * stores one of the internal arrays of a StaticHypergraph resp. StaticGraph
+ * exactly as it is layed out in memory. Thus, a file can be memory-mapped and
+ * the arrays can be adopted directly by the data structure without parsing
+ * or copying anything. Each section starts at an offset that is a multiple
+ * of SECTION_ALIGNMENT.
+ *
+ * Since the sections contain the raw in-memory representation, a binary file
+ * can only be read by a build with the same ID widths and data structure layout.
+ * This is verified on load via the fields of the header.
+ */
+static constexpr uint64_t MAGIC_NUMBER = 0x42505948414B544DULL; // "MTKAHYPB"
+static constexpr uint32_t VERSION = 1;
+static constexpr uint64_t SECTION_ALIGNMENT = 64;
+static constexpr size_t MAX_SECTIONS = 4;
+
+enum class Kind : uint32_t {
+  hypergraph = 0,
+  graph = 1
+};
+
+struct Section {
+  // ! Byte offset of the section from the start of the file
+  uint64_t offset;
+  // ! Number of elements stored in the section
+  uint64_t num_elements;
+};
+
+struct Header {
+  uint64_t magic_number;
+  uint32_t version;
+  Kind kind;
+  // ! Used to verify that the reader has the same in-memory layout as the writer
+  uint32_t hypernode_id_size;
+  uint32_t hyperedge_id_size;
+  uint32_t node_struct_size;
+  uint32_t edge_struct_size;
+  uint64_t num_nodes;
+  uint64_t num_edges;
+  uint64_t num_pins;
+  uint64_t total_degree;
+  uint64_t max_edge_size;
+  uint64_t num_removed_hyperedges;
+  int64_t total_weight;
+  Section sections[MAX_SECTIONS];
+};
+
+static_assert(std::is_trivially_copyable<Header>::value, "Binary header is not trivially copyable");
+
+// ! Describes a memory-mapped binary file. The owner handle unmaps the
+// ! file once the last data structure that adopted one of its sections is destroyed.
+struct MappedFile {
+  const Header* header = nullptr;
+  char* data = nullptr;
+  size_t length = 0;
+  std::shared_ptr<void> owner;
+
+  template<typename T>
+  T* section(const size_t i) const {
+    return reinterpret_cast<T*>(data + header->sections[i].offset);
+  }
+};
+
+struct SectionData {
+  const void* data;
+  uint64_t num_elements;
+  uint64_t element_size;
+};
+
+// ! Rounds a byte offset up to the next section boundary
+inline uint64_t alignSection(const uint64_t offset) {
+  return ( offset + SECTION_ALIGNMENT - 1 ) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+}
+
+// ! Computes the section offsets, and writes the header followed by all sections
+inline void write(std::ostream& out,
+                  Header header,
+                  std::initializer_list<SectionData> sections) {
+  ASSERT(sections.size() <= MAX_SECTIONS);
+  header.magic_number = MAGIC_NUMBER;
+  header.version = VERSION;
+  header.hypernode_id_size = sizeof(HypernodeID);
+  header.hyperedge_id_size = sizeof(HyperedgeID);
+  uint64_t offset = alignSection(sizeof(Header));
+  size_t i = 0;
+  for ( const SectionData& section : sections ) {
+    header.sections[i].offset = offset;
+    header.sections[i].num_elements = section.num_elements;
+    offset = alignSection(offset + section.num_elements * section.element_size);
+    ++i;
+  }
+  for ( ; i < MAX_SECTIONS; ++i ) {
+    header.sections[i] = Section { 0, 0 };
+  }
+
+  const char padding[SECTION_ALIGNMENT] = { };
+  uint64_t pos = 0;
+  auto write_bytes = [&](const void* data, const uint64_t num_bytes) {
+    out.write(reinterpret_cast<const char*>(data), num_bytes);
+    pos += num_bytes;
+  };
+  auto write_padding = [&] {
+    write_bytes(padding, alignSection(pos) - pos);
+  };
+
+  write_bytes(&header, sizeof(Header));
+  i = 0;
+  for ( const SectionData& section : sections ) {
+    write_padding();
+    ASSERT(pos == header.sections[i].offset);
+    write_bytes(section.data, section.num_elements * section.element_size);
+    ++i;
+  }
+  write_padding();
+  if ( !out ) {
+    throw SystemException("Failed to write binary hypergraph file");
+  }
+}
+
+// ! Verifies that the memory-mapped file can be adopted by a data structure
+// ! of the given kind with the given node and edge layout. The element sizes
+// ! of the expected sections are used to check that each section lies within the file.
+// ! All offsets and counts are read from the file, the checks are therefore
+// ! formulated such that they cannot overflow.
+inline void verify(const MappedFile& file,
+                   const Kind kind,
+                   const size_t node_struct_size,
+                   const size_t edge_struct_size,
+                   std::initializer_list<size_t> element_sizes) {
+  ASSERT(element_sizes.size() <= MAX_SECTIONS);
+  if ( file.length < sizeof(Header) ) {
+    throw InvalidInputException("Binary file is corrupted (truncated header)");
+  }
+  const Header& header = *file.header;
+  if ( header.magic_number != MAGIC_NUMBER || header.version != VERSION ) {
+    throw InvalidInputException("File is not a binary hypergraph file or has an unsupported version");
+  }
+  if ( header.kind != kind ) {
+    throw InvalidInputException(std::string("Binary file does not contain a ") +
+      (kind == Kind::hypergraph ? "hypergraph" : "graph"));
+  }
+  if ( header.hypernode_id_size != sizeof(HypernodeID) ||
+       header.hyperedge_id_size != sizeof(HyperedgeID) ||
+       header.node_struct_size != node_struct_size ||
+       header.edge_struct_size != edge_struct_size ) {
+    throw InvalidInputException(
+      "Binary file was written by a build with a different ID width or data structure layout");
+  }
+  size_t i = 0;
+  for ( const size_t element_size : element_sizes ) {
+    ASSERT(element_size > 0);
+    const Section& section = header.sections[i++];
+    if ( section.offset % SECTION_ALIGNMENT != 0 ||
+         section.offset < sizeof(Header) || section.offset > file.length ||
+         section.num_elements > ( file.length - section.offset ) / element_size ) {
+      throw InvalidInputException("Binary file is corrupted (invalid section offset or size)");
+    }
+  }
+}
+
+// ! Returns true, if f(i) is true for all i in [0, n). The predicate is
+// ! evaluated in parallel and is used to validate the arrays of a file.
+template<typename F>
+bool forAll(const uint64_t n, const F& f) {
+  return tbb::parallel_reduce(tbb::blocked_range<uint64_t>(0, n), true,
+    [&](const tbb::blocked_range<uint64_t>& range, bool valid) {
+      for ( uint64_t i = range.begin(); valid && i < range.end(); ++i ) {
+        valid = f(i);
+      }
+      return valid;
+    }, std::logical_and<>());
+}
+
+// ! Verifies that the entries [firstEntry(), firstInvalidEntry()) of the first n elements
+// ! lie within an array of the given size and that the ranges are in increasing order
+// ! and do not overlap. The elements are hypernodes or hyperedges read from a file.
+template<typename Element>
+bool hasValidRanges(const Element* elements, const uint64_t n, const uint64_t array_size) {
+  return forAll(n, [&](const uint64_t i) {
+    const uint64_t begin = elements[i].firstEntry();
+    const uint64_t end = elements[i].firstInvalidEntry();
+    return begin <= end && end <= array_size &&
+      ( i == 0 || elements[i - 1].firstInvalidEntry() <= begin );
+  });
+}
+
+} // namespace binary
+} // namespace mt_kahypar::ds
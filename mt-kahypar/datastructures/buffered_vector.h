@@ -28,15 +28,16 @@
 #pragma once
 
 #include <vector>
-#include <tbb/scalable_allocator.h>
 #include <tbb/enumerable_thread_specific.h>
 
+#include "mt-kahypar/parallel/stl/tracked_scalable_allocator.h"
+
 namespace mt_kahypar::ds {
 
 template<typename T>
 class BufferedVector {
 public:
-  using vec_t = std::vector<T, tbb::scalable_allocator<T>>;
+  using vec_t = std::vector<T, parallel::tracked_scalable_allocator<T>>;
 
   BufferedVector(size_t max_size) :
     data(max_size, T()),
@@ -0,0 +1,341 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+
+#include "tbb/parallel_for.h"
+#include "tbb/parallel_scan.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+
+namespace mt_kahypar {
+namespace ds {
+
+// ! Decodes the variable-length integer at data and advances data to the next one
+template<typename T>
+MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE T decodeVarint(const uint8_t*& data) {
+  uint32_t byte = *data++;
+  if ( byte < 0x80 ) {
+    return byte;
+  }
+  T value = byte & 0x7F;
+  for ( uint32_t shift = 7; ; shift += 7 ) {
+    byte = *data++;
+    value |= static_cast<T>(byte & 0x7F) << shift;
+    if ( byte < 0x80 ) {
+      break;
+    }
+  }
+  return value;
+}
+
+/*!
+ * Iterator over the entries of an incidence array that is either stored
+ * uncompressed (plain array of IDs) or compressed (see CompressedIncidenceArray).
+ * The compressed entries are decoded on the fly.
+ */
+template<typename T>
+class CompressibleIterator {
+ public:
+  using iterator_category = std::forward_iterator_tag;
+  using value_type = T;
+  using reference = T;
+  using pointer = const T*;
+  using difference_type = std::ptrdiff_t;
+
+  // ! Iterates over an uncompressed array
+  explicit CompressibleIterator(const T* raw) :
+    _raw(raw),
+    _data(nullptr),
+    _current(0),
+    _remaining(0) { }
+
+  // ! Iterates over the first num_entries entries of a compressed list
+  CompressibleIterator(const uint8_t* data, const size_t num_entries) :
+    _raw(nullptr),
+    _data(data),
+    _current(0),
+    _remaining(num_entries) {
+    if ( _remaining > 0 ) {
+      decodeNext();
+    }
+  }
+
+  T operator*() const {
+    return _raw ? *_raw : _current;
+  }
+
+  // ! Current position in the uncompressed array (nullptr, if the entries are compressed)
+  const T* raw() const {
+    return _raw;
+  }
+
+  CompressibleIterator& operator++() {
+    if ( _raw ) {
+      ++_raw;
+    } else if ( --_remaining > 0 ) {
+      decodeNext();
+    }
+    return *this;
+  }
+
+  CompressibleIterator operator++(int) {
+    CompressibleIterator copy = *this;
+    operator++();
+    return copy;
+  }
+
+  bool operator==(const CompressibleIterator& other) const {
+    return _raw == other._raw && _remaining == other._remaining;
+  }
+
+  bool operator!=(const CompressibleIterator& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE void decodeNext() {
+    // Entries are stored as differences to their predecessor
+    _current += decodeVarint<T>(_data);
+  }
+
+  // ! Current position in an uncompressed array (nullptr, if compressed)
+  const T* _raw;
+  // ! Next encoded entry of a compressed list
+  const uint8_t* _data;
+  // ! Current (decoded) entry of a compressed list
+  T _current;
+  // ! Number of entries left in the compressed list (including the current one)
+  size_t _remaining;
+};
+
+/*!
+ * Compressed representation of the lists of an incidence array (e.g., the pins of
+ * each hyperedge). The entries of each list are sorted and the differences between
+ * consecutive entries are encoded as variable-length integers (7 bits per byte,
+ * the highest bit marks that more bytes follow). Since the differences between
+ * sorted IDs are usually small, most entries require one or two bytes instead of
+ * four. The lists can only be iterated sequentially.
+ */
+template<typename T>
+class CompressedIncidenceArray {
+
+ public:
+  using Iterator = CompressibleIterator<T>;
+
+  CompressedIncidenceArray() :
+    _offsets(),
+    _data() { }
+
+  CompressedIncidenceArray(const CompressedIncidenceArray&) = delete;
+  CompressedIncidenceArray & operator= (const CompressedIncidenceArray &) = delete;
+
+  CompressedIncidenceArray(CompressedIncidenceArray&&) = default;
+  CompressedIncidenceArray & operator= (CompressedIncidenceArray &&) = default;
+
+  /*!
+   * Compresses the lists of the given array, which consists of size entries. The i-th
+   * list consists of the entries in range(i) = [begin, end). Note that the entries of
+   * each list are sorted in-place. The compression is skipped if the compressed
+   * representation (including the offsets of the lists) is not smaller than the
+   * array, unless force is set. Returns true, if the array was compressed.
+   */
+  template<typename F>
+  bool compress(T* data, const size_t size, const size_t num_lists, const F& range, const bool force = false) {
+    return compress(data, size, num_lists, range, [&](const size_t i) {
+      return range(i).second;
+    }, force);
+  }
+
+  /*!
+   * Same as above, but each list is additionally divided into the two parts
+   * [begin, split(i)) and [split(i), end), which are sorted and encoded independently
+   * (e.g., the active and removed incident nets of a vertex). Iterating over the first
+   * split(i) - begin entries of the i-th list enumerates exactly the first part.
+   */
+  template<typename F, typename S>
+  bool compress(T* data, const size_t size, const size_t num_lists,
+                const F& range, const S& split, const bool force = false) {
+    ASSERT(_offsets.size() == 0);
+    Array<size_t> list_sizes;
+    list_sizes.resize(num_lists + 1, 0);
+    tbb::parallel_for(UL(0), num_lists, [&](const size_t i) {
+      const auto [begin, end] = range(i);
+      const size_t mid = split(i);
+      ASSERT(begin <= mid && mid <= end);
+      std::sort(data + begin, data + mid);
+      std::sort(data + mid, data + end);
+      list_sizes[i + 1] = encodedSize(data, begin, mid) + encodedSize(data, mid, end);
+    });
+
+    // After computing the prefix sum, list_sizes[i] is the start position of the i-th list
+    parallel::TBBPrefixSum<size_t, Array> prefix_sum(list_sizes);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(UL(0), num_lists + 1), prefix_sum);
+    if ( !force && sizeof(size_t) * list_sizes.size() + prefix_sum.total_sum() >= sizeof(T) * size ) {
+      // The compressed representation does not save memory
+      return false;
+    }
+    _offsets = std::move(list_sizes);
+    if ( prefix_sum.total_sum() > 0 ) {
+      _data.resizeNoAssign(prefix_sum.total_sum());
+    }
+
+    tbb::parallel_for(UL(0), num_lists, [&](const size_t i) {
+      const auto [begin, end] = range(i);
+      const size_t mid = split(i);
+      uint8_t* out = _data.data() + _offsets[i];
+      out = encode(data, begin, mid, out);
+      out = encode(data, mid, end, out);
+      ASSERT(out == _data.data() + _offsets[i + 1]);
+    });
+    return true;
+  }
+
+  /*!
+   * Writes the (sorted) entries of the i-th list to the positions range(i)
+   * of the given array.
+   */
+  template<typename F>
+  void decompress(T* data, const size_t num_lists, const F& range) const {
+    decompress(data, num_lists, range, [&](const size_t i) {
+      return range(i).second;
+    });
+  }
+
+  // ! Decompresses lists that were compressed in two parts (see compress(...))
+  template<typename F, typename S>
+  void decompress(T* data, const size_t num_lists, const F& range, const S& split) const {
+    ASSERT(_offsets.size() == num_lists + 1);
+    tbb::parallel_for(UL(0), num_lists, [&](const size_t i) {
+      const auto [begin, end] = range(i);
+      const size_t mid = split(i);
+      const uint8_t* in = _data.data() + _offsets[i];
+      in = decode(in, data, begin, mid);
+      in = decode(in, data, mid, end);
+      ASSERT(in == _data.data() + _offsets[i + 1]);
+    });
+  }
+
+  // ! Returns an iterator to the first num_entries entries of the i-th list
+  Iterator iterator(const size_t i, const size_t num_entries) const {
+    ASSERT(i + 1 < _offsets.size());
+    ASSERT(num_entries == 0 || _offsets[i] < _data.size());
+    return num_entries > 0 ? Iterator(_data.data() + _offsets[i], num_entries) : end();
+  }
+
+  static Iterator end() {
+    return Iterator(nullptr, 0);
+  }
+
+  size_t numLists() const {
+    return _offsets.size() > 0 ? _offsets.size() - 1 : 0;
+  }
+
+  size_t size_in_bytes() const {
+    return sizeof(size_t) * _offsets.size() + _data.size();
+  }
+
+  CompressedIncidenceArray copy() const {
+    CompressedIncidenceArray compressed;
+    if ( _offsets.size() > 0 ) {
+      compressed._offsets.resizeNoAssign(_offsets.size());
+      std::memcpy(compressed._offsets.data(), _offsets.data(), sizeof(size_t) * _offsets.size());
+    }
+    if ( _data.size() > 0 ) {
+      compressed._data.resizeNoAssign(_data.size());
+      std::memcpy(compressed._data.data(), _data.data(), _data.size());
+    }
+    return compressed;
+  }
+
+  void freeInternalData() {
+    parallel::free(_offsets);
+    parallel::free(_data);
+  }
+
+ private:
+  static size_t encodedSize(T value) {
+    size_t num_bytes = 1;
+    while ( value >= 0x80 ) {
+      value >>= 7;
+      ++num_bytes;
+    }
+    return num_bytes;
+  }
+
+  static uint8_t* encode(T value, uint8_t* out) {
+    while ( value >= 0x80 ) {
+      *out++ = static_cast<uint8_t>(value | 0x80);
+      value >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(value);
+    return out;
+  }
+
+  // ! Number of bytes required to encode the sorted entries in [begin, end)
+  static size_t encodedSize(const T* data, const size_t begin, const size_t end) {
+    T prev = 0;
+    size_t num_bytes = 0;
+    for ( size_t pos = begin; pos < end; ++pos ) {
+      num_bytes += encodedSize(data[pos] - prev);
+      prev = data[pos];
+    }
+    return num_bytes;
+  }
+
+  // ! Encodes the sorted entries in [begin, end) as differences to their predecessor
+  static uint8_t* encode(const T* data, const size_t begin, const size_t end, uint8_t* out) {
+    T prev = 0;
+    for ( size_t pos = begin; pos < end; ++pos ) {
+      out = encode(data[pos] - prev, out);
+      prev = data[pos];
+    }
+    return out;
+  }
+
+  // ! Decodes end - begin entries and writes them to the positions [begin, end)
+  static const uint8_t* decode(const uint8_t* in, T* data, const size_t begin, const size_t end) {
+    T current = 0;
+    for ( size_t pos = begin; pos < end; ++pos ) {
+      current += decodeVarint<T>(in);
+      data[pos] = current;
+    }
+    return in;
+  }
+
+  // ! Start position of each list in _data
+  Array<size_t> _offsets;
+  Array<uint8_t> _data;
+};
+
+}  // namespace ds
+}  // namespace mt_kahypar
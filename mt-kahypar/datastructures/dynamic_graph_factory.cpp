@@ -61,6 +61,29 @@ DynamicGraph DynamicGraphFactory::construct(
     edge_weight, node_weight, stable_construction_of_incident_edges);
 }
 
+DynamicGraph DynamicGraphFactory::constructFromCSR(
+        const HypernodeID num_nodes,
+        const HyperedgeID num_edges,
+        const size_t* edge_offsets,
+        Array<HypernodeID>&& incidence_array,
+        const HyperedgeWeight* edge_weight,
+        const HypernodeWeight* node_weight,
+        const bool stable_construction_of_incident_edges) {
+  ASSERT(edge_offsets[num_edges] == incidence_array.size());
+  const Array<HypernodeID> pins(std::move(incidence_array));
+  EdgeVector edges;
+  edges.resize(num_edges);
+  tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID e) {
+    if ( edge_offsets[e + 1] - edge_offsets[e] != 2 ) {
+      throw InvalidInputException(
+        "Using graph data structure; but the input hypergraph is not a graph.");
+    }
+    edges[e] = std::make_pair(pins[edge_offsets[e]], pins[edge_offsets[e] + 1]);
+  });
+  return construct_from_graph_edges(num_nodes, num_edges, edges,
+    edge_weight, node_weight, stable_construction_of_incident_edges);
+}
+
 DynamicGraph DynamicGraphFactory::construct_from_graph_edges(
         const HypernodeID num_nodes,
         const HyperedgeID num_edges,
@@ -30,6 +30,7 @@
 
 #include <tbb/enumerable_thread_specific.h>
 
+#include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/dynamic_graph.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 
@@ -62,6 +63,16 @@ class DynamicGraphFactory {
                                                 const HypernodeWeight* node_weight = nullptr,
                                                 const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the graph from edges given in CSR format (see StaticGraphFactory).
+  // ! The incidence array is released as soon as the graph is constructed.
+  static DynamicGraph constructFromCSR(const HypernodeID num_nodes,
+                                       const HyperedgeID num_edges,
+                                       const size_t* edge_offsets,
+                                       Array<HypernodeID>&& incidence_array,
+                                       const HyperedgeWeight* edge_weight = nullptr,
+                                       const HypernodeWeight* node_weight = nullptr,
+                                       const bool stable_construction_of_incident_edges = false);
+
   static std::pair<DynamicGraph, parallel::scalable_vector<HypernodeID> > compactify(const DynamicGraph&);
 
  private:
@@ -141,6 +141,25 @@ DynamicHypergraph DynamicHypergraphFactory::construct(
   return hypergraph;
 }
 
+DynamicHypergraph DynamicHypergraphFactory::constructFromCSR(
+        const HypernodeID num_hypernodes,
+        const HyperedgeID num_hyperedges,
+        const size_t* hyperedge_offsets,
+        Array<HypernodeID>&& incidence_array,
+        const HyperedgeWeight* hyperedge_weight,
+        const HypernodeWeight* hypernode_weight,
+        const bool stable_construction_of_incident_edges) {
+  ASSERT(hyperedge_offsets[num_hyperedges] == incidence_array.size());
+  const Array<HypernodeID> pins(std::move(incidence_array));
+  HyperedgeVector edge_vector(num_hyperedges);
+  tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+    edge_vector[he].assign(pins.cbegin() + hyperedge_offsets[he],
+      pins.cbegin() + hyperedge_offsets[he + 1]);
+  });
+  return construct(num_hypernodes, num_hyperedges, edge_vector,
+    hyperedge_weight, hypernode_weight, stable_construction_of_incident_edges);
+}
+
 /**
  * Compactifies a given hypergraph such that it only contains enabled vertices and hyperedges within
  * a consecutive range of IDs.
@@ -30,6 +30,7 @@
 #include <tbb/enumerable_thread_specific.h>
 
 
+#include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/dynamic_hypergraph.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
@@ -55,6 +56,16 @@ class DynamicHypergraphFactory {
                                     const HypernodeWeight* hypernode_weight = nullptr,
                                     const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the hypergraph from hyperedges given in CSR format (see StaticHypergraphFactory).
+  // ! In contrast to the static hypergraph, the pins are copied into the dynamic data structure.
+  static DynamicHypergraph constructFromCSR(const HypernodeID num_hypernodes,
+                                            const HyperedgeID num_hyperedges,
+                                            const size_t* hyperedge_offsets,
+                                            Array<HypernodeID>&& incidence_array,
+                                            const HyperedgeWeight* hyperedge_weight = nullptr,
+                                            const HypernodeWeight* hypernode_weight = nullptr,
+                                            const bool stable_construction_of_incident_edges = false);
+
   /**
    * Compactifies a given hypergraph such that it only contains enabled vertices and hyperedges within
    * a consecutive range of IDs.
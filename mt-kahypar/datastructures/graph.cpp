@@ -113,7 +113,10 @@ namespace mt_kahypar::ds {
     _indices = std::move(other._indices);
     _arcs = std::move(other._arcs);
     _node_volumes = std::move(other._node_volumes);
-    _tmp_graph_buffer = std::move(other._tmp_graph_buffer);
+    if ( _tmp_graph_buffer ) {
+      delete(_tmp_graph_buffer);
+    }
+    _tmp_graph_buffer = other._tmp_graph_buffer;
     other._num_nodes = 0;
     other._num_arcs = 0;
     other._total_volume = 0;
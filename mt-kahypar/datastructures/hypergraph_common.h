@@ -64,10 +64,17 @@ using Gain = HyperedgeWeight;
 // Graph Types
 using NodeID = uint32_t;
 using ArcWeight = double;
+#ifdef KAHYPAR_USE_COMPACT_ARC_WEIGHTS
+// ! Halves the size of an arc. Node volumes and modularity
+// ! computations still use double precision.
+using CompactArcWeight = float;
+#else
+using CompactArcWeight = ArcWeight;
+#endif
 
 struct Arc {
   NodeID head;
-  ArcWeight weight;
+  CompactArcWeight weight;
 
   Arc() :
     head(0),
@@ -75,7 +82,7 @@ struct Arc {
 
   Arc(NodeID head, ArcWeight weight) :
     head(head),
-    weight(weight) { }
+    weight(static_cast<CompactArcWeight>(weight)) { }
 };
 
 // Constant Declarations
@@ -44,6 +44,7 @@
 #include "mt-kahypar/parallel/stl/thread_locals.h"
 #include "mt-kahypar/utils/range.h"
 #include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/exception.h"
 
 namespace mt_kahypar {
 
@@ -493,6 +494,11 @@ private:
     _hg->restoreLargeEdge(he);
   }
 
+  void initializeRestoredLargeEdge(const HyperedgeID&) {
+    throw NonSupportedOperationException(
+      "initializeRestoredLargeEdge() is not supported in partitioned graph");
+  }
+
   template<typename GainCache>
   void restoreSinglePinAndParallelNets(const vec<typename Hypergraph::ParallelHyperedge>& hes_to_restore,
                                        GainCache& gain_cache) {
@@ -450,7 +450,13 @@ class PartitionedHypergraph {
    */
   void restoreLargeEdge(const HyperedgeID& he) {
     _hg->restoreLargeEdge(he);
+    initializeRestoredLargeEdge(he);
+  }
 
+  // ! Computes the pin counts of a large hyperedge that was already restored in the
+  // ! underlying hypergraph (e.g., by another partition of the same hypergraph)
+  void initializeRestoredLargeEdge(const HyperedgeID& he) {
+    ASSERT(_hg->edgeIsEnabled(he));
     // Recalculate pin count in parts
     const size_t incidence_array_start = _hg->hyperedge(he).firstEntry();
     const size_t incidence_array_end = _hg->hyperedge(he).firstInvalidEntry();
@@ -31,6 +31,8 @@
 #include <functional>
 #include <algorithm>
 #include <cassert>
+#include <limits>
+#include <type_traits>
 
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 
@@ -339,5 +341,350 @@ public:
 template<typename KeyT, typename IdT>
 using MaxHeap = Heap<KeyT, IdT, std::less<KeyT>, 2>;
 
+
+/**
+ * Addressable max-priority queue for integer keys in a bounded range [min_key, max_key].
+ * Each key has its own bucket, which is a doubly-linked list of the elements with that key.
+ * Thus, all operations run in constant time, except for finding the next non-empty bucket
+ * after the maximum bucket became empty, which is amortized by the insertions.
+ *
+ * Keys outside of the range are stored in the first or last bucket. The queue still returns
+ * the exact key of each element, but the order within these two buckets is arbitrary.
+ * Elements with the same key are returned in LIFO order.
+ *
+ * The interface and the semantics of the external handles are the same as for Heap.
+ */
+template<typename KeyT, typename IdT>
+class BucketQueue {
+  static_assert(std::is_integral<KeyT>::value, "Bucket queue requires integer keys");
+
+  struct Element {
+    KeyT key;
+    IdT id;
+    PosT prev;
+    PosT next;
+  };
+
+public:
+  explicit BucketQueue(PosT* positions, size_t positions_size) :
+    elements(),
+    buckets(),
+    min_key(0),
+    max_bucket(0),
+    positions(positions),
+    positions_size(positions_size) { }
+
+  // ! Sets the range of keys with their own bucket (only allowed if the queue is empty)
+  void setKeyRange(const KeyT min, const KeyT max) {
+    ASSERT(empty() && min <= max);
+    if ( min == min_key && buckets.size() == static_cast<size_t>(max - min) + 1 ) {
+      return;
+    }
+    min_key = min;
+    max_bucket = 0;
+    buckets.assign(static_cast<size_t>(max - min) + 1, invalid_position);
+  }
+
+  IdT top() const {
+    ASSERT(!empty());
+    return elements[buckets[max_bucket]].id;
+  }
+
+  KeyT topKey() const {
+    ASSERT(!empty());
+    return elements[buckets[max_bucket]].key;
+  }
+
+  void deleteTop() {
+    ASSERT(!empty());
+    removeAtPos(buckets[max_bucket]);
+  }
+
+  void insert(const IdT e, const KeyT k) {
+    ASSERT(!contains(e));
+    ASSERT(size() < positions_size);
+    const PosT pos = size();
+    positions[e] = pos;
+    elements.push_back(Element { k, e, invalid_position, invalid_position });
+    link(pos);
+  }
+
+  void remove(const IdT e) {
+    ASSERT(!empty() && contains(e));
+    removeAtPos(positions[e]);
+  }
+
+  void increaseKey(const IdT e, const KeyT newKey) {
+    ASSERT(contains(e) && keyOf(e) < newKey);
+    adjustKey(e, newKey);
+  }
+
+  void decreaseKey(const IdT e, const KeyT newKey) {
+    ASSERT(contains(e) && newKey < keyOf(e));
+    adjustKey(e, newKey);
+  }
+
+  void adjustKey(const IdT e, const KeyT newKey) {
+    ASSERT(contains(e));
+    const PosT pos = positions[e];
+    if ( bucketOf(elements[pos].key) != bucketOf(newKey) ) {
+      unlink(pos);
+      elements[pos].key = newKey;
+      link(pos);
+      updateMaxBucket();
+    } else {
+      elements[pos].key = newKey;
+    }
+  }
+
+  KeyT getKey(const IdT e) const {
+    ASSERT(contains(e));
+    return elements[positions[e]].key;
+  }
+
+  void insertOrAdjustKey(const IdT e, const KeyT newKey) {
+    if (contains(e)) {
+      adjustKey(e, newKey);
+    } else {
+      insert(e, newKey);
+    }
+  }
+
+  void clear() {
+    for ( const Element& element : elements ) {
+      buckets[bucketOf(element.key)] = invalid_position;
+    }
+    elements.clear();
+    max_bucket = 0;
+  }
+
+  bool contains(const IdT e) const {
+    ASSERT(fits(e));
+    return positions[e] < elements.size() && elements[positions[e]].id == e;
+  }
+
+  PosT size() const {
+    return static_cast<PosT>(elements.size());
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  KeyT keyAtPos(const PosT pos) const {
+    return elements[pos].key;
+  }
+
+  KeyT keyOf(const IdT id) const {
+    return elements[positions[id]].key;
+  }
+
+  IdT at(const PosT pos) const {
+    return elements[pos].id;
+  }
+
+  void setHandle(PosT* pos, size_t pos_size) {
+    clear();
+    positions = pos;
+    positions_size = pos_size;
+  }
+
+  size_t size_in_bytes() const {
+    return elements.capacity() * sizeof(Element) + buckets.capacity() * sizeof(PosT);
+  }
+
+private:
+  bool fits(const IdT id) const {
+    return static_cast<size_t>(id) < positions_size;
+  }
+
+  size_t bucketOf(const KeyT key) const {
+    ASSERT(!buckets.empty(), "Key range of bucket queue is not initialized");
+    if ( key <= min_key ) {
+      return 0;
+    }
+    return std::min(static_cast<size_t>(static_cast<int64_t>(key) - min_key), buckets.size() - 1);
+  }
+
+  // ! Inserts the element at position pos at the front of its bucket
+  void link(const PosT pos) {
+    const size_t bucket = bucketOf(elements[pos].key);
+    elements[pos].prev = invalid_position;
+    elements[pos].next = buckets[bucket];
+    if ( buckets[bucket] != invalid_position ) {
+      elements[buckets[bucket]].prev = pos;
+    }
+    buckets[bucket] = pos;
+    if ( bucket > max_bucket || size() == 1 ) {
+      max_bucket = bucket;
+    }
+  }
+
+  void unlink(const PosT pos) {
+    const Element& element = elements[pos];
+    if ( element.prev != invalid_position ) {
+      elements[element.prev].next = element.next;
+    } else {
+      buckets[bucketOf(element.key)] = element.next;
+    }
+    if ( element.next != invalid_position ) {
+      elements[element.next].prev = element.prev;
+    }
+  }
+
+  void removeAtPos(const PosT pos) {
+    unlink(pos);
+    positions[elements[pos].id] = invalid_position;
+    const PosT last = size() - 1;
+    if ( pos != last ) {
+      // Move last element to the free position and update its neighbors
+      elements[pos] = elements[last];
+      const Element& moved = elements[pos];
+      positions[moved.id] = pos;
+      if ( moved.prev != invalid_position ) {
+        elements[moved.prev].next = pos;
+      } else {
+        buckets[bucketOf(moved.key)] = pos;
+      }
+      if ( moved.next != invalid_position ) {
+        elements[moved.next].prev = pos;
+      }
+    }
+    elements.pop_back();
+    updateMaxBucket();
+  }
+
+  void updateMaxBucket() {
+    if ( empty() ) {
+      max_bucket = 0;
+    } else {
+      while ( buckets[max_bucket] == invalid_position ) {
+        ASSERT(max_bucket > 0);
+        --max_bucket;
+      }
+    }
+  }
+
+  vec<Element> elements;
+  vec<PosT> buckets;
+  KeyT min_key;
+  size_t max_bucket;
+  PosT* positions;
+  size_t positions_size;
+};
+
+
+/**
+ * Max-priority queue that either uses a bucket queue or a binary heap. The bucket queue
+ * is used if the keys are integers in a small known range, otherwise the binary heap is used.
+ * The mode can only be switched if the queue is empty.
+ */
+template<typename KeyT, typename IdT>
+class BucketOrHeapQueue {
+public:
+  explicit BucketOrHeapQueue(PosT* positions, size_t positions_size) :
+    use_buckets(false),
+    heap(positions, positions_size),
+    bucket_queue(positions, positions_size) { }
+
+  // ! Uses a bucket queue for keys in the range [min_key, max_key]
+  void useBucketQueue(const KeyT min_key, const KeyT max_key) {
+    ASSERT(empty());
+    use_buckets = true;
+    bucket_queue.setKeyRange(min_key, max_key);
+  }
+
+  void useHeap() {
+    ASSERT(empty());
+    use_buckets = false;
+  }
+
+  bool usesBucketQueue() const {
+    return use_buckets;
+  }
+
+  IdT top() const {
+    return use_buckets ? bucket_queue.top() : heap.top();
+  }
+
+  KeyT topKey() const {
+    return use_buckets ? bucket_queue.topKey() : heap.topKey();
+  }
+
+  void deleteTop() {
+    if ( use_buckets ) bucket_queue.deleteTop(); else heap.deleteTop();
+  }
+
+  void insert(const IdT e, const KeyT k) {
+    if ( use_buckets ) bucket_queue.insert(e, k); else heap.insert(e, k);
+  }
+
+  void remove(const IdT e) {
+    if ( use_buckets ) bucket_queue.remove(e); else heap.remove(e);
+  }
+
+  void increaseKey(const IdT e, const KeyT newKey) {
+    if ( use_buckets ) bucket_queue.increaseKey(e, newKey); else heap.increaseKey(e, newKey);
+  }
+
+  void decreaseKey(const IdT e, const KeyT newKey) {
+    if ( use_buckets ) bucket_queue.decreaseKey(e, newKey); else heap.decreaseKey(e, newKey);
+  }
+
+  void adjustKey(const IdT e, const KeyT newKey) {
+    if ( use_buckets ) bucket_queue.adjustKey(e, newKey); else heap.adjustKey(e, newKey);
+  }
+
+  KeyT getKey(const IdT e) const {
+    return use_buckets ? bucket_queue.getKey(e) : heap.getKey(e);
+  }
+
+  void insertOrAdjustKey(const IdT e, const KeyT newKey) {
+    if ( use_buckets ) bucket_queue.insertOrAdjustKey(e, newKey); else heap.insertOrAdjustKey(e, newKey);
+  }
+
+  void clear() {
+    if ( use_buckets ) bucket_queue.clear(); else heap.clear();
+  }
+
+  bool contains(const IdT e) const {
+    return use_buckets ? bucket_queue.contains(e) : heap.contains(e);
+  }
+
+  PosT size() const {
+    return use_buckets ? bucket_queue.size() : heap.size();
+  }
+
+  bool empty() const {
+    return size() == 0;
+  }
+
+  KeyT keyAtPos(const PosT pos) const {
+    return use_buckets ? bucket_queue.keyAtPos(pos) : heap.keyAtPos(pos);
+  }
+
+  KeyT keyOf(const IdT id) const {
+    return use_buckets ? bucket_queue.keyOf(id) : heap.keyOf(id);
+  }
+
+  IdT at(const PosT pos) const {
+    return use_buckets ? bucket_queue.at(pos) : heap.at(pos);
+  }
+
+  void setHandle(PosT* pos, size_t pos_size) {
+    heap.setHandle(pos, pos_size);
+    bucket_queue.setHandle(pos, pos_size);
+  }
+
+  size_t size_in_bytes() const {
+    return heap.size_in_bytes() + bucket_queue.size_in_bytes();
+  }
+
+private:
+  bool use_buckets;
+  MaxHeap<KeyT, IdT> heap;
+  BucketQueue<KeyT, IdT> bucket_queue;
+};
+
 }
 }
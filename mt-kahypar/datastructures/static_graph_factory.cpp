@@ -95,6 +95,41 @@ namespace mt_kahypar::ds {
           const HyperedgeWeight* edge_weight,
           const HypernodeWeight* node_weight,
           const bool stable_construction_of_incident_edges) {
+    ASSERT(edge_vector.size() == num_edges);
+    return construct_from_edges(num_nodes, num_edges, [&](const size_t pos) {
+      return edge_vector[pos];
+    }, edge_weight, node_weight, stable_construction_of_incident_edges);
+  }
+
+  StaticGraph StaticGraphFactory::constructFromCSR(
+          const HypernodeID num_nodes,
+          const HyperedgeID num_edges,
+          const size_t* edge_offsets,
+          Array<HypernodeID>&& incidence_array,
+          const HyperedgeWeight* edge_weight,
+          const HypernodeWeight* node_weight,
+          const bool stable_construction_of_incident_edges) {
+    ASSERT(edge_offsets[num_edges] == incidence_array.size());
+    const Array<HypernodeID> pins(std::move(incidence_array));
+    tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID e) {
+      if ( edge_offsets[e + 1] - edge_offsets[e] != 2 ) {
+        throw InvalidInputException(
+          "Using graph data structure; but the input hypergraph is not a graph.");
+      }
+    });
+    return construct_from_edges(num_nodes, num_edges, [&](const size_t pos) {
+      return std::make_pair(pins[edge_offsets[pos]], pins[edge_offsets[pos] + 1]);
+    }, edge_weight, node_weight, stable_construction_of_incident_edges);
+  }
+
+  template<typename EdgeFunc>
+  StaticGraph StaticGraphFactory::construct_from_edges(
+          const HypernodeID num_nodes,
+          const HyperedgeID num_edges,
+          const EdgeFunc& edge,
+          const HyperedgeWeight* edge_weight,
+          const HypernodeWeight* node_weight,
+          const bool stable_construction_of_incident_edges) {
     StaticGraph graph;
     graph._num_nodes = num_nodes;
     graph._num_edges = 2 * num_edges;
@@ -102,13 +137,12 @@ namespace mt_kahypar::ds {
     graph._edges.resize(2 * num_edges);
     graph._unique_edge_ids.resize(2 * num_edges);
 
-    ASSERT(edge_vector.size() == num_edges);
-
     // Compute degree for each vertex
     ThreadLocalCounter local_degree_per_vertex(num_nodes);
     tbb::parallel_for(ID(0), num_edges, [&](const size_t pos) {
       Counter& num_degree_per_vertex = local_degree_per_vertex.local();
-      const HypernodeID pins[2] = {edge_vector[pos].first, edge_vector[pos].second};
+      const std::pair<HypernodeID, HypernodeID> e = edge(pos);
+      const HypernodeID pins[2] = {e.first, e.second};
       for (const HypernodeID& pin : pins) {
         ASSERT(pin < num_nodes, V(pin) << V(num_nodes));
         ++num_degree_per_vertex[pin];
@@ -136,11 +170,12 @@ namespace mt_kahypar::ds {
 
     auto setup_edges = [&] {
       tbb::parallel_for(ID(0), num_edges, [&](const size_t pos) {
-        const HypernodeID pin0 = edge_vector[pos].first;
+        const std::pair<HypernodeID, HypernodeID> e = edge(pos);
+        const HypernodeID pin0 = e.first;
         const HyperedgeID incident_edges_pos0 = degree_prefix_sum[pin0] + incident_edges_position[pin0]++;
         ASSERT(incident_edges_pos0 < graph._edges.size());
         StaticGraph::Edge& edge0 = graph._edges[incident_edges_pos0];
-        const HypernodeID pin1 = edge_vector[pos].second;
+        const HypernodeID pin1 = e.second;
         const HyperedgeID incident_edges_pos1 = degree_prefix_sum[pin1] + incident_edges_position[pin1]++;
         ASSERT(incident_edges_pos1 < graph._edges.size());
         StaticGraph::Edge& edge1 = graph._edges[incident_edges_pos1];
@@ -185,4 +220,68 @@ namespace mt_kahypar::ds {
     graph.computeAndSetTotalNodeWeight(parallel_tag_t());
     return graph;
   }
-}
\ No newline at end of file
+
+  StaticGraph StaticGraphFactory::constructFromBinary(const binary::MappedFile& file) {
+    binary::verify(file, binary::Kind::graph,
+      sizeof(StaticGraph::Node), sizeof(StaticGraph::Edge),
+      { sizeof(StaticGraph::Node), sizeof(StaticGraph::Edge), sizeof(HyperedgeID) });
+    const binary::Header& header = *file.header;
+    // The node array contains a sentinel node
+    if ( header.sections[0].num_elements == 0 ||
+         header.sections[0].num_elements - 1 != header.num_nodes ||
+         header.sections[1].num_elements != header.num_edges ||
+         header.sections[2].num_elements != header.num_edges ) {
+      throw InvalidInputException("Binary file is corrupted (inconsistent number of nodes or edges)");
+    }
+    // The graph accesses its arrays via the offsets and IDs stored in the file
+    // without any bounds checks. Thus, all of them are validated before they are adopted.
+    const StaticGraph::Node* nodes = file.section<StaticGraph::Node>(0);
+    const StaticGraph::Edge* edges = file.section<StaticGraph::Edge>(1);
+    const HyperedgeID* unique_edge_ids = file.section<HyperedgeID>(2);
+    if ( nodes[0].firstEntry() != 0 || nodes[header.num_nodes].firstEntry() != header.num_edges ||
+         !binary::forAll(header.num_nodes, [&](const uint64_t u) {
+            return nodes[u].firstEntry() <= nodes[u + 1].firstEntry(); }) ) {
+      throw InvalidInputException("Binary file is corrupted (invalid offsets of nodes)");
+    }
+    if ( !binary::forAll(header.num_edges, [&](const uint64_t e) {
+            return edges[e].source() < header.num_nodes && edges[e].target() < header.num_nodes &&
+              unique_edge_ids[e] < header.num_edges; }) ) {
+      throw InvalidInputException("Binary file is corrupted (invalid edge)");
+    }
+
+    StaticGraph graph;
+    graph._num_nodes = header.num_nodes;
+    graph._num_edges = header.num_edges;
+    graph._total_weight = header.total_weight;
+    // The file is mapped copy-on-write, so the graph can modify its arrays
+    // without changing the file.
+    graph._nodes.adopt(file.section<StaticGraph::Node>(0),
+      header.sections[0].num_elements, file.owner);
+    graph._edges.adopt(file.section<StaticGraph::Edge>(1),
+      header.sections[1].num_elements, file.owner);
+    graph._unique_edge_ids.adopt(file.section<HyperedgeID>(2),
+      header.sections[2].num_elements, file.owner);
+    graph._community_ids.resize(header.num_nodes, 0);
+
+    ASSERT(graph._nodes.size() == graph._num_nodes + 1);
+    ASSERT(graph._edges.size() == graph._num_edges);
+    return graph;
+  }
+
+  void StaticGraphFactory::writeBinary(const StaticGraph& graph, std::ostream& out) {
+    binary::Header header { };
+    header.kind = binary::Kind::graph;
+    header.node_struct_size = sizeof(StaticGraph::Node);
+    header.edge_struct_size = sizeof(StaticGraph::Edge);
+    header.num_nodes = graph._num_nodes;
+    header.num_edges = graph._num_edges;
+    header.num_pins = graph._edges.size();
+    header.total_degree = graph._edges.size();
+    header.max_edge_size = 2;
+    header.total_weight = graph._total_weight;
+    binary::write(out, header, {
+      { graph._nodes.data(), graph._nodes.size(), sizeof(StaticGraph::Node) },
+      { graph._edges.data(), graph._edges.size(), sizeof(StaticGraph::Edge) },
+      { graph._unique_edge_ids.data(), graph._unique_edge_ids.size(), sizeof(HyperedgeID) } });
+  }
+}
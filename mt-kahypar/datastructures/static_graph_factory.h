@@ -28,8 +28,11 @@
 
 #pragma once
 
+#include <ostream>
+
 #include <tbb/enumerable_thread_specific.h>
 
+#include "mt-kahypar/datastructures/binary_format.h"
 #include "mt-kahypar/datastructures/static_graph.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/exception.h"
@@ -63,6 +66,24 @@ class StaticGraphFactory {
                                                 const HypernodeWeight* node_weight = nullptr,
                                                 const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the graph from edges given in CSR format, i.e., the two endpoints of
+  // ! edge e are stored in incidence_array[edge_offsets[e], edge_offsets[e + 1]).
+  // ! The incidence array is released as soon as the graph is constructed.
+  static StaticGraph constructFromCSR(const HypernodeID num_nodes,
+                                      const HyperedgeID num_edges,
+                                      const size_t* edge_offsets,
+                                      Array<HypernodeID>&& incidence_array,
+                                      const HyperedgeWeight* edge_weight = nullptr,
+                                      const HypernodeWeight* node_weight = nullptr,
+                                      const bool stable_construction_of_incident_edges = false);
+
+  // ! Constructs a graph that adopts the arrays stored in a memory-mapped
+  // ! binary file without copying them (see binary_format.h).
+  static StaticGraph constructFromBinary(const binary::MappedFile& file);
+
+  // ! Writes the internal arrays of the graph in the binary format
+  static void writeBinary(const StaticGraph& graph, std::ostream& out);
+
   static std::pair<StaticGraph, parallel::scalable_vector<HypernodeID> > compactify(const StaticGraph&) {
     throw NonSupportedOperationException(
       "Compactify not implemented for static graph.");
@@ -72,6 +93,16 @@ class StaticGraphFactory {
   StaticGraphFactory() { }
 
   static void sort_incident_edges(StaticGraph& graph);
+
+  // ! Constructs the graph from unique edges, where edge(pos) returns
+  // ! the endpoints of the edge with ID pos
+  template<typename EdgeFunc>
+  static StaticGraph construct_from_edges(const HypernodeID num_nodes,
+                                          const HyperedgeID num_edges,
+                                          const EdgeFunc& edge,
+                                          const HyperedgeWeight* edge_weight,
+                                          const HypernodeWeight* node_weight,
+                                          const bool stable_construction_of_incident_edges);
 };
 
 } // namespace ds
@@ -27,13 +27,16 @@
 
 #include "static_hypergraph.h"
 
+#include "mt-kahypar/parallel/parallel_counting_sort.h"
 #include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/datastructures/concurrent_bucket_map.h"
+#include "mt-kahypar/utils/hash.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/memory_tree.h"
 
 #include <tbb/parallel_reduce.h>
 #include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
 
 namespace mt_kahypar::ds {
 
@@ -44,11 +47,20 @@ namespace mt_kahypar::ds {
   */
   struct ContractedHyperedgeInformation {
     HyperedgeID he = kInvalidHyperedge;
-    size_t hash = kEdgeHashSeed;
+    uint64_t hash = kEdgeHashSeed;
     size_t size = std::numeric_limits<size_t>::max();
     bool valid = false;
   };
 
+  // ! Order-independent 64-bit fingerprint of a set of pins
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE uint64_t fingerprint(const HypernodeID* pins, const size_t size) {
+    uint64_t hash = kEdgeHashSeed;
+    for ( size_t i = 0; i < size; ++i ) {
+      hash += hashing::integer::hash64(pins[i]);
+    }
+    return hash;
+  }
+
   /*!
    * Contracts a given community structure. All vertices with the same label
    * are collapsed into the same vertex. The resulting single-pin and parallel
@@ -57,8 +69,11 @@ namespace mt_kahypar::ds {
    * community label (given in 'communities') to a vertex in the coarse hypergraph.
    *
    * \param communities Community structure that should be contracted
+   * \param timer If set, the running time of the identical net detection is reported to the timer
    */
-  StaticHypergraph StaticHypergraph::contract(parallel::scalable_vector<HypernodeID>& communities, bool deterministic) {
+  StaticHypergraph StaticHypergraph::contract(parallel::scalable_vector<HypernodeID>& communities,
+                                              bool deterministic,
+                                              utils::Timer* timer) {
 
     ASSERT(communities.size() == _num_hypernodes);
 
@@ -144,9 +159,7 @@ namespace mt_kahypar::ds {
     // graph are also aggregate in a consecutive memory range and duplicates are removed. Note
     // that parallel and single-pin hyperedges are not removed from the incident nets (will be done
     // in a postprocessing step).
-    auto cs2 = [](const HypernodeID x) { return x * x; };
-    ConcurrentBucketMap<ContractedHyperedgeInformation> hyperedge_hash_map;
-    hyperedge_hash_map.reserve_for_estimated_number_of_insertions(_num_hyperedges);
+    parallel::scalable_vector<ContractedHyperedgeInformation> contracted_hyperedges(_num_hyperedges);
     tbb::parallel_invoke([&] {
       // Contract Hyperedges
       tbb::parallel_for(ID(0), _num_hyperedges, [&](const HyperedgeID& he) {
@@ -161,11 +174,12 @@ namespace mt_kahypar::ds {
           // Map pins to vertex ids in coarse graph
           const size_t incidence_array_start = tmp_hyperedges[he].firstEntry();
           const size_t incidence_array_end = tmp_hyperedges[he].firstInvalidEntry();
-          for ( size_t pos = incidence_array_start; pos < incidence_array_end; ++pos ) {
-            const HypernodeID pin = _incidence_array[pos];
+          size_t pos = incidence_array_start;
+          for ( const HypernodeID& pin : pins(he) ) {
             ASSERT(pos < tmp_incidence_array.size());
-            tmp_incidence_array[pos] = map_to_coarse_hypergraph(pin);
+            tmp_incidence_array[pos++] = map_to_coarse_hypergraph(pin);
           }
+          ASSERT(pos == incidence_array_end);
 
           // Remove duplicates and disabled vertices
           auto first_entry_it = tmp_incidence_array.begin() + incidence_array_start;
@@ -182,13 +196,9 @@ namespace mt_kahypar::ds {
 
 
           if ( contracted_size > 1 ) {
-            // Compute hash of contracted hyperedge
-            size_t footprint = kEdgeHashSeed;
-            for ( size_t pos = incidence_array_start; pos < incidence_array_start + contracted_size; ++pos ) {
-              footprint += cs2(tmp_incidence_array[pos]);
-            }
-            hyperedge_hash_map.insert(footprint,
-                                      ContractedHyperedgeInformation{ he, footprint, contracted_size, true });
+            // Compute fingerprint of contracted hyperedge
+            contracted_hyperedges[he] = ContractedHyperedgeInformation{ he,
+              fingerprint(&tmp_incidence_array[incidence_array_start], contracted_size), contracted_size, true };
           } else {
             // Hyperedge becomes a single-pin hyperedge
             valid_hyperedges[he] = 0;
@@ -219,9 +229,15 @@ namespace mt_kahypar::ds {
         size_t incident_nets_pos = tmp_incident_nets_prefix_sum[coarse_hn] +
                                    tmp_incident_nets_pos[coarse_hn].fetch_add(node_degree);
         ASSERT(incident_nets_pos + node_degree <= tmp_incident_nets_prefix_sum[coarse_hn + 1]);
-        memcpy(tmp_incident_nets.data() + incident_nets_pos,
-               _incident_nets.data() + _hypernodes[hn].firstEntry(),
-               sizeof(HyperedgeID) * node_degree);
+        if ( _are_incident_nets_compressed ) {
+          for ( const HyperedgeID& he : incidentEdges(hn) ) {
+            tmp_incident_nets[incident_nets_pos++] = he;
+          }
+        } else {
+          memcpy(tmp_incident_nets.data() + incident_nets_pos,
+                 _incident_nets.data() + _hypernodes[hn].firstEntry(),
+                 sizeof(HyperedgeID) * node_degree);
+        }
       });
 
       // Setup temporary hypernodes
@@ -298,12 +314,15 @@ namespace mt_kahypar::ds {
     });
 
     // #################### STAGE 3 ####################
-    // In the step before we aggregated hyperedges within a bucket data structure.
-    // Hyperedges with the same hash/footprint are stored inside the same bucket.
-    // We iterate now in parallel over each bucket and sort each bucket
-    // after its hash. A bucket is processed by one thread and parallel
-    // hyperedges are detected by comparing the pins of hyperedges with
-    // the same hash.
+    // Parallel hyperedges have the same fingerprint. We sort the fingerprints of all
+    // contracted hyperedges with a parallel radix sort: A counting sort on the most significant
+    // bits of the fingerprints distributes them to buckets, which are then sorted in parallel.
+    // Afterwards, parallel hyperedges are detected by comparing the pins of hyperedges only
+    // within ranges of equal fingerprints. Since the hyperedges are sorted by fingerprint, size and ID,
+    // the hyperedge with the smallest ID of each group of parallel hyperedges remains (deterministic).
+    if ( timer ) {
+      timer->start_timer("identical_net_detection", "Identical Net Detection");
+    }
 
     // Helper function that checks if two hyperedges are parallel
     // Note, pins inside the hyperedges are sorted.
@@ -327,40 +346,56 @@ namespace mt_kahypar::ds {
       }
     };
 
-    tbb::parallel_for(UL(0), hyperedge_hash_map.numBuckets(), [&](const size_t bucket) {
-      auto& hyperedge_bucket = hyperedge_hash_map.getBucket(bucket);
-      std::sort(hyperedge_bucket.begin(), hyperedge_bucket.end(),
+    // Each bucket should contain a few hundred fingerprints on average
+    const size_t num_radix_bits = std::min(UL(16), static_cast<size_t>(
+      std::ceil(std::log2(std::max(UL(1), static_cast<size_t>(_num_hyperedges) / UL(256))))));
+    const size_t num_buckets = UL(1) << num_radix_bits;
+    auto get_bucket = [&](const ContractedHyperedgeInformation& contracted_he) -> size_t {
+      if ( !contracted_he.valid ) {
+        // Disabled and single-pin hyperedges are moved to an extra bucket
+        return num_buckets;
+      }
+      return num_radix_bits == 0 ? 0 : contracted_he.hash >> (64 - num_radix_bits);
+    };
+    parallel::scalable_vector<ContractedHyperedgeInformation> sorted_hyperedges(_num_hyperedges);
+    const vec<uint32_t> bucket_bounds = parallel::counting_sort(contracted_hyperedges, sorted_hyperedges,
+      num_buckets + 1, get_bucket, tbb::this_task_arena::max_concurrency());
+    parallel::free(contracted_hyperedges);
+
+    tbb::parallel_for(UL(0), num_buckets, [&](const size_t bucket) {
+      const auto bucket_begin = sorted_hyperedges.begin() + bucket_bounds[bucket];
+      const auto bucket_end = sorted_hyperedges.begin() + bucket_bounds[bucket + 1];
+      std::sort(bucket_begin, bucket_end,
                 [&](const ContractedHyperedgeInformation& lhs, const ContractedHyperedgeInformation& rhs) {
                   return std::tie(lhs.hash, lhs.size, lhs.he) < std::tie(rhs.hash, rhs.size, rhs.he);
                 });
 
       // Parallel Hyperedge Detection
-      for ( size_t i = 0; i < hyperedge_bucket.size(); ++i ) {
-        ContractedHyperedgeInformation& contracted_he_lhs = hyperedge_bucket[i];
+      for ( auto lhs_it = bucket_begin; lhs_it < bucket_end; ++lhs_it ) {
+        ContractedHyperedgeInformation& contracted_he_lhs = *lhs_it;
         if ( contracted_he_lhs.valid ) {
           const HyperedgeID lhs_he = contracted_he_lhs.he;
           HyperedgeWeight lhs_weight = tmp_hyperedges[lhs_he].weight();
-          for ( size_t j = i + 1; j < hyperedge_bucket.size(); ++j ) {
-            ContractedHyperedgeInformation& contracted_he_rhs = hyperedge_bucket[j];
+          // Hyperedges with equal fingerprints are stored consecutively
+          for ( auto rhs_it = lhs_it + 1; rhs_it < bucket_end && rhs_it->hash == contracted_he_lhs.hash; ++rhs_it ) {
+            ContractedHyperedgeInformation& contracted_he_rhs = *rhs_it;
             const HyperedgeID rhs_he = contracted_he_rhs.he;
-            if ( contracted_he_rhs.valid &&
-                 contracted_he_lhs.hash == contracted_he_rhs.hash &&
-                 check_if_hyperedges_are_parallel(lhs_he, rhs_he) ) {
+            if ( contracted_he_rhs.valid && check_if_hyperedges_are_parallel(lhs_he, rhs_he) ) {
               // Hyperedges are parallel
               lhs_weight += tmp_hyperedges[rhs_he].weight();
               contracted_he_rhs.valid = false;
               valid_hyperedges[rhs_he] = false;
-            } else if ( contracted_he_lhs.hash != contracted_he_rhs.hash  ) {
-              // In case, hash of both are not equal we go to the next hyperedge
-              // because we compared it with all hyperedges that had an equal hash
-              break;
             }
           }
           tmp_hyperedges[lhs_he].setWeight(lhs_weight);
         }
       }
-      hyperedge_hash_map.free(bucket);
     });
+    parallel::free(sorted_hyperedges);
+
+    if ( timer ) {
+      timer->stop_timer("identical_net_detection");
+    }
 
     // #################### STAGE 4 ####################
     // Coarsened hypergraph is constructed here by writting data from temporary
@@ -512,23 +547,33 @@ namespace mt_kahypar::ds {
     hypergraph._num_pins = _num_pins;
     hypergraph._total_degree = _total_degree;
     hypergraph._total_weight = _total_weight;
+    hypergraph._is_incidence_array_compressed = _is_incidence_array_compressed;
+    hypergraph._are_incident_nets_compressed = _are_incident_nets_compressed;
 
     tbb::parallel_invoke([&] {
       hypergraph._hypernodes.resize(_hypernodes.size());
       memcpy(hypergraph._hypernodes.data(), _hypernodes.data(),
              sizeof(Hypernode) * _hypernodes.size());
     }, [&] {
-      hypergraph._incident_nets.resize(_incident_nets.size());
-      memcpy(hypergraph._incident_nets.data(), _incident_nets.data(),
-             sizeof(HyperedgeID) * _incident_nets.size());
+      if ( _are_incident_nets_compressed ) {
+        hypergraph._compressed_incident_nets = _compressed_incident_nets.copy();
+      } else {
+        hypergraph._incident_nets.resize(_incident_nets.size());
+        memcpy(hypergraph._incident_nets.data(), _incident_nets.data(),
+               sizeof(HyperedgeID) * _incident_nets.size());
+      }
     }, [&] {
       hypergraph._hyperedges.resize(_hyperedges.size());
       memcpy(hypergraph._hyperedges.data(), _hyperedges.data(),
              sizeof(Hyperedge) * _hyperedges.size());
     }, [&] {
-      hypergraph._incidence_array.resize(_incidence_array.size());
-      memcpy(hypergraph._incidence_array.data(), _incidence_array.data(),
-             sizeof(HypernodeID) * _incidence_array.size());
+      if ( _is_incidence_array_compressed ) {
+        hypergraph._compressed_incidence_array = _compressed_incidence_array.copy();
+      } else {
+        hypergraph._incidence_array.resize(_incidence_array.size());
+        memcpy(hypergraph._incidence_array.data(), _incidence_array.data(),
+               sizeof(HypernodeID) * _incidence_array.size());
+      }
     }, [&] {
       hypergraph._community_ids = _community_ids;
     }, [&] {
@@ -553,16 +598,26 @@ namespace mt_kahypar::ds {
     hypergraph._hypernodes.resize(_hypernodes.size());
     memcpy(hypergraph._hypernodes.data(), _hypernodes.data(),
            sizeof(Hypernode) * _hypernodes.size());
-    hypergraph._incident_nets.resize(_incident_nets.size());
-    memcpy(hypergraph._incident_nets.data(), _incident_nets.data(),
-           sizeof(HyperedgeID) * _incident_nets.size());
-
     hypergraph._hyperedges.resize(_hyperedges.size());
     memcpy(hypergraph._hyperedges.data(), _hyperedges.data(),
            sizeof(Hyperedge) * _hyperedges.size());
-    hypergraph._incidence_array.resize(_incidence_array.size());
-    memcpy(hypergraph._incidence_array.data(), _incidence_array.data(),
-           sizeof(HypernodeID) * _incidence_array.size());
+
+    hypergraph._are_incident_nets_compressed = _are_incident_nets_compressed;
+    if ( _are_incident_nets_compressed ) {
+      hypergraph._compressed_incident_nets = _compressed_incident_nets.copy();
+    } else {
+      hypergraph._incident_nets.resize(_incident_nets.size());
+      memcpy(hypergraph._incident_nets.data(), _incident_nets.data(),
+             sizeof(HyperedgeID) * _incident_nets.size());
+    }
+    hypergraph._is_incidence_array_compressed = _is_incidence_array_compressed;
+    if ( _is_incidence_array_compressed ) {
+      hypergraph._compressed_incidence_array = _compressed_incidence_array.copy();
+    } else {
+      hypergraph._incidence_array.resize(_incidence_array.size());
+      memcpy(hypergraph._incidence_array.data(), _incidence_array.data(),
+             sizeof(HypernodeID) * _incidence_array.size());
+    }
 
     hypergraph._community_ids = _community_ids;
     hypergraph.addFixedVertexSupport(_fixed_vertices.copy());
@@ -573,15 +628,92 @@ namespace mt_kahypar::ds {
   void StaticHypergraph::memoryConsumption(utils::MemoryTreeNode* parent) const {
     ASSERT(parent);
     parent->addChild("Hypernodes", sizeof(Hypernode) * _hypernodes.size());
-    parent->addChild("Incident Nets", sizeof(HyperedgeID) * _incident_nets.size());
     parent->addChild("Hyperedges", sizeof(Hyperedge) * _hyperedges.size());
-    parent->addChild("Incidence Array", sizeof(HypernodeID) * _incidence_array.size());
+    if ( _are_incident_nets_compressed ) {
+      parent->addChild("Incident Nets (Compressed)", _compressed_incident_nets.size_in_bytes());
+    } else {
+      parent->addChild("Incident Nets", sizeof(HyperedgeID) * _incident_nets.size());
+    }
+    if ( _is_incidence_array_compressed ) {
+      parent->addChild("Incidence Array (Compressed)", _compressed_incidence_array.size_in_bytes());
+    } else {
+      parent->addChild("Incidence Array", sizeof(HypernodeID) * _incidence_array.size());
+    }
     parent->addChild("Communities", sizeof(PartitionID) * _community_ids.capacity());
     if ( hasFixedVertices() ) {
       parent->addChild("Fixed Vertex Support", _fixed_vertices.size_in_bytes());
     }
   }
 
+  std::pair<size_t, size_t> StaticHypergraph::incidentNetsRange(const HypernodeID u) const {
+    // The incident nets of vertex u are stored in the range [first entry of u, first entry of u + 1).
+    // The first nodeDegree(u) entries are the active incident nets and the remaining ones belong
+    // to removed (large) hyperedges. Contracted hypergraphs have no sentinel.
+    const size_t end = u + 1 < _hypernodes.size() ? _hypernodes[u + 1].firstEntry() : _total_degree;
+    return std::make_pair(_hypernodes[u].firstEntry(), end);
+  }
+
+  void StaticHypergraph::compress(const bool force) {
+#ifdef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+    auto incident_nets_range = [&](const size_t u) {
+      return incidentNetsRange(u);
+    };
+    auto incident_nets_split = [&](const size_t u) {
+      // Active and removed incident nets are compressed separately to be able to restore them
+      return _hypernodes[u].firstInvalidEntry();
+    };
+    auto incidence_array_range = [&](const size_t i) {
+      return std::make_pair(_hyperedges[i].firstEntry(), _hyperedges[i].firstInvalidEntry());
+    };
+    tbb::parallel_invoke([&] {
+      if ( !_are_incident_nets_compressed && _compressed_incident_nets.compress(_incident_nets.data(),
+             _incident_nets.size(), _num_hypernodes, incident_nets_range, incident_nets_split, force) ) {
+        parallel::free(_incident_nets);
+        _are_incident_nets_compressed = true;
+      }
+    }, [&] {
+      if ( !_is_incidence_array_compressed && _compressed_incidence_array.compress(_incidence_array.data(),
+             _incidence_array.size(), _num_hyperedges, incidence_array_range, force) ) {
+        parallel::free(_incidence_array);
+        _is_incidence_array_compressed = true;
+      }
+    });
+#else
+    unused(force);
+    throw NonSupportedOperationException(
+      "Compressed incidence arrays are deactivated. Add -DKAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS=ON "
+      "to the cmake command and rebuild Mt-KaHyPar.");
+#endif
+  }
+
+  void StaticHypergraph::decompress() {
+    auto incident_nets_range = [&](const size_t u) {
+      return incidentNetsRange(u);
+    };
+    auto incident_nets_split = [&](const size_t u) {
+      return _hypernodes[u].firstInvalidEntry();
+    };
+    auto incidence_array_range = [&](const size_t i) {
+      return std::make_pair(_hyperedges[i].firstEntry(), _hyperedges[i].firstInvalidEntry());
+    };
+    tbb::parallel_invoke([&] {
+      if ( _are_incident_nets_compressed ) {
+        _incident_nets.resize(_total_degree);
+        _compressed_incident_nets.decompress(_incident_nets.data(),
+          _num_hypernodes, incident_nets_range, incident_nets_split);
+        _compressed_incident_nets.freeInternalData();
+        _are_incident_nets_compressed = false;
+      }
+    }, [&] {
+      if ( _is_incidence_array_compressed ) {
+        _incidence_array.resize(_num_pins);
+        _compressed_incidence_array.decompress(_incidence_array.data(), _num_hyperedges, incidence_array_range);
+        _compressed_incidence_array.freeInternalData();
+        _is_incidence_array_compressed = false;
+      }
+    });
+  }
+
   // ! Computes the total node weight of the hypergraph
   void StaticHypergraph::computeAndSetTotalNodeWeight(parallel_tag_t) {
     _total_weight = tbb::parallel_reduce(tbb::blocked_range<HypernodeID>(ID(0), _num_hypernodes), 0,
@@ -34,6 +34,7 @@
 
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/compressed_incidence_array.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/datastructures/fixed_vertex_support.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
@@ -44,6 +45,10 @@
 #include "mt-kahypar/utils/exception.h"
 
 namespace mt_kahypar {
+namespace utils {
+class Timer;
+} // namespace utils
+
 namespace ds {
 
 // Forward
@@ -396,10 +401,17 @@ class StaticHypergraph {
   using HypernodeIterator = HypergraphElementIterator<const Hypernode>;
   // ! Iterator to iterate over the hyperedges
   using HyperedgeIterator = HypergraphElementIterator<const Hyperedge>;
+#ifdef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+  // ! Iterator to iterate over the pins of a hyperedge
+  using IncidenceIterator = CompressibleIterator<HypernodeID>;
+  // ! Iterator to iterate over the incident nets of a hypernode
+  using IncidentNetsIterator = CompressibleIterator<HyperedgeID>;
+#else
   // ! Iterator to iterate over the pins of a hyperedge
   using IncidenceIterator = typename IncidenceArray::const_iterator;
   // ! Iterator to iterate over the incident nets of a hypernode
   using IncidentNetsIterator = typename IncidentNets::const_iterator;
+#endif
 
   struct ParallelHyperedge {
     HyperedgeID removed_hyperedge;
@@ -420,6 +432,10 @@ class StaticHypergraph {
     _incident_nets(),
     _hyperedges(),
     _incidence_array(),
+    _is_incidence_array_compressed(false),
+    _are_incident_nets_compressed(false),
+    _compressed_incident_nets(),
+    _compressed_incidence_array(),
     _community_ids(0),
     _fixed_vertices(),
     _tmp_contraction_buffer(nullptr) { }
@@ -441,6 +457,10 @@ class StaticHypergraph {
     _incident_nets(std::move(other._incident_nets)),
     _hyperedges(std::move(other._hyperedges)),
     _incidence_array(std::move(other._incidence_array)),
+    _is_incidence_array_compressed(other._is_incidence_array_compressed),
+    _are_incident_nets_compressed(other._are_incident_nets_compressed),
+    _compressed_incident_nets(std::move(other._compressed_incident_nets)),
+    _compressed_incidence_array(std::move(other._compressed_incidence_array)),
     _community_ids(std::move(other._community_ids)),
     _fixed_vertices(std::move(other._fixed_vertices)),
     _tmp_contraction_buffer(std::move(other._tmp_contraction_buffer)) {
@@ -462,6 +482,10 @@ class StaticHypergraph {
     _incident_nets = std::move(other._incident_nets);
     _hyperedges = std::move(other._hyperedges);
     _incidence_array = std::move(other._incidence_array);
+    _is_incidence_array_compressed = other._is_incidence_array_compressed;
+    _are_incident_nets_compressed = other._are_incident_nets_compressed;
+    _compressed_incident_nets = std::move(other._compressed_incident_nets);
+    _compressed_incidence_array = std::move(other._compressed_incidence_array);
     _community_ids = std::move(other._community_ids);
     _fixed_vertices = std::move(other._fixed_vertices);
     _fixed_vertices.setHypergraph(this);
@@ -569,19 +593,26 @@ class StaticHypergraph {
   // ! Returns a range to loop over the incident nets of hypernode u.
   IteratorRange<IncidentNetsIterator> incidentEdges(const HypernodeID u) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
-    const Hypernode& hn = hypernode(u);
-    return IteratorRange<IncidentNetsIterator>(
-      _incident_nets.cbegin() + hn.firstEntry(),
-      _incident_nets.cbegin() + hn.firstInvalidEntry());
+    return incident_nets_of(u, 0);
   }
 
   // ! Returns a range to loop over the pins of hyperedge e.
   IteratorRange<IncidenceIterator> pins(const HyperedgeID e) const {
     ASSERT(!hyperedge(e).isDisabled(), "Hyperedge" << e << "is disabled");
     const Hyperedge& he = hyperedge(e);
+#ifdef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+    if ( _is_incidence_array_compressed ) {
+      return IteratorRange<IncidenceIterator>(
+        _compressed_incidence_array.iterator(e, he.size()), _compressed_incidence_array.end());
+    }
+    return IteratorRange<IncidenceIterator>(
+      IncidenceIterator(_incidence_array.data() + he.firstEntry()),
+      IncidenceIterator(_incidence_array.data() + he.firstInvalidEntry()));
+#else
     return IteratorRange<IncidenceIterator>(
       _incidence_array.cbegin() + he.firstEntry(),
       _incidence_array.cbegin() + he.firstInvalidEntry());
+#endif
   }
 
     // ####################### Hypernode Information #######################
@@ -737,8 +768,11 @@ class StaticHypergraph {
    * community label (given in 'communities') to a vertex in the coarse hypergraph.
    *
    * \param communities Community structure that should be contracted
+   * \param timer If set, the running time of the identical net detection is reported to the timer
    */
-  StaticHypergraph contract(parallel::scalable_vector<HypernodeID>& communities, bool deterministic = false);
+  StaticHypergraph contract(parallel::scalable_vector<HypernodeID>& communities,
+                            bool deterministic = false,
+                            utils::Timer* timer = nullptr);
 
   bool registerContraction(const HypernodeID, const HypernodeID) {
     throw NonSupportedOperationException(
@@ -780,6 +814,7 @@ class StaticHypergraph {
   */
   void removeEdge(const HyperedgeID he) {
     ASSERT(edgeIsEnabled(he), "Hyperedge" << he << "is disabled");
+    ASSERT(!isCompressed());
     for ( const HypernodeID& pin : pins(he) ) {
       removeIncidentEdgeFromHypernode(he, pin);
     }
@@ -797,6 +832,7 @@ class StaticHypergraph {
   */
   void removeLargeEdge(const HyperedgeID he) {
     ASSERT(edgeIsEnabled(he), "Hyperedge" << he << "is disabled");
+    ASSERT(!isCompressed());
     const size_t incidence_array_start = hyperedge(he).firstEntry();
     const size_t incidence_array_end = hyperedge(he).firstInvalidEntry();
     tbb::parallel_for(incidence_array_start, incidence_array_end, [&](const size_t pos) {
@@ -811,6 +847,7 @@ class StaticHypergraph {
    */
   void restoreLargeEdge(const HyperedgeID& he) {
     ASSERT(!edgeIsEnabled(he), "Hyperedge" << he << "is enabled");
+    ASSERT(!isCompressed());
     enableHyperedge(he);
     const size_t incidence_array_start = hyperedge(he).firstEntry();
     const size_t incidence_array_end = hyperedge(he).firstInvalidEntry();
@@ -852,6 +889,22 @@ class StaticHypergraph {
   // ! Copy static hypergraph sequential
   StaticHypergraph copy() const;
 
+  // ! Replaces the incidence array and incident nets with a compressed representation
+  // ! (see CompressedIncidenceArray). The pins of each hyperedge and the incident
+  // ! nets of each vertex are afterwards enumerated in increasing order of their IDs.
+  // ! An array stays uncompressed if its compressed representation is not smaller
+  // ! (unless force is set). Hyperedges cannot be removed or restored while the
+  // ! hypergraph is compressed. Requires KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS.
+  void compress(const bool force = false);
+
+  // ! Restores the uncompressed incidence array and incident nets
+  void decompress();
+
+  // ! True, if the incidence array or the incident nets are compressed
+  bool isCompressed() const {
+    return _is_incidence_array_compressed || _are_incident_nets_compressed;
+  }
+
   // ! Reset internal data structure
   void reset() { }
 
@@ -905,9 +958,23 @@ class StaticHypergraph {
                                                                                           const size_t pos = 0) const {
     ASSERT(!hypernode(u).isDisabled(), "Hypernode" << u << "is disabled");
     const Hypernode& hn = hypernode(u);
+#ifdef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+    if ( _are_incident_nets_compressed ) {
+      // The active incident nets of u are the first part of list u (see compress())
+      IncidentNetsIterator it = _compressed_incident_nets.iterator(u, hn.size());
+      for ( size_t i = 0; i < pos; ++i ) {
+        ++it;
+      }
+      return IteratorRange<IncidentNetsIterator>(it, _compressed_incident_nets.end());
+    }
+    return IteratorRange<IncidentNetsIterator>(
+      IncidentNetsIterator(_incident_nets.data() + hn.firstEntry() + pos),
+      IncidentNetsIterator(_incident_nets.data() + hn.firstInvalidEntry()));
+#else
     return IteratorRange<IncidentNetsIterator>(
       _incident_nets.cbegin() + hn.firstEntry() + pos,
       _incident_nets.cbegin() + hn.firstInvalidEntry());
+#endif
   }
 
   // ####################### Hyperedge Information #######################
@@ -965,6 +1032,10 @@ class StaticHypergraph {
     hn.setSize(hn.size() + 1);
   }
 
+  // ! Range of the incident nets of vertex u in the uncompressed incident nets
+  // ! (including the removed incident nets)
+  std::pair<size_t, size_t> incidentNetsRange(const HypernodeID u) const;
+
   // ! Allocate the temporary contraction buffer
   void allocateTmpContractionBuffer() {
     if ( !_tmp_contraction_buffer ) {
@@ -1001,6 +1072,16 @@ class StaticHypergraph {
   // ! Incident nets of hypernodes
   IncidenceArray _incidence_array;
 
+  // ! True, if the incidence array is compressed
+  bool _is_incidence_array_compressed;
+  // ! True, if the incident nets are compressed
+  bool _are_incident_nets_compressed;
+  // ! Compressed incident nets (list u contains the active followed
+  // ! by the removed incident nets of vertex u)
+  CompressedIncidenceArray<HyperedgeID> _compressed_incident_nets;
+  // ! Compressed incidence array
+  CompressedIncidenceArray<HypernodeID> _compressed_incidence_array;
+
   // ! Communities
   ds::Clustering _community_ids;
 
@@ -163,4 +163,196 @@ namespace mt_kahypar::ds {
     return hypergraph;
   }
 
-}
\ No newline at end of file
+  StaticHypergraph StaticHypergraphFactory::constructFromCSR(
+          const HypernodeID num_hypernodes,
+          const HyperedgeID num_hyperedges,
+          const size_t* hyperedge_offsets,
+          Array<HypernodeID>&& incidence_array,
+          const HyperedgeWeight* hyperedge_weight,
+          const HypernodeWeight* hypernode_weight,
+          const bool stable_construction_of_incident_edges) {
+    ASSERT(hyperedge_offsets[num_hyperedges] == incidence_array.size());
+    StaticHypergraph hypergraph;
+    hypergraph._num_hypernodes = num_hypernodes;
+    hypergraph._num_hyperedges = num_hyperedges;
+    hypergraph._num_pins = incidence_array.size();
+    hypergraph._incidence_array = std::move(incidence_array);
+    hypergraph._hypernodes.resize(num_hypernodes + 1);
+    hypergraph._hyperedges.resize(num_hyperedges + 1);
+
+    // The pins are already stored at their final position in the incidence array.
+    // Thus, we only have to compute the number of incident nets per vertex.
+    ThreadLocalCounter local_incident_nets_per_vertex(num_hypernodes, 0);
+    tbb::enumerable_thread_specific<size_t> local_max_edge_size(UL(0));
+    tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+      Counter& num_incident_nets_per_vertex = local_incident_nets_per_vertex.local();
+      local_max_edge_size.local() = std::max(
+              local_max_edge_size.local(), hyperedge_offsets[he + 1] - hyperedge_offsets[he]);
+      for ( size_t pos = hyperedge_offsets[he]; pos < hyperedge_offsets[he + 1]; ++pos ) {
+        const HypernodeID pin = hypergraph._incidence_array[pos];
+        ASSERT(pin < num_hypernodes, V(pin) << V(num_hypernodes));
+        ++num_incident_nets_per_vertex[pin];
+      }
+    });
+    hypergraph._max_edge_size = local_max_edge_size.combine(
+            [&](const size_t lhs, const size_t rhs) {
+              return std::max(lhs, rhs);
+            });
+
+    Counter num_incident_nets_per_vertex(num_hypernodes, 0);
+    for ( Counter& c : local_incident_nets_per_vertex ) {
+      tbb::parallel_for(ID(0), num_hypernodes, [&](const size_t pos) {
+        num_incident_nets_per_vertex[pos] += c[pos];
+      });
+    }
+
+    // The prefix sum over the number of incident nets per vertex is used
+    // as start position for each hypernode in the incident nets array.
+    parallel::TBBPrefixSum<size_t> incident_net_prefix_sum(num_incident_nets_per_vertex);
+    tbb::parallel_scan(tbb::blocked_range<size_t>(
+            UL(0), UI64(num_hypernodes)), incident_net_prefix_sum);
+
+    ASSERT(incident_net_prefix_sum.total_sum() == hypergraph._num_pins);
+    hypergraph._total_degree = incident_net_prefix_sum.total_sum();
+    hypergraph._incident_nets.resize(hypergraph._total_degree);
+
+    AtomicCounter incident_nets_position(num_hypernodes,
+                                         parallel::IntegralAtomicWrapper<size_t>(0));
+
+    auto setup_hyperedges = [&] {
+      tbb::parallel_for(ID(0), num_hyperedges, [&](const HyperedgeID he) {
+        StaticHypergraph::Hyperedge& hyperedge = hypergraph._hyperedges[he];
+        hyperedge.enable();
+        hyperedge.setFirstEntry(hyperedge_offsets[he]);
+        hyperedge.setSize(hyperedge_offsets[he + 1] - hyperedge_offsets[he]);
+        if ( hyperedge_weight ) {
+          hyperedge.setWeight(hyperedge_weight[he]);
+        }
+
+        for ( size_t pos = hyperedge.firstEntry(); pos < hyperedge.firstInvalidEntry(); ++pos ) {
+          // Add hyperedge he as a incident net to pin
+          const HypernodeID pin = hypergraph._incidence_array[pos];
+          const size_t incident_nets_pos = incident_net_prefix_sum[pin] + incident_nets_position[pin]++;
+          ASSERT(incident_nets_pos < incident_net_prefix_sum[pin + 1]);
+          hypergraph._incident_nets[incident_nets_pos] = he;
+        }
+      });
+    };
+
+    auto setup_hypernodes = [&] {
+      tbb::parallel_for(ID(0), num_hypernodes, [&](const size_t pos) {
+        StaticHypergraph::Hypernode& hypernode = hypergraph._hypernodes[pos];
+        hypernode.enable();
+        hypernode.setFirstEntry(incident_net_prefix_sum[pos]);
+        hypernode.setSize(incident_net_prefix_sum.value(pos));
+        if ( hypernode_weight ) {
+          hypernode.setWeight(hypernode_weight[pos]);
+        }
+      });
+    };
+
+    auto init_communities = [&] {
+      hypergraph._community_ids.resize(num_hypernodes, 0);
+    };
+
+    tbb::parallel_invoke(setup_hyperedges, setup_hypernodes, init_communities);
+
+    if (stable_construction_of_incident_edges) {
+      tbb::parallel_for(ID(0), num_hypernodes, [&](HypernodeID u) {
+        auto b = hypergraph._incident_nets.begin() + hypergraph.hypernode(u).firstEntry();
+        auto e = hypergraph._incident_nets.begin() + hypergraph.hypernode(u).firstInvalidEntry();
+        std::sort(b, e);
+      });
+    }
+
+    // Add Sentinels
+    hypergraph._hypernodes.back() = StaticHypergraph::Hypernode(hypergraph._incident_nets.size());
+    hypergraph._hyperedges.back() = StaticHypergraph::Hyperedge(hypergraph._incidence_array.size());
+
+    hypergraph.computeAndSetTotalNodeWeight(parallel_tag_t());
+    return hypergraph;
+  }
+
+  StaticHypergraph StaticHypergraphFactory::constructFromBinary(const binary::MappedFile& file) {
+    binary::verify(file, binary::Kind::hypergraph,
+      sizeof(StaticHypergraph::Hypernode), sizeof(StaticHypergraph::Hyperedge),
+      { sizeof(StaticHypergraph::Hypernode), sizeof(StaticHypergraph::Hyperedge),
+        sizeof(HypernodeID), sizeof(HyperedgeID) });
+    const binary::Header& header = *file.header;
+    // Only the input hypergraph has a sentinel node and hyperedge
+    auto has_num_elements = [&](const size_t section, const uint64_t num_elements) {
+      return header.sections[section].num_elements >= num_elements &&
+        header.sections[section].num_elements - num_elements <= 1;
+    };
+    if ( !has_num_elements(0, header.num_nodes) || !has_num_elements(1, header.num_edges) ) {
+      throw InvalidInputException("Binary file is corrupted (inconsistent number of nodes or hyperedges)");
+    }
+    if ( header.sections[2].num_elements != header.num_pins ||
+         header.sections[3].num_elements < header.total_degree ||
+         header.max_edge_size > header.num_pins ||
+         header.num_removed_hyperedges > header.num_edges ) {
+      throw InvalidInputException("Binary file is corrupted (inconsistent number of pins or incident nets)");
+    }
+    // The hypergraph accesses its arrays via the offsets and IDs stored in the file
+    // without any bounds checks. Thus, all of them are validated before they are adopted.
+    const StaticHypergraph::Hypernode* hypernodes = file.section<StaticHypergraph::Hypernode>(0);
+    const StaticHypergraph::Hyperedge* hyperedges = file.section<StaticHypergraph::Hyperedge>(1);
+    const HypernodeID* incidence_array = file.section<HypernodeID>(2);
+    const HyperedgeID* incident_nets = file.section<HyperedgeID>(3);
+    if ( !binary::hasValidRanges(hypernodes, header.num_nodes, header.sections[3].num_elements) ||
+         !binary::hasValidRanges(hyperedges, header.num_edges, header.sections[2].num_elements) ) {
+      throw InvalidInputException("Binary file is corrupted (invalid offsets of nodes or hyperedges)");
+    }
+    if ( !binary::forAll(header.sections[2].num_elements, [&](const uint64_t i) {
+            return incidence_array[i] < header.num_nodes; }) ||
+         !binary::forAll(header.sections[3].num_elements, [&](const uint64_t i) {
+            return incident_nets[i] < header.num_edges; }) ) {
+      throw InvalidInputException("Binary file is corrupted (invalid pin or incident net)");
+    }
+
+    StaticHypergraph hypergraph;
+    hypergraph._num_hypernodes = header.num_nodes;
+    hypergraph._num_hyperedges = header.num_edges;
+    hypergraph._num_removed_hyperedges = header.num_removed_hyperedges;
+    hypergraph._max_edge_size = header.max_edge_size;
+    hypergraph._num_pins = header.num_pins;
+    hypergraph._total_degree = header.total_degree;
+    hypergraph._total_weight = header.total_weight;
+    // The file is mapped copy-on-write, so the hypergraph can modify its arrays
+    // (e.g., when removing large hyperedges) without changing the file.
+    hypergraph._hypernodes.adopt(file.section<StaticHypergraph::Hypernode>(0),
+      header.sections[0].num_elements, file.owner);
+    hypergraph._hyperedges.adopt(file.section<StaticHypergraph::Hyperedge>(1),
+      header.sections[1].num_elements, file.owner);
+    hypergraph._incidence_array.adopt(file.section<HypernodeID>(2),
+      header.sections[2].num_elements, file.owner);
+    hypergraph._incident_nets.adopt(file.section<HyperedgeID>(3),
+      header.sections[3].num_elements, file.owner);
+    hypergraph._community_ids.resize(header.num_nodes, 0);
+    return hypergraph;
+  }
+
+  void StaticHypergraphFactory::writeBinary(const StaticHypergraph& hypergraph, std::ostream& out) {
+    if ( hypergraph.isCompressed() ) {
+      throw NonSupportedOperationException(
+        "Compressed hypergraphs can not be written in binary format (call decompress() first)");
+    }
+    binary::Header header { };
+    header.kind = binary::Kind::hypergraph;
+    header.node_struct_size = sizeof(StaticHypergraph::Hypernode);
+    header.edge_struct_size = sizeof(StaticHypergraph::Hyperedge);
+    header.num_nodes = hypergraph._num_hypernodes;
+    header.num_edges = hypergraph._num_hyperedges;
+    header.num_pins = hypergraph._num_pins;
+    header.total_degree = hypergraph._total_degree;
+    header.max_edge_size = hypergraph._max_edge_size;
+    header.num_removed_hyperedges = hypergraph._num_removed_hyperedges;
+    header.total_weight = hypergraph._total_weight;
+    binary::write(out, header, {
+      { hypergraph._hypernodes.data(), hypergraph._hypernodes.size(), sizeof(StaticHypergraph::Hypernode) },
+      { hypergraph._hyperedges.data(), hypergraph._hyperedges.size(), sizeof(StaticHypergraph::Hyperedge) },
+      { hypergraph._incidence_array.data(), hypergraph._incidence_array.size(), sizeof(HypernodeID) },
+      { hypergraph._incident_nets.data(), hypergraph._incident_nets.size(), sizeof(HyperedgeID) } });
+  }
+
+}
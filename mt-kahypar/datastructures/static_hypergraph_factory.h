@@ -27,8 +27,11 @@
 
 #pragma once
 
+#include <ostream>
+
 #include <tbb/enumerable_thread_specific.h>
 
+#include "mt-kahypar/datastructures/binary_format.h"
 #include "mt-kahypar/datastructures/static_hypergraph.h"
 #include "mt-kahypar/parallel/atomic_wrapper.h"
 #include "mt-kahypar/utils/exception.h"
@@ -51,6 +54,26 @@ class StaticHypergraphFactory {
                                     const HypernodeWeight* hypernode_weight = nullptr,
                                     const bool stable_construction_of_incident_edges = false);
 
+  // ! Constructs the hypergraph from hyperedges given in CSR format, i.e., the pins of
+  // ! hyperedge e are stored in incidence_array[hyperedge_offsets[e], hyperedge_offsets[e + 1])
+  // ! and hyperedge_offsets has num_hyperedges + 1 entries starting with zero.
+  // ! The incidence array is moved into the hypergraph without copying it, which avoids
+  // ! materializing one vector per hyperedge when reading large inputs.
+  static StaticHypergraph constructFromCSR(const HypernodeID num_hypernodes,
+                                           const HyperedgeID num_hyperedges,
+                                           const size_t* hyperedge_offsets,
+                                           Array<HypernodeID>&& incidence_array,
+                                           const HyperedgeWeight* hyperedge_weight = nullptr,
+                                           const HypernodeWeight* hypernode_weight = nullptr,
+                                           const bool stable_construction_of_incident_edges = false);
+
+  // ! Constructs a hypergraph that adopts the arrays stored in a memory-mapped
+  // ! binary file without copying them (see binary_format.h).
+  static StaticHypergraph constructFromBinary(const binary::MappedFile& file);
+
+  // ! Writes the internal arrays of the hypergraph in the binary format
+  static void writeBinary(const StaticHypergraph& hypergraph, std::ostream& out);
+
   static std::pair<StaticHypergraph, vec<HypernodeID>> compactify(const StaticHypergraph&) {
     throw NonSupportedOperationException(
       "Compactify not implemented for static hypergraph.");
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <type_traits>
+
 #include "kahypar-resources/meta/policy_registry.h"
 #include "kahypar-resources/meta/typelist.h"
 
@@ -84,6 +86,16 @@ using TypeTraitsList = kahypar::meta::Typelist<StaticHypergraphTypeTraits
                                                ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(COMMA DynamicGraphTypeTraits)
                                                ENABLE_LARGE_K(COMMA LargeKHypergraphTypeTraits)>;
 
+// ! Key of the type traits in the policy registry. The registry is a singleton of its
+// ! key type. Since a binary can contain the partitioner compiled with 32-bit and 64-bit
+// ! IDs (in different namespaces), we use a key type of our own namespace instead of
+// ! mt_kahypar_partition_type_t such that both variants use separate registries.
+enum class TypeTraitsID : std::underlying_type_t<mt_kahypar_partition_type_t> { };
+
+inline TypeTraitsID typeTraitsID(const mt_kahypar_partition_type_t type) {
+  return static_cast<TypeTraitsID>(type);
+}
+
 #define INSTANTIATE_FUNC_WITH_HYPERGRAPHS(FUNC)                      \
   template FUNC(ds::StaticHypergraph);                               \
   ENABLE_GRAPHS(template FUNC(ds::StaticGraph);)                     \
@@ -84,6 +84,13 @@ namespace mt_kahypar {
             ("partition-output-folder",
              po::value<std::string>(&context.partition.graph_partition_output_folder)->value_name("<string>"),
              "Output folder for partition file")
+            ("hierarchy-cache",
+             po::value<std::string>(&context.partition.hierarchy_cache_file)->value_name("<string>"),
+             "If set, the community detection result and the multilevel hierarchy are loaded from\n"
+             "this file (or written to it, if it does not exist or was computed for a different input\n"
+             "or different preprocessing/coarsening parameters). Repeated runs on the same input\n"
+             "(e.g., with different seeds or imbalance factors) then skip community detection and coarsening.\n"
+             "Only supported for multilevel partitioning in direct mode without fixed vertices.")
             ("mode,m",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& mode) {
@@ -99,11 +106,14 @@ namespace mt_kahypar {
                  context.partition.file_format = FileFormat::hMetis;
                } else if (s == "metis") {
                  context.partition.file_format = FileFormat::Metis;
+               } else if (s == "binary") {
+                 context.partition.file_format = FileFormat::Binary;
                }
              }),
              "Input file format: \n"
              " - hmetis : hMETIS hypergraph file format \n"
-             " - metis : METIS graph file format")
+             " - metis : METIS graph file format \n"
+             " - binary : memory-mappable binary format (see tools/ConvertToBinary)")
             ("instance-type",
              po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& type) {
                context.partition.instance_type = instanceTypeFromString(type);
@@ -145,6 +155,16 @@ namespace mt_kahypar {
             ("show-detailed-timings",
              po::value<bool>(&context.partition.show_detailed_timings)->value_name("<bool>")->default_value(false),
              "If true, shows detailed subtimings of each multilevel phase at the end of the partitioning process.")
+            ("perf-counters",
+             po::value<bool>(&context.partition.measure_perf_counters)->value_name("<bool>")->default_value(false),
+             "If true, samples hardware performance counters (cycles, instructions, LLC and dTLB misses) via\n"
+             "Linux perf events for each sequential timing and shows the aggregated values of all threads\n"
+             "next to the timings (requires a sufficiently low /proc/sys/kernel/perf_event_paranoid).")
+            ("measure-peak-memory",
+             po::value<bool>(&context.partition.measure_peak_memory)->value_name("<bool>")->default_value(false),
+             "If true, measures the peak resident set size (sampled in the background) and the peak of all\n"
+             "tracked allocations (e.g., parallel::scalable_vector) for each sequential timing and shows\n"
+             "them next to the timings.")
             ("show-detailed-clustering-timings",
              po::value<bool>(&context.partition.show_detailed_clustering_timings)->value_name("<bool>")->default_value(
                      false),
@@ -166,16 +186,33 @@ namespace mt_kahypar {
              po::value<bool>(&context.partition.enable_progress_bar)->value_name("<bool>")->default_value(false),
              "If true, shows a progress bar during coarsening and refinement phase.")
             ("time-limit", po::value<int>(&context.partition.time_limit)->value_name("<int>"),
-             "Time limit in seconds (currently not supported)")
+             "Time limit in seconds (0 = no time limit). If partitioning exceeds the time limit,\n"
+             "all remaining refinement rounds, flow searches and V-cycles are skipped. The partition\n"
+             "is then only projected to the input hypergraph and rebalanced if necessary.")
+            ("max-memory", po::value<size_t>(&context.partition.max_memory)->value_name("<size_t>"),
+             "Memory budget in MB (0 = no memory budget). The peak memory of the multilevel algorithm is\n"
+             "estimated before partitioning. If it exceeds the budget, locality relabeling and identical\n"
+             "vertex reduction are disabled, fine levels of the hierarchy are spilled to disk, the number\n"
+             "of initial partitioning runs is reduced and flows are disabled (in this order).\n"
+             "Partitioning fails with an error if the budget still cannot be met.")
             ("sp-process,s",
              po::value<bool>(&context.partition.sp_process_output)->value_name("<bool>")->default_value(false),
              "Summarize partitioning results in RESULT line compatible with sqlplottools "
              "(https://github.com/bingmann/sqlplottools)")
             ("csv", po::value<bool>(&context.partition.csv_output)->value_name("<bool>")->default_value(false),
              "Summarize results in CSV format")
+            ("performance-report",
+             po::value<std::string>(&context.partition.performance_report_file)->value_name("<string>"),
+             "If set, writes a JSON performance report to this file. It contains the metrics, hierarchical\n"
+             "timings, all stats, per-level statistics of coarsening and refinement, the objective delta of\n"
+             "each phase, the memory consumption and the context of the run.")
+            ("trace-file",
+             po::value<std::string>(&context.partition.trace_file)->value_name("<string>"),
+             "If set, records a timeline of all timings, localized FM searches and flow searches for each\n"
+             "thread and writes it to this file in the Chrome trace-event format (view with ui.perfetto.dev).")
             ("algorithm-name",
              po::value<std::string>(&context.algorithm_name)->value_name("<std::string>")->default_value("MT-KaHyPar"),
-             "An algorithm name to print into the summarized output (csv or sqlplottools). ")
+             "An algorithm name to print into the summarized output (csv, json or sqlplottools). ")
             ("part-weights",
              po::value<std::vector<HypernodeWeight> >(&context.partition.max_part_weights)->multitoken()->notifier(
                      [&](auto) {
@@ -199,6 +236,27 @@ namespace mt_kahypar {
             ("p-disable-community-detection-on-mesh-graphs",
              po::value<bool>(&context.preprocessing.disable_community_detection_for_mesh_graphs)->value_name("<bool>")->default_value(true),
              "If true, community detection is dynamically disabled for mesh graphs (as it is not effective for this type of graphs).")
+            ("p-relabeling",
+             po::value<std::string>()->value_name("<string>")->notifier(
+                     [&](const std::string& type) {
+                       context.preprocessing.relabeling = relabelingTypeFromString(type);
+                     })->default_value("none"),
+             "Relabels nodes and hyperedges of the input hypergraph to improve cache locality:\n"
+             "- none\n"
+             "- bfs\n"
+             "- rcm (reverse Cuthill-McKee)\n"
+             "- degree (decreasing node degree)")
+            ("p-compress-incidence-arrays",
+             po::value<bool>(&context.preprocessing.compress_incidence_arrays)->value_name("<bool>")->default_value(false),
+             "If true, the pins of each hyperedge and the incident nets of each vertex of the input hypergraph are "
+             "stored delta-encoded during partitioning (reduces memory volume, only for static hypergraphs). "
+             "An array stays uncompressed if its compressed representation is not smaller. "
+             "Requires -DKAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS=ON.")
+            ("p-identical-vertex-reduction",
+             po::value<bool>(&context.preprocessing.use_identical_vertex_reduction)->value_name("<bool>")->default_value(false),
+             "If true, vertices with identical incident nets are collapsed into one weighted vertex and identical nets "
+             "are merged before community detection and coarsening. The partition is projected back to the input "
+             "hypergraph afterwards (not supported with fixed vertices)")
             ("p-louvain-edge-weight-function",
              po::value<std::string>()->value_name("<string>")->notifier(
                      [&](const std::string& type) {
@@ -229,7 +287,28 @@ namespace mt_kahypar {
             ("p-num-sub-rounds",
              po::value<size_t>(&context.preprocessing.community_detection.num_sub_rounds_deterministic)->value_name(
                      "<size_t>")->default_value(16),
-             "Number of sub-rounds used for deterministic community detection in preprocessing.");
+             "Number of sub-rounds used for deterministic community detection in preprocessing.")
+            ("p-louvain-adaptive-skipping",
+             po::value<bool>(&context.preprocessing.community_detection.adaptive_skipping)->value_name(
+                     "<bool>")->default_value(false),
+             "If true, community detection is skipped for inputs with a mesh-like degree distribution and a small "
+             "sampled clustering coefficient. Otherwise, the modularity gain of the first louvain round decides "
+             "whether to run all levels, stop after the first level or skip community detection.")
+            ("p-louvain-min-clustering-coefficient",
+             po::value<double>(&context.preprocessing.community_detection.min_clustering_coefficient)->value_name(
+                     "<double>")->default_value(0.05),
+             "Community detection is skipped for mesh-like inputs with a smaller sampled clustering coefficient "
+             "(only with p-louvain-adaptive-skipping=true)")
+            ("p-louvain-min-modularity-gain",
+             po::value<double>(&context.preprocessing.community_detection.min_modularity_gain)->value_name(
+                     "<double>")->default_value(0.1),
+             "Community detection is skipped if the first louvain round improves the modularity by less "
+             "(only with p-louvain-adaptive-skipping=true)")
+            ("p-louvain-min-modularity-gain-for-contraction",
+             po::value<double>(&context.preprocessing.community_detection.min_modularity_gain_for_contraction)->value_name(
+                     "<double>")->default_value(0.3),
+             "Louvain stops after the first level if the first round improves the modularity by less "
+             "(only with p-louvain-adaptive-skipping=true)");
     return options;
   }
 
@@ -303,6 +382,12 @@ namespace mt_kahypar {
              "- best\n"
              #endif
              "- best_prefer_unmatched")
+            ("c-rating-vectorization-threshold",
+             po::value<size_t>(&context.coarsening.rating.vectorization_threshold)->value_name(
+                     "<size_t>")->default_value(0),
+             "Hyperedges with at least this many pins and vertices with at least this many contraction partners\n"
+             "are rated with vectorized kernels (AVX2/AVX-512 is selected at runtime depending on the CPU).\n"
+             "A value of zero disables the vectorized kernels.")
             ("c-vertex-degree-sampling-threshold",
              po::value<size_t>(&context.coarsening.vertex_degree_sampling_threshold)->value_name(
                      "<size_t>")->default_value(std::numeric_limits<size_t>::max()),
@@ -310,7 +395,17 @@ namespace mt_kahypar {
             ("c-num-sub-rounds",
              po::value<size_t>(&context.coarsening.num_sub_rounds_deterministic)->value_name(
                      "<size_t>")->default_value(16),
-             "Number of sub-rounds used for deterministic coarsening.");
+             "Number of sub-rounds used for deterministic coarsening.")
+            ("c-two-hop-clustering",
+             po::value<bool>(&context.coarsening.use_two_hop_clustering)->value_name("<bool>")->default_value(false),
+             "If true, vertices that are not clustered in a coarsening pass that stalls (shrink factor below\n"
+             "c-min-shrink-factor) are clustered with other vertices that are leaves of the same neighbor or\n"
+             "share a common high-degree neighbor (two-hop clustering). Experimental, not enabled in any preset.")
+            ("c-two-hop-degree-threshold",
+             po::value<HypernodeID>(&context.coarsening.two_hop_degree_threshold)->value_name(
+                     "<int>")->default_value(100),
+             "Minimum degree of a common neighbor (minimum size of a common hyperedge) such that\n"
+             "its unclustered neighbors are clustered in the two-hop clustering sweep.");
     return options;
   }
 
@@ -406,6 +501,22 @@ namespace mt_kahypar {
              po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.multitry_rounds :
                                 &context.refinement.fm.multitry_rounds))->value_name("<size_t>")->default_value(10),
              "Number of FM rounds within one level of the multilevel hierarchy.")
+            ((initial_partitioning ? "i-r-fm-pq-type" : "r-fm-pq-type"),
+             po::value<std::string>()->value_name("<string>")->notifier(
+                     [&, initial_partitioning](const std::string& type) {
+                       if (initial_partitioning) {
+                         context.initial_partitioning.refinement.fm.pq_type = fmPriorityQueueTypeFromString(type);
+                       } else {
+                         context.refinement.fm.pq_type = fmPriorityQueueTypeFromString(type);
+                       }
+                     })->default_value("heap"),
+             "Priority queues of the localized FM searches:\n"
+             "- heap\n"
+             "- bucket_queue (falls back to heap if gains are not bounded by r-fm-bucket-queue-max-gain)")
+            ((initial_partitioning ? "i-r-fm-bucket-queue-max-gain" : "r-fm-bucket-queue-max-gain"),
+             po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.bucket_queue_max_gain :
+                                &context.refinement.fm.bucket_queue_max_gain))->value_name("<size_t>")->default_value(256),
+             "Maximum absolute gain for which the bucket queue is used (bounded by the maximum weighted node degree).")
             ((initial_partitioning ? "i-r-fm-seed-nodes" : "r-fm-seed-nodes"),
              po::value<size_t>((initial_partitioning ? &context.initial_partitioning.refinement.fm.num_seed_nodes :
                                 &context.refinement.fm.num_seed_nodes))->value_name("<size_t>")->default_value(25),
@@ -54,6 +54,23 @@ mt_kahypar_hypergraph_t constructHypergraph(const HypernodeID& num_hypernodes,
     reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), Hypergraph::TYPE };
 }
 
+// ! Static data structures are constructed directly from the CSR representation
+template<typename Hypergraph>
+mt_kahypar_hypergraph_t constructHypergraphFromCSR(const HypernodeID& num_hypernodes,
+                                                   const HyperedgeID& num_hyperedges,
+                                                   HyperedgeCSR& hyperedges,
+                                                   const HyperedgeWeight* hyperedge_weight,
+                                                   const HypernodeWeight* hypernode_weight,
+                                                   const HypernodeID num_removed_single_pin_hes,
+                                                   const bool stable_construction) {
+  Hypergraph* hypergraph = new Hypergraph();
+  *hypergraph = Hypergraph::Factory::constructFromCSR(num_hypernodes, num_hyperedges,
+    hyperedges.offsets.data(), std::move(hyperedges.pins), hyperedge_weight, hypernode_weight, stable_construction);
+  hypergraph->setNumRemovedHyperedges(num_removed_single_pin_hes);
+  return mt_kahypar_hypergraph_t {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), Hypergraph::TYPE };
+}
+
 mt_kahypar_hypergraph_t readHMetisFile(const std::string& filename,
                                         const mt_kahypar_hypergraph_type_t& type,
                                         const bool stable_construction,
@@ -61,7 +78,7 @@ mt_kahypar_hypergraph_t readHMetisFile(const std::string& filename,
   HyperedgeID num_hyperedges = 0;
   HypernodeID num_hypernodes = 0;
   HyperedgeID num_removed_single_pin_hyperedges = 0;
-  HyperedgeVector hyperedges;
+  HyperedgeCSR hyperedges;
   vec<HyperedgeWeight> hyperedges_weight;
   vec<HypernodeWeight> hypernodes_weight;
   readHypergraphFile(filename, num_hyperedges, num_hypernodes,
@@ -70,23 +87,23 @@ mt_kahypar_hypergraph_t readHMetisFile(const std::string& filename,
 
   switch ( type ) {
     case STATIC_GRAPH:
-      return constructHypergraph<ds::StaticGraph>(
+      return constructHypergraphFromCSR<ds::StaticGraph>(
         num_hypernodes, num_hyperedges, hyperedges,
         hyperedges_weight.data(), hypernodes_weight.data(),
         num_removed_single_pin_hyperedges, stable_construction);
     case DYNAMIC_GRAPH:
       return constructHypergraph<ds::DynamicGraph>(
-        num_hypernodes, num_hyperedges, hyperedges,
+        num_hypernodes, num_hyperedges, toHyperedgeVector(hyperedges),
         hyperedges_weight.data(), hypernodes_weight.data(),
         num_removed_single_pin_hyperedges, stable_construction);
     case STATIC_HYPERGRAPH:
-      return constructHypergraph<ds::StaticHypergraph>(
+      return constructHypergraphFromCSR<ds::StaticHypergraph>(
         num_hypernodes, num_hyperedges, hyperedges,
         hyperedges_weight.data(), hypernodes_weight.data(),
         num_removed_single_pin_hyperedges, stable_construction);
     case DYNAMIC_HYPERGRAPH:
       return constructHypergraph<ds::DynamicHypergraph>(
-        num_hypernodes, num_hyperedges, hyperedges,
+        num_hypernodes, num_hyperedges, toHyperedgeVector(hyperedges),
         hyperedges_weight.data(), hypernodes_weight.data(),
         num_removed_single_pin_hyperedges, stable_construction);
     case NULLPTR_HYPERGRAPH:
@@ -101,27 +118,27 @@ mt_kahypar_hypergraph_t readMetisFile(const std::string& filename,
                                       const bool stable_construction) {
   HyperedgeID num_edges = 0;
   HypernodeID num_vertices = 0;
-  HyperedgeVector edges;
+  HyperedgeCSR edges;
   vec<HyperedgeWeight> edges_weight;
   vec<HypernodeWeight> nodes_weight;
   readGraphFile(filename, num_edges, num_vertices, edges, edges_weight, nodes_weight);
 
   switch ( type ) {
     case STATIC_GRAPH:
-      return constructHypergraph<ds::StaticGraph>(
+      return constructHypergraphFromCSR<ds::StaticGraph>(
         num_vertices, num_edges, edges,
         edges_weight.data(), nodes_weight.data(), 0, stable_construction);
     case DYNAMIC_GRAPH:
       return constructHypergraph<ds::DynamicGraph>(
-        num_vertices, num_edges, edges,
+        num_vertices, num_edges, toHyperedgeVector(edges),
         edges_weight.data(), nodes_weight.data(), 0, stable_construction);
     case STATIC_HYPERGRAPH:
-      return constructHypergraph<ds::StaticHypergraph>(
+      return constructHypergraphFromCSR<ds::StaticHypergraph>(
         num_vertices, num_edges, edges,
         edges_weight.data(), nodes_weight.data(), 0, stable_construction);
     case DYNAMIC_HYPERGRAPH:
       return constructHypergraph<ds::DynamicHypergraph>(
-        num_vertices, num_edges, edges,
+        num_vertices, num_edges, toHyperedgeVector(edges),
         edges_weight.data(), nodes_weight.data(), 0, stable_construction);
     case NULLPTR_HYPERGRAPH:
       return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
@@ -130,8 +147,124 @@ mt_kahypar_hypergraph_t readMetisFile(const std::string& filename,
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
 
+template<typename Hypergraph>
+mt_kahypar_hypergraph_t adoptBinaryFile(const ds::binary::MappedFile& file) {
+  Hypergraph* hypergraph = new Hypergraph();
+  *hypergraph = Hypergraph::Factory::constructFromBinary(file);
+  return mt_kahypar_hypergraph_t {
+    reinterpret_cast<mt_kahypar_hypergraph_s*>(hypergraph), Hypergraph::TYPE };
+}
+
+mt_kahypar_hypergraph_t readBinaryFile(const std::string& filename,
+                                       const mt_kahypar_hypergraph_type_t& type,
+                                       const bool stable_construction) {
+  ds::binary::MappedFile file = mmapBinaryFile(filename);
+  const bool is_graph_file = file.header->kind == ds::binary::Kind::graph;
+  if ( type == STATIC_HYPERGRAPH && !is_graph_file ) {
+    return adoptBinaryFile<ds::StaticHypergraph>(file);
+  } else if ( type == STATIC_GRAPH && is_graph_file ) {
+    return adoptBinaryFile<ds::StaticGraph>(file);
+  } else if ( type == NULLPTR_HYPERGRAPH ) {
+    return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+
+  // The requested data structure can not adopt the arrays of the binary file.
+  // In that case, we extract the hyperedges from the static representation
+  // and construct the requested data structure from them.
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_hyperedges = 0;
+  HyperedgeID num_removed_single_pin_hes = 0;
+  HyperedgeVector hyperedges;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+  auto extract_node_weights = [&](const auto& hypergraph) {
+    num_hypernodes = hypergraph.initialNumNodes();
+    hypernodes_weight.resize(num_hypernodes);
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      hypernodes_weight[hn] = hypergraph.nodeWeight(hn);
+    });
+  };
+  if ( is_graph_file ) {
+    ds::StaticGraph graph = ds::StaticGraphFactory::constructFromBinary(file);
+    extract_node_weights(graph);
+    num_hyperedges = graph.initialNumEdges() / 2;
+    hyperedges.resize(num_hyperedges);
+    hyperedges_weight.resize(num_hyperedges);
+    graph.doParallelForAllEdges([&](const HyperedgeID& e) {
+      const HypernodeID source = graph.edgeSource(e);
+      const HypernodeID target = graph.edgeTarget(e);
+      if ( source < target ) {
+        const HyperedgeID id = graph.uniqueEdgeID(e);
+        hyperedges[id] = Hyperedge { source, target };
+        hyperedges_weight[id] = graph.edgeWeight(e);
+      }
+    });
+  } else {
+    ds::StaticHypergraph hypergraph = ds::StaticHypergraphFactory::constructFromBinary(file);
+    extract_node_weights(hypergraph);
+    num_hyperedges = hypergraph.initialNumEdges();
+    num_removed_single_pin_hes = hypergraph.numRemovedHyperedges();
+    hyperedges.resize(num_hyperedges);
+    hyperedges_weight.resize(num_hyperedges);
+    hypergraph.doParallelForAllEdges([&](const HyperedgeID& he) {
+      for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+        hyperedges[he].push_back(pin);
+      }
+      hyperedges_weight[he] = hypergraph.edgeWeight(he);
+    });
+  }
+
+  switch ( type ) {
+    case STATIC_GRAPH:
+      return constructHypergraph<ds::StaticGraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hes, stable_construction);
+    case DYNAMIC_GRAPH:
+      return constructHypergraph<ds::DynamicGraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hes, stable_construction);
+    case STATIC_HYPERGRAPH:
+      return constructHypergraph<ds::StaticHypergraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hes, stable_construction);
+    case DYNAMIC_HYPERGRAPH:
+      return constructHypergraph<ds::DynamicHypergraph>(
+        num_hypernodes, num_hyperedges, hyperedges,
+        hyperedges_weight.data(), hypernodes_weight.data(),
+        num_removed_single_pin_hes, stable_construction);
+    case NULLPTR_HYPERGRAPH:
+      return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+  }
+
+  return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
+}
+
 } // namespace
 
+InstanceType instanceTypeOfInputFile(const std::string& filename, const FileFormat& format) {
+  if ( format == FileFormat::Binary ) {
+    ds::binary::MappedFile file = mmapBinaryFile(filename);
+    return file.header->kind == ds::binary::Kind::graph ?
+      InstanceType::graph : InstanceType::hypergraph;
+  }
+  return to_instance_type(format);
+}
+
+bool requires64BitIDs(const std::string& filename, const FileFormat& format) {
+  if ( format == FileFormat::Binary ) {
+    ds::binary::MappedFile file = mmapBinaryFile(filename);
+    return file.header->hypernode_id_size > sizeof(uint32_t) ||
+      file.header->hyperedge_id_size > sizeof(uint32_t);
+  }
+  // The largest 32-bit value is reserved for invalid IDs
+  const InputSize size = readInputSize(filename, format == FileFormat::Metis);
+  const uint64_t max_id = std::numeric_limits<uint32_t>::max();
+  return size.num_hypernodes >= max_id || size.num_hyperedges >= max_id || size.num_pins >= max_id;
+}
+
 mt_kahypar_hypergraph_t readInputFile(const std::string& filename,
                                       const PresetType& preset,
                                       const InstanceType& instance,
@@ -144,6 +277,8 @@ mt_kahypar_hypergraph_t readInputFile(const std::string& filename,
       filename, type, stable_construction, remove_single_pin_hes);
     case FileFormat::Metis: return readMetisFile(
       filename, type, stable_construction);
+    case FileFormat::Binary: return readBinaryFile(
+      filename, type, stable_construction);
   }
   return mt_kahypar_hypergraph_t { nullptr, NULLPTR_HYPERGRAPH };
 }
@@ -160,6 +295,9 @@ Hypergraph readInputFile(const std::string& filename,
       break;
     case FileFormat::Metis: hypergraph = readMetisFile(
       filename, Hypergraph::TYPE, stable_construction);
+      break;
+    case FileFormat::Binary: hypergraph = readBinaryFile(
+      filename, Hypergraph::TYPE, stable_construction);
   }
   return std::move(utils::cast<Hypergraph>(hypergraph));
 }
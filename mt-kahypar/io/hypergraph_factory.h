@@ -44,6 +44,16 @@ mt_kahypar_hypergraph_t readInputFile(const std::string& filename,
                                       const bool stable_construction = false,
                                       const bool remove_single_pin_hes = true);
 
+// ! Returns whether the input file contains a graph or a hypergraph. For the
+// ! text formats this follows from the format, binary files store it in their header.
+InstanceType instanceTypeOfInputFile(const std::string& filename,
+                                     const FileFormat& format);
+
+// ! Returns whether the vertices, hyperedges or pins of the input file exceed the range
+// ! of 32-bit IDs. Binary files can only be read with the ID width they were written with.
+bool requires64BitIDs(const std::string& filename,
+                      const FileFormat& format);
+
 template<typename Hypergraph>
 Hypergraph readInputFile(const std::string& filename,
                          const FileFormat& format,
@@ -27,11 +27,15 @@
 
 #include "hypergraph_io.h"
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <thread>
 #include <memory>
+#include <numeric>
 #include <vector>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -49,6 +53,7 @@
 #include <tbb/parallel_for.h>
 
 #include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/exception.h"
@@ -88,7 +93,9 @@ namespace mt_kahypar::io {
     return static_cast<size_t>(stat_buf.st_size);
   }
 
-  FileHandle mmap_file(const std::string& filename) {
+  // ! If copy_on_write is set, the file is mapped privately and writable, i.e.,
+  // ! modifications of the mapped memory are not written back to the file.
+  FileHandle mmap_file(const std::string& filename, const bool copy_on_write = false) {
     FileHandle handle;
     handle.length = file_size(filename);
 
@@ -119,14 +126,16 @@ namespace mt_kahypar::io {
       }
 
       // Create file mapping
-      handle.hMem = CreateFileMapping( handle.hFile, &sa, PAGE_READONLY, 0, handle.length, NULL);
+      handle.hMem = CreateFileMapping( handle.hFile, &sa,
+        copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY, 0, handle.length, NULL);
       free(pSD);
       if (handle.hMem == NULL) {
         throw InvalidInputException("Invalid file mapping when opening: " + filename);
       }
 
       // map file to memory
-      handle.mapped_file = (char*) MapViewOfFile(handle.hMem, FILE_MAP_READ, 0, 0, 0);
+      handle.mapped_file = (char*) MapViewOfFile(handle.hMem,
+        copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
       if ( handle.mapped_file == NULL ) {
         throw SystemException("Failed to map file to main memory:" + filename);
       }
@@ -135,7 +144,9 @@ namespace mt_kahypar::io {
       if ( handle.fd < -1 ) {
         throw InvalidInputException("Could not open: " + filename);
       }
-      handle.mapped_file = (char*) mmap(0, handle.length, PROT_READ, MAP_SHARED, handle.fd, 0);
+      handle.mapped_file = copy_on_write ?
+        (char*) mmap(0, handle.length, PROT_READ | PROT_WRITE, MAP_PRIVATE, handle.fd, 0) :
+        (char*) mmap(0, handle.length, PROT_READ, MAP_SHARED, handle.fd, 0);
       if ( handle.mapped_file == MAP_FAILED ) {
         close(handle.fd);
         throw SystemException("Error while mapping file to memory");
@@ -220,6 +231,103 @@ namespace mt_kahypar::io {
     do_line_ending(mapped_file, pos);
   }
 
+  // ! Splits the input file between start and end into chunks of roughly equal size,
+  // ! which are scanned in parallel. Each chunk boundary is moved to the beginning
+  // ! of the next line. Returns the boundaries of all chunks including start and end.
+  vec<size_t> computeChunkBoundaries(char* mapped_file,
+                                     const size_t start,
+                                     const size_t end) {
+    const size_t min_chunk_size = 4096;
+    const size_t num_chunks = std::max(UL(1), std::min(
+      UL(2) * std::thread::hardware_concurrency(), (end - start) / min_chunk_size));
+    const size_t chunk_size = (end - start) / num_chunks;
+    vec<size_t> boundaries(num_chunks + 1, end);
+    boundaries[0] = start;
+    tbb::parallel_for(UL(1), num_chunks, [&](const size_t i) {
+      size_t boundary = start + i * chunk_size;
+      while ( boundary < end && mapped_file[boundary - 1] != '\n' ) {
+        ++boundary;
+      }
+      boundaries[i] = boundary;
+    });
+    return boundaries;
+  }
+
+  // ! Scans the lines between pos and end that are not comments, until max_lines
+  // ! such lines are found. Calls f(pos) for each line, where pos points to the
+  // ! beginning of the line and f has to advance pos to the beginning of the next line.
+  // ! Returns the position after the last scanned line.
+  template<typename F>
+  size_t scanLines(char* mapped_file,
+                   size_t pos,
+                   const size_t end,
+                   const size_t max_lines,
+                   size_t& num_lines,
+                   const F& f) {
+    num_lines = 0;
+    while ( pos < end && num_lines < max_lines ) {
+      if ( mapped_file[pos] == '%' ) {
+        // Skip Comments
+        goto_next_line(mapped_file, pos, end);
+      } else {
+        f(pos);
+        ++num_lines;
+      }
+    }
+    return pos;
+  }
+
+  // ! Assigns the first num_lines lines (comments excluded) after the header to chunks that
+  // ! are scanned in parallel. Line boundaries are determined in parallel and line IDs are
+  // ! assigned to the chunks via a prefix sum over the number of lines per chunk.
+  // ! Afterwards, pos points to the beginning of the line following the last line.
+  // ! If allow_missing_lines is set, a file that ends before num_lines lines are found
+  // ! is accepted and the missing lines are assigned to an additional empty chunk at
+  // ! the end of the file. Otherwise, an exception is thrown.
+  void computeLineChunks(char* mapped_file,
+                         size_t& pos,
+                         const size_t length,
+                         const size_t num_lines,
+                         const bool allow_missing_lines,
+                         vec<size_t>& boundaries,
+                         vec<size_t>& first_line) {
+    boundaries = computeChunkBoundaries(mapped_file, pos, length);
+    const size_t num_chunks = boundaries.size() - 1;
+    vec<size_t> num_lines_in_chunk(num_chunks, 0);
+    tbb::parallel_for(UL(0), num_chunks, [&](const size_t i) {
+      scanLines(mapped_file, boundaries[i], boundaries[i + 1],
+        std::numeric_limits<size_t>::max(), num_lines_in_chunk[i], [&](size_t& current_pos) {
+          goto_next_line(mapped_file, current_pos, length);
+        });
+    });
+
+    // The lines after the last requested line belong to another section of the file.
+    // Therefore, we determine the exact end of the last line in the chunk that contains it.
+    first_line.assign(1, 0);
+    for ( size_t i = 0; i < num_chunks; ++i ) {
+      if ( first_line.back() + num_lines_in_chunk[i] >= num_lines ) {
+        size_t lines = 0;
+        pos = scanLines(mapped_file, boundaries[i], boundaries[i + 1],
+          num_lines - first_line.back(), lines, [&](size_t& current_pos) {
+            goto_next_line(mapped_file, current_pos, length);
+          });
+        first_line.push_back(first_line.back() + lines);
+        boundaries[i + 1] = pos;
+        boundaries.resize(i + 2);
+        return;
+      }
+      first_line.push_back(first_line.back() + num_lines_in_chunk[i]);
+    }
+    if ( allow_missing_lines ) {
+      pos = length;
+      boundaries.push_back(length);
+      first_line.push_back(num_lines);
+      return;
+    }
+    throw InvalidInputException("Input file contains only " + STR(first_line.back()) +
+      " lines, but " + STR(num_lines) + " are expected");
+  }
+
   struct HyperedgeRange {
     const size_t start;
     const size_t end;
@@ -262,7 +370,7 @@ namespace mt_kahypar::io {
                                      const size_t length,
                                      const HyperedgeID num_hyperedges,
                                      const mt_kahypar::Type type,
-                                     HyperedgeVector& hyperedges,
+                                     HyperedgeCSR& hyperedges,
                                      vec<HyperedgeWeight>& hyperedges_weight,
                                      const bool remove_single_pin_hes) {
     HyperedgeReadResult res;
@@ -272,48 +380,42 @@ namespace mt_kahypar::io {
 
     vec<HyperedgeRange> hyperedge_ranges;
     tbb::parallel_invoke([&] {
-      // Sequential pass over all hyperedges to determine ranges in the
-      // input file that are read in parallel.
-      size_t current_range_start = pos;
-      HyperedgeID current_range_start_id = 0;
-      HyperedgeID current_range_num_hyperedges = 0;
-      HyperedgeID current_num_hyperedges = 0;
-      const HyperedgeID num_hyperedges_per_range = std::max(
-              (num_hyperedges / ( 2 * std::thread::hardware_concurrency())), ID(1));
-      while ( current_num_hyperedges < num_hyperedges ) {
-        // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
-          goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
-        }
-
-        // This check is fine even with windows line endings!
-        ASSERT(mapped_file[pos - 1] == '\n');
-        if ( !remove_single_pin_hes || !isSinglePinHyperedge(mapped_file, pos, length, has_hyperedge_weights) ) {
-          ++current_range_num_hyperedges;
-        } else {
-          ++res.num_removed_single_pin_hyperedges;
-        }
-        ++current_num_hyperedges;
-        goto_next_line(mapped_file, pos, length);
+      // Determine ranges in the input file that are read in parallel. Each range
+      // corresponds to a chunk of lines in the input file. The hyperedge IDs of a range
+      // are given by the number of hyperedges in all previous ranges that are not removed.
+      vec<size_t> boundaries;
+      vec<size_t> first_line;
+      computeLineChunks(mapped_file, pos, length, num_hyperedges, false, boundaries, first_line);
+      const size_t num_chunks = boundaries.size() - 1;
+      vec<HyperedgeID> num_single_pin_hyperedges(num_chunks, 0);
+      if ( remove_single_pin_hes ) {
+        tbb::parallel_for(UL(0), num_chunks, [&](const size_t i) {
+          size_t num_lines = 0;
+          scanLines(mapped_file, boundaries[i], boundaries[i + 1],
+            std::numeric_limits<size_t>::max(), num_lines, [&](size_t& current_pos) {
+              // This check is fine even with windows line endings!
+              ASSERT(mapped_file[current_pos - 1] == '\n');
+              if ( isSinglePinHyperedge(mapped_file, current_pos, length, has_hyperedge_weights) ) {
+                ++num_single_pin_hyperedges[i];
+              }
+              goto_next_line(mapped_file, current_pos, length);
+            });
+        });
+      }
 
-        // If there are enough hyperedges in the current scanned range
-        // we store that range, which will be later processed in parallel
-        if ( current_range_num_hyperedges == num_hyperedges_per_range ) {
+      HyperedgeID current_range_start_id = 0;
+      for ( size_t i = 0; i < num_chunks; ++i ) {
+        const HyperedgeID num_hyperedges_in_range =
+          first_line[i + 1] - first_line[i] - num_single_pin_hyperedges[i];
+        if ( num_hyperedges_in_range > 0 ) {
           hyperedge_ranges.push_back(HyperedgeRange {
-                  current_range_start, pos, current_range_start_id, current_range_num_hyperedges});
-          current_range_start = pos;
-          current_range_start_id += current_range_num_hyperedges;
-          current_range_num_hyperedges = 0;
+            boundaries[i], boundaries[i + 1], current_range_start_id, num_hyperedges_in_range });
         }
-      }
-      if ( current_range_num_hyperedges > 0 ) {
-        hyperedge_ranges.push_back(HyperedgeRange {
-                current_range_start, pos, current_range_start_id, current_range_num_hyperedges});
+        current_range_start_id += num_hyperedges_in_range;
+        res.num_removed_single_pin_hyperedges += num_single_pin_hyperedges[i];
       }
     }, [&] {
-      hyperedges.resize(num_hyperedges);
+      hyperedges.offsets.assign(num_hyperedges + 1, 0);
     }, [&] {
       if ( has_hyperedge_weights ) {
         hyperedges_weight.resize(num_hyperedges);
@@ -321,14 +423,14 @@ namespace mt_kahypar::io {
     });
 
     const HyperedgeID tmp_num_hyperedges = num_hyperedges - res.num_removed_single_pin_hyperedges;
-    hyperedges.resize(tmp_num_hyperedges);
+    hyperedges.offsets.resize(tmp_num_hyperedges + 1);
     if ( has_hyperedge_weights ) {
       hyperedges_weight.resize(tmp_num_hyperedges);
     }
 
-    // Process all ranges in parallel and build hyperedge vector
-    tbb::parallel_for(UL(0), hyperedge_ranges.size(), [&](const size_t i) {
-      HyperedgeRange& range = hyperedge_ranges[i];
+    // Calls f(he, pos, end) for each hyperedge in the given range that is not removed, where
+    // pos points to the beginning of its line. f must advance pos to the next line.
+    auto for_each_hyperedge_in_range = [&](const HyperedgeRange& range, const auto& f) {
       size_t current_pos = range.start;
       const size_t current_end = range.end;
       HyperedgeID current_id = range.start_id;
@@ -343,47 +445,94 @@ namespace mt_kahypar::io {
         }
 
         if ( !remove_single_pin_hes || !isSinglePinHyperedge(mapped_file, current_pos, current_end, has_hyperedge_weights) ) {
-          ASSERT(current_id < hyperedges.size());
+          ASSERT(current_id < tmp_num_hyperedges);
+          f(current_id, current_pos, current_end);
+          ++current_id;
+        } else {
+          goto_next_line(mapped_file, current_pos, current_end);
+        }
+      }
+    };
+
+    // First pass: Count the pins of each hyperedge in parallel. The prefix sum over
+    // the pin counts determines the position of each hyperedge in the incidence array.
+    tbb::parallel_for(UL(0), hyperedge_ranges.size(), [&](const size_t i) {
+      for_each_hyperedge_in_range(hyperedge_ranges[i],
+        [&](const HyperedgeID he, size_t& current_pos, const size_t current_end) {
           if ( has_hyperedge_weights ) {
-            hyperedges_weight[current_id] = read_number(mapped_file, current_pos, current_end);
+            read_number(mapped_file, current_pos, current_end);
           }
-
-          Hyperedge& hyperedge = hyperedges[current_id];
           // Note, a hyperedge line must contain at least one pin
-          HypernodeID pin = read_number(mapped_file, current_pos, current_end);
-          ASSERT(pin > 0, V(current_id));
-          hyperedge.push_back(pin - 1);
+          size_t num_pins = 1;
+          read_number(mapped_file, current_pos, current_end);
           while ( !is_line_ending(mapped_file, current_pos) ) {
-            pin = read_number(mapped_file, current_pos, current_end);
-            ASSERT(pin > 0, V(current_id));
-            hyperedge.push_back(pin - 1);
+            read_number(mapped_file, current_pos, current_end);
+            ++num_pins;
           }
           do_line_ending(mapped_file, current_pos);
+          hyperedges.offsets[he + 1] = num_pins;
+        });
+    });
+    parallel_prefix_sum(hyperedges.offsets.begin() + 1, hyperedges.offsets.end(),
+      hyperedges.offsets.begin() + 1, std::plus<>(), UL(0));
+    hyperedges.pins.resizeNoAssign(hyperedges.offsets.back());
 
-          // Detect duplicated pins
-          std::sort(hyperedge.begin(), hyperedge.end());
-          size_t j = 1;
-          for ( size_t i = 1; i < hyperedge.size(); ++i ) {
-            if ( hyperedge[j - 1] != hyperedge[i] ) {
-              std::swap(hyperedge[i], hyperedge[j++]);
-            }
+    // Second pass: Process all ranges in parallel and write the pins of each
+    // hyperedge directly to its position in the incidence array
+    tbb::parallel_for(UL(0), hyperedge_ranges.size(), [&](const size_t i) {
+      for_each_hyperedge_in_range(hyperedge_ranges[i],
+        [&](const HyperedgeID he, size_t& current_pos, const size_t current_end) {
+          if ( has_hyperedge_weights ) {
+            hyperedges_weight[he] = read_number(mapped_file, current_pos, current_end);
+          }
+
+          HypernodeID* first = hyperedges.pins.data() + hyperedges.offsets[he];
+          HypernodeID* last = hyperedges.pins.data() + hyperedges.offsets[he + 1];
+          for ( HypernodeID* pin = first; pin < last; ++pin ) {
+            *pin = read_number(mapped_file, current_pos, current_end);
+            ASSERT(*pin > 0, V(he));
+            --(*pin);
           }
-          if ( j < hyperedge.size() ) {
-            // Remove duplicated pins
+          ASSERT(is_line_ending(mapped_file, current_pos));
+          do_line_ending(mapped_file, current_pos);
+
+          // Detect duplicated pins
+          std::sort(first, last);
+          HypernodeID* unique_last = std::unique(first, last);
+          if ( unique_last < last ) {
+            // Mark duplicated pins as invalid, they are removed afterwards
             __atomic_fetch_add(&res.num_hes_with_duplicated_pins, 1, __ATOMIC_RELAXED);
-            __atomic_fetch_add(&res.num_duplicated_pins, hyperedge.size() - j, __ATOMIC_RELAXED);
-            for ( size_t i = j; i < hyperedge.size(); ++i ) {
-              hyperedge.pop_back();
-            }
+            __atomic_fetch_add(&res.num_duplicated_pins, last - unique_last, __ATOMIC_RELAXED);
+            std::fill(unique_last, last, kInvalidHypernode);
           }
+          ASSERT(unique_last - first >= 2);
+        });
+    });
 
-          ASSERT(hyperedge.size() >= 2);
-          ++current_id;
-        } else {
-          goto_next_line(mapped_file, current_pos, current_end);
+    if ( res.num_duplicated_pins > 0 ) {
+      // Compact the incidence array by removing the duplicated pins
+      vec<size_t> offsets(tmp_num_hyperedges + 1, 0);
+      tbb::parallel_for(ID(0), tmp_num_hyperedges, [&](const HyperedgeID he) {
+        size_t num_pins = 0;
+        for ( size_t j = hyperedges.offsets[he]; j < hyperedges.offsets[he + 1] &&
+                hyperedges.pins[j] != kInvalidHypernode; ++j ) {
+          ++num_pins;
         }
-      }
-    });
+        offsets[he + 1] = num_pins;
+      });
+      parallel_prefix_sum(offsets.begin() + 1, offsets.end(),
+        offsets.begin() + 1, std::plus<>(), UL(0));
+
+      ds::Array<HypernodeID> pins;
+      pins.resizeNoAssign(offsets.back());
+      tbb::parallel_for(ID(0), tmp_num_hyperedges, [&](const HyperedgeID he) {
+        std::copy(hyperedges.pins.data() + hyperedges.offsets[he],
+                  hyperedges.pins.data() + hyperedges.offsets[he] + (offsets[he + 1] - offsets[he]),
+                  pins.data() + offsets[he]);
+      });
+      hyperedges.offsets = std::move(offsets);
+      hyperedges.pins = std::move(pins);
+    }
     return res;
   }
 
@@ -412,7 +561,7 @@ namespace mt_kahypar::io {
                           HyperedgeID& num_hyperedges,
                           HypernodeID& num_hypernodes,
                           HyperedgeID& num_removed_single_pin_hyperedges,
-                          HyperedgeVector& hyperedges,
+                          HyperedgeCSR& hyperedges,
                           vec<HyperedgeWeight>& hyperedges_weight,
                           vec<HypernodeWeight>& hypernodes_weight,
                           const bool remove_single_pin_hes) {
@@ -443,6 +592,21 @@ namespace mt_kahypar::io {
     munmap_file(handle);
   }
 
+  void readHypergraphFile(const std::string& filename,
+                          HyperedgeID& num_hyperedges,
+                          HypernodeID& num_hypernodes,
+                          HyperedgeID& num_removed_single_pin_hyperedges,
+                          HyperedgeVector& hyperedges,
+                          vec<HyperedgeWeight>& hyperedges_weight,
+                          vec<HypernodeWeight>& hypernodes_weight,
+                          const bool remove_single_pin_hes) {
+    HyperedgeCSR csr;
+    readHypergraphFile(filename, num_hyperedges, num_hypernodes,
+      num_removed_single_pin_hyperedges, csr, hyperedges_weight,
+      hypernodes_weight, remove_single_pin_hes);
+    hyperedges = toHyperedgeVector(csr);
+  }
+
   void readMetisHeader(char* mapped_file,
                        size_t& pos,
                        const size_t length,
@@ -485,75 +649,69 @@ namespace mt_kahypar::io {
                     const HypernodeID num_vertices,
                     const bool has_edge_weights,
                     const bool has_vertex_weights,
-                    HyperedgeVector& edges,
+                    HyperedgeCSR& edges,
                     vec<HyperedgeWeight>& edges_weight,
                     vec<HypernodeWeight>& vertices_weight) {
     vec<VertexRange> vertex_ranges;
     tbb::parallel_invoke([&] {
-      // Sequential pass over all vertices to determine ranges in the
-      // input file that are read in parallel.
-      // Additionally, we need to sum the vertex degrees to determine edge indices.
-      size_t current_range_start = pos;
-      HypernodeID current_range_vertex_id = 0;
-      HypernodeID current_range_num_vertices = 0;
-      HyperedgeID current_range_edge_id = 0;
-      HyperedgeID current_range_num_edges = 0;
-      const HypernodeID num_vertices_per_range = std::max(
-              (num_vertices / ( 2 * std::thread::hardware_concurrency())), ID(1));
-      while ( current_range_vertex_id + current_range_num_vertices < num_vertices ) {
-        // Skip Comments
-        ASSERT(pos < length);
-        while ( mapped_file[pos] == '%' ) {
-          goto_next_line(mapped_file, pos, length);
-          ASSERT(pos < length);
-        }
-
-        ASSERT(mapped_file[pos - 1] == '\n');
-        ++current_range_num_vertices;
-
-        // Count the forward edges, ignore backward edges.
-        // This is necessary because we can only calculate unique edge ids
-        // efficiently if the edges are deduplicated.
-        if ( has_vertex_weights ) {
-          read_number(mapped_file, pos, length);
-        }
-        HyperedgeID vertex_degree = 0;
-        while (!is_line_ending(mapped_file, pos) && pos < length) {
-          const HypernodeID source = current_range_vertex_id + current_range_num_vertices;
-          const HypernodeID target = read_number(mapped_file, pos, length);
-          ASSERT(source != target);
-          if ( source < target ) {
-            ++vertex_degree;
-          }
-          if ( has_edge_weights ) {
-            read_number(mapped_file, pos, length);
-          }
-        }
-        do_line_ending(mapped_file, pos);
-        current_range_num_edges += vertex_degree;
+      // Determine ranges in the input file that are read in parallel. Each range
+      // corresponds to a chunk of lines in the input file, where each line represents
+      // a vertex. Additionally, we need to sum the vertex degrees to determine edge indices.
+      vec<size_t> boundaries;
+      vec<size_t> first_line;
+      // Isolated vertices at the end of a Metis file may have no adjacency line at all
+      computeLineChunks(mapped_file, pos, length, num_vertices, true, boundaries, first_line);
+      const size_t num_chunks = boundaries.size() - 1;
+      vec<HyperedgeID> num_edges_in_chunk(num_chunks, 0);
+      tbb::parallel_for(UL(0), num_chunks, [&](const size_t i) {
+        HypernodeID current_vertex_id = first_line[i];
+        size_t num_lines = 0;
+        scanLines(mapped_file, boundaries[i], boundaries[i + 1],
+          std::numeric_limits<size_t>::max(), num_lines, [&](size_t& current_pos) {
+            ASSERT(mapped_file[current_pos - 1] == '\n');
+            ++current_vertex_id;
+
+            // Count the forward edges, ignore backward edges.
+            // This is necessary because we can only calculate unique edge ids
+            // efficiently if the edges are deduplicated.
+            if ( has_vertex_weights ) {
+              read_number(mapped_file, current_pos, length);
+            }
+            HyperedgeID vertex_degree = 0;
+            while (!is_line_ending(mapped_file, current_pos) && current_pos < length) {
+              const HypernodeID source = current_vertex_id;
+              const HypernodeID target = read_number(mapped_file, current_pos, length);
+              ASSERT(source != target);
+              if ( source < target ) {
+                ++vertex_degree;
+              }
+              if ( has_edge_weights ) {
+                read_number(mapped_file, current_pos, length);
+              }
+            }
+            do_line_ending(mapped_file, current_pos);
+            num_edges_in_chunk[i] += vertex_degree;
+          });
+      });
 
-        // If there are enough vertices in the current scanned range
-        // we store that range, which will be processed in parallel later
-        if ( current_range_num_vertices == num_vertices_per_range ) {
+      HyperedgeID current_range_edge_id = 0;
+      for ( size_t i = 0; i < num_chunks; ++i ) {
+        const HypernodeID num_vertices_in_range = first_line[i + 1] - first_line[i];
+        if ( num_vertices_in_range > 0 ) {
           vertex_ranges.push_back(VertexRange {
-                  current_range_start, pos, current_range_vertex_id, current_range_num_vertices, current_range_edge_id});
-          current_range_start = pos;
-          current_range_vertex_id += current_range_num_vertices;
-          current_range_num_vertices = 0;
-          current_range_edge_id += current_range_num_edges;
-          current_range_num_edges = 0;
+            boundaries[i], boundaries[i + 1], ID(first_line[i]), num_vertices_in_range, current_range_edge_id });
         }
+        current_range_edge_id += num_edges_in_chunk[i];
       }
-      if ( current_range_num_vertices > 0 ) {
-        vertex_ranges.push_back(VertexRange {
-                current_range_start, pos, current_range_vertex_id, current_range_num_vertices, current_range_edge_id});
-        current_range_vertex_id += current_range_num_vertices;
-        current_range_edge_id += current_range_num_edges;
-      }
-      ASSERT(current_range_vertex_id == num_vertices);
+      ASSERT(first_line.back() == num_vertices);
       ASSERT(current_range_edge_id == num_edges);
     }, [&] {
-      edges.resize(num_edges);
+      // Each edge consists of exactly two pins
+      edges.offsets.resize(num_edges + 1);
+      tbb::parallel_for(UL(0), edges.offsets.size(), [&](const size_t e) {
+        edges.offsets[e] = 2 * e;
+      });
+      edges.pins.resizeNoAssign(2 * num_edges);
     }, [&] {
       if ( has_edge_weights ) {
         edges_weight.resize(num_edges);
@@ -587,10 +745,18 @@ namespace mt_kahypar::io {
 
       while ( current_vertex_id < last_vertex_id ) {
         // Skip Comments
-        ASSERT(current_pos < current_end);
-        while ( mapped_file[pos] == '%' ) {
+        while ( current_pos < current_end && mapped_file[current_pos] == '%' ) {
           goto_next_line(mapped_file, current_pos, current_end);
-          ASSERT(current_pos < current_end);
+        }
+
+        if ( current_pos >= current_end ) {
+          // Missing trailing line, the vertex is isolated
+          if ( has_vertex_weights ) {
+            ASSERT(current_vertex_id < vertices_weight.size());
+            vertices_weight[current_vertex_id] = 1;
+          }
+          ++current_vertex_id;
+          continue;
         }
 
         if ( has_vertex_weights ) {
@@ -604,11 +770,9 @@ namespace mt_kahypar::io {
 
           // process forward edges, ignore backward edges
           if ( current_vertex_id < (target - 1) ) {
-            ASSERT(current_edge_id < edges.size());
-            // At this point, some magic is involved:
-            // In case of the graph partitioner, the right handed expression is considered a pair.
-            // In case of the hypergraph partitioner, the right handed expression is considered  a vector.
-            edges[current_edge_id] = {current_vertex_id, target - 1};
+            ASSERT(current_edge_id < num_edges);
+            edges.pins[2 * current_edge_id] = current_vertex_id;
+            edges.pins[2 * current_edge_id + 1] = target - 1;
 
             if ( has_edge_weights ) {
               edges_weight[current_edge_id] = read_number(mapped_file, current_pos, current_end);
@@ -627,7 +791,7 @@ namespace mt_kahypar::io {
   void readGraphFile(const std::string& filename,
                      HyperedgeID& num_edges,
                      HypernodeID& num_vertices,
-                     HyperedgeVector& edges,
+                     HyperedgeCSR& edges,
                      vec<HyperedgeWeight>& edges_weight,
                      vec<HypernodeWeight>& vertices_weight) {
     ASSERT(!filename.empty(), "No filename for metis file specified");
@@ -648,6 +812,114 @@ namespace mt_kahypar::io {
     munmap_file(handle);
   }
 
+  void readGraphFile(const std::string& filename,
+                     HyperedgeID& num_edges,
+                     HypernodeID& num_vertices,
+                     HyperedgeVector& edges,
+                     vec<HyperedgeWeight>& edges_weight,
+                     vec<HypernodeWeight>& vertices_weight) {
+    HyperedgeCSR csr;
+    readGraphFile(filename, num_edges, num_vertices, csr, edges_weight, vertices_weight);
+    edges = toHyperedgeVector(csr);
+  }
+
+  InputSize readInputSize(const std::string& filename, const bool is_graph) {
+    ASSERT(!filename.empty(), "No filename for input file specified");
+    FileHandle handle = mmap_file(filename);
+    size_t pos = 0;
+
+    // Skip comments
+    while ( handle.mapped_file[pos] == '%' ) {
+      goto_next_line(handle.mapped_file, pos, handle.length);
+    }
+    // The header is read with 64-bit integers such that large numbers are not truncated
+    InputSize size;
+    const uint64_t first = read_number(handle.mapped_file, pos, handle.length);
+    const uint64_t second = read_number(handle.mapped_file, pos, handle.length);
+    goto_next_line(handle.mapped_file, pos, handle.length);
+
+    if ( is_graph ) {
+      // Each undirected edge is represented by two directed edges resp. pins
+      size.num_hypernodes = first;
+      size.num_hyperedges = 2 * second;
+      size.num_pins = 2 * second;
+    } else {
+      size.num_hyperedges = first;
+      size.num_hypernodes = second;
+      // Each pin requires at least one digit and one separator
+      size.num_pins = ( handle.length - pos + 1 ) / 2;
+      if ( size.num_pins >= std::numeric_limits<uint32_t>::max() ) {
+        // The bound based on the file size is not sufficient => count the numbers in the file
+        // (includes weights, which is still an upper bound for the number of pins)
+        const vec<size_t> boundaries = computeChunkBoundaries(handle.mapped_file, pos, handle.length);
+        vec<uint64_t> num_numbers(boundaries.size() - 1, 0);
+        tbb::parallel_for(UL(0), num_numbers.size(), [&](const size_t i) {
+          for ( size_t j = boundaries[i]; j < boundaries[i + 1]; ++j ) {
+            const char c = handle.mapped_file[j];
+            const char prev = handle.mapped_file[j - 1];
+            num_numbers[i] += ( c >= '0' && c <= '9' ) && !( prev >= '0' && prev <= '9' );
+          }
+        });
+        size.num_pins = std::accumulate(num_numbers.begin(), num_numbers.end(), UI64(0));
+      }
+    }
+
+    munmap_file(handle);
+    return size;
+  }
+
+  HyperedgeVector toHyperedgeVector(const HyperedgeCSR& hyperedges) {
+    HyperedgeVector edge_vector;
+    if ( !hyperedges.offsets.empty() ) {
+      edge_vector.resize(hyperedges.offsets.size() - 1);
+      tbb::parallel_for(UL(0), edge_vector.size(), [&](const size_t he) {
+        edge_vector[he].reserve(hyperedges.offsets[he + 1] - hyperedges.offsets[he]);
+        for ( size_t j = hyperedges.offsets[he]; j < hyperedges.offsets[he + 1]; ++j ) {
+          edge_vector[he].push_back(hyperedges.pins[j]);
+        }
+      });
+    }
+    return edge_vector;
+  }
+
+  ds::binary::MappedFile mmapBinaryFile(const std::string& filename) {
+    ASSERT(!filename.empty(), "No filename for binary file specified");
+    if ( file_size(filename) < sizeof(ds::binary::Header) ) {
+      throw InvalidInputException("File is not a binary hypergraph file: " + filename);
+    }
+    FileHandle handle = mmap_file(filename, true);
+    ds::binary::MappedFile file;
+    file.header = reinterpret_cast<const ds::binary::Header*>(handle.mapped_file);
+    file.data = handle.mapped_file;
+    file.length = handle.length;
+    file.owner = std::shared_ptr<void>(handle.mapped_file, [handle](void*) mutable {
+      munmap_file(handle);
+    });
+
+    if ( file.header->magic_number != ds::binary::MAGIC_NUMBER ) {
+      throw InvalidInputException("File is not a binary hypergraph file: " + filename);
+    }
+    if ( file.header->version != ds::binary::VERSION ) {
+      throw InvalidInputException("Binary file " + filename + " has version " +
+        std::to_string(file.header->version) + ", but version " +
+        std::to_string(ds::binary::VERSION) + " is expected");
+    }
+    return file;
+  }
+
+  template<typename Hypergraph>
+  void writeBinaryFile(const Hypergraph& hypergraph, const std::string& filename) {
+    std::ofstream out(filename, std::ios::binary);
+    if ( !out ) {
+      throw InvalidInputException("Could not open: " + filename);
+    }
+    Hypergraph::Factory::writeBinary(hypergraph, out);
+    out.close();
+  }
+
+  template void writeBinaryFile(const ds::StaticHypergraph& hypergraph, const std::string& filename);
+  template void writeBinaryFile(const ds::StaticGraph& hypergraph, const std::string& filename);
+
   void readPartitionFile(const std::string& filename, std::vector<PartitionID>& partition) {
     ASSERT(!filename.empty(), "No filename for partition file specified");
     ASSERT(partition.empty(), "Partition vector is not empty");
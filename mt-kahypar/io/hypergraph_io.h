@@ -29,7 +29,9 @@
 
 #include <string>
 
+#include "mt-kahypar/datastructures/array.h"
 #include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/binary_format.h"
 #include "mt-kahypar/parallel/stl/scalable_vector.h"
 
 namespace mt_kahypar {
@@ -37,6 +39,24 @@ namespace io {
   using Hyperedge = vec<HypernodeID>;
   using HyperedgeVector = vec<Hyperedge>;
 
+  // ! Hyperedges in compressed sparse row format, i.e., the pins of hyperedge e
+  // ! are stored in pins[offsets[e], offsets[e + 1]).
+  struct HyperedgeCSR {
+    vec<size_t> offsets;
+    ds::Array<HypernodeID> pins;
+  };
+
+  // ! Reads the hyperedges directly into a CSR representation, which can be passed
+  // ! to the static data structures without copying it (see constructFromCSR(...)).
+  void readHypergraphFile(const std::string& filename,
+                          HyperedgeID& num_hyperedges,
+                          HypernodeID& num_hypernodes,
+                          HyperedgeID& num_removed_single_pin_hyperedges,
+                          HyperedgeCSR& hyperedges,
+                          vec<HyperedgeWeight>& hyperedges_weight,
+                          vec<HypernodeWeight>& hypernodes_weight,
+                          const bool remove_single_pin_hes = true);
+
   void readHypergraphFile(const std::string& filename,
                           HyperedgeID& num_hyperedges,
                           HypernodeID& num_hypernodes,
@@ -46,6 +66,13 @@ namespace io {
                           vec<HypernodeWeight>& hypernodes_weight,
                           const bool remove_single_pin_hes = true);
 
+  void readGraphFile(const std::string& filename,
+                     HyperedgeID& num_hyperedges,
+                     HypernodeID& num_hypernodes,
+                     HyperedgeCSR& hyperedges,
+                     vec<HyperedgeWeight>& hyperedges_weight,
+                     vec<HypernodeWeight>& hypernodes_weight);
+
   void readGraphFile(const std::string& filename,
                      HyperedgeID& num_hyperedges,
                      HypernodeID& num_hypernodes,
@@ -53,6 +80,27 @@ namespace io {
                      vec<HyperedgeWeight>& hyperedges_weight,
                      vec<HypernodeWeight>& hypernodes_weight);
 
+  // ! Upper bounds for the number of vertices, hyperedges and pins of an input file
+  struct InputSize {
+    uint64_t num_hypernodes;
+    uint64_t num_hyperedges;
+    uint64_t num_pins;
+  };
+
+  // ! Reads the size of a file in hMetis (or Metis, if is_graph is set) format. Apart from
+  // ! the header, the file is only scanned if its size does not bound the number of pins.
+  InputSize readInputSize(const std::string& filename, const bool is_graph);
+
+  // ! Converts hyperedges in CSR format into a vector of hyperedges
+  HyperedgeVector toHyperedgeVector(const HyperedgeCSR& hyperedges);
+
+  // ! Maps a binary hypergraph file copy-on-write into memory and verifies its header.
+  // ! The file is unmapped once the last owner of the returned handle is destroyed.
+  ds::binary::MappedFile mmapBinaryFile(const std::string& filename);
+
+  template<typename Hypergraph>
+  void writeBinaryFile(const Hypergraph& hypergraph, const std::string& filename);
+
   void readPartitionFile(const std::string& filename, std::vector<PartitionID>& partition);
   void readPartitionFile(const std::string& filename, PartitionID* partition);
 
@@ -0,0 +1,282 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "json_output.h"
+
+#include <sstream>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/memory_pool.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/utils/json_writer.h"
+#include "mt-kahypar/utils/memory_sampler.h"
+#include "mt-kahypar/utils/memory_tree.h"
+#include "mt-kahypar/utils/utilities.h"
+
+namespace mt_kahypar::io::json {
+
+namespace {
+  std::string basename(const std::string& filename) {
+    return filename.substr(filename.find_last_of('/') + 1);
+  }
+
+  void serializeContext(utils::JSONWriter& json, const Context& context) {
+    json.beginObject();
+
+    json.key("partition").beginObject();
+    json.field("mode", context.partition.mode);
+    json.field("objective", context.partition.objective);
+    json.field("gain_policy", context.partition.gain_policy);
+    json.field("file_format", context.partition.file_format);
+    json.field("instance_type", context.partition.instance_type);
+    json.field("preset_type", context.partition.preset_type);
+    json.field("preset_file", context.partition.preset_file);
+    json.field("k", context.partition.k);
+    json.field("epsilon", context.partition.epsilon);
+    json.field("seed", context.partition.seed);
+    json.field("num_vcycles", context.partition.num_vcycles);
+    json.field("deterministic", context.partition.deterministic);
+    json.field("time_limit", context.partition.time_limit);
+    json.field("max_memory", context.partition.max_memory);
+    json.field("use_individual_part_weights", context.partition.use_individual_part_weights);
+    json.key("max_part_weights").beginArray();
+    for ( const HypernodeWeight& weight : context.partition.max_part_weights ) {
+      json.value(weight);
+    }
+    json.endArray();
+    json.field("large_hyperedge_size_threshold", context.partition.large_hyperedge_size_threshold);
+    json.field("ignore_hyperedge_size_threshold", context.partition.ignore_hyperedge_size_threshold);
+    json.field("perform_parallel_recursion_in_deep_multilevel",
+      context.partition.perform_parallel_recursion_in_deep_multilevel);
+    json.endObject();
+
+    json.key("preprocessing").beginObject();
+    json.field("use_community_detection", context.preprocessing.use_community_detection);
+    json.field("disable_community_detection_for_mesh_graphs",
+      context.preprocessing.disable_community_detection_for_mesh_graphs);
+    json.field("relabeling", context.preprocessing.relabeling);
+    json.field("compress_incidence_arrays", context.preprocessing.compress_incidence_arrays);
+    json.field("use_identical_vertex_reduction", context.preprocessing.use_identical_vertex_reduction);
+    json.key("community_detection").beginObject();
+    json.field("edge_weight_function", context.preprocessing.community_detection.edge_weight_function);
+    json.field("max_pass_iterations", context.preprocessing.community_detection.max_pass_iterations);
+    json.field("min_vertex_move_fraction", context.preprocessing.community_detection.min_vertex_move_fraction);
+    json.field("vertex_degree_sampling_threshold",
+      context.preprocessing.community_detection.vertex_degree_sampling_threshold);
+    json.field("low_memory_contraction", context.preprocessing.community_detection.low_memory_contraction);
+    json.field("adaptive_skipping", context.preprocessing.community_detection.adaptive_skipping);
+    json.field("min_clustering_coefficient", context.preprocessing.community_detection.min_clustering_coefficient);
+    json.field("min_modularity_gain", context.preprocessing.community_detection.min_modularity_gain);
+    json.field("min_modularity_gain_for_contraction",
+      context.preprocessing.community_detection.min_modularity_gain_for_contraction);
+    json.endObject();
+    json.endObject();
+
+    json.key("coarsening").beginObject();
+    json.field("algorithm", context.coarsening.algorithm);
+    json.field("rating_function", context.coarsening.rating.rating_function);
+    json.field("heavy_node_penalty_policy", context.coarsening.rating.heavy_node_penalty_policy);
+    json.field("acceptance_policy", context.coarsening.rating.acceptance_policy);
+    json.field("vectorization_threshold", context.coarsening.rating.vectorization_threshold);
+    json.field("contraction_limit_multiplier", context.coarsening.contraction_limit_multiplier);
+    json.field("deep_ml_contraction_limit_multiplier", context.coarsening.deep_ml_contraction_limit_multiplier);
+    json.field("contraction_limit", context.coarsening.contraction_limit);
+    json.field("max_allowed_weight_multiplier", context.coarsening.max_allowed_weight_multiplier);
+    json.field("max_allowed_node_weight", context.coarsening.max_allowed_node_weight);
+    json.field("minimum_shrink_factor", context.coarsening.minimum_shrink_factor);
+    json.field("maximum_shrink_factor", context.coarsening.maximum_shrink_factor);
+    json.field("vertex_degree_sampling_threshold", context.coarsening.vertex_degree_sampling_threshold);
+    json.field("use_two_hop_clustering", context.coarsening.use_two_hop_clustering);
+    json.field("two_hop_degree_threshold", context.coarsening.two_hop_degree_threshold);
+    json.field("use_adaptive_edge_size", context.coarsening.use_adaptive_edge_size);
+    json.field("spill_fine_levels", context.coarsening.spill_fine_levels);
+    json.endObject();
+
+    json.key("initial_partitioning").beginObject();
+    json.field("mode", context.initial_partitioning.mode);
+    json.field("runs", context.initial_partitioning.runs);
+    json.field("use_adaptive_ip_runs", context.initial_partitioning.use_adaptive_ip_runs);
+    json.field("min_adaptive_ip_runs", context.initial_partitioning.min_adaptive_ip_runs);
+    json.field("perform_refinement_on_best_partitions",
+      context.initial_partitioning.perform_refinement_on_best_partitions);
+    json.field("fm_refinment_rounds", context.initial_partitioning.fm_refinment_rounds);
+    json.field("remove_degree_zero_hns_before_ip", context.initial_partitioning.remove_degree_zero_hns_before_ip);
+    json.field("population_size", context.initial_partitioning.population_size);
+    json.endObject();
+
+    json.key("refinement").beginObject();
+    json.field("rebalancer", context.refinement.rebalancer);
+    json.field("refine_until_no_improvement", context.refinement.refine_until_no_improvement);
+    json.field("relative_improvement_threshold", context.refinement.relative_improvement_threshold);
+    json.field("max_batch_size", context.refinement.max_batch_size);
+    json.key("label_propagation").beginObject();
+    json.field("algorithm", context.refinement.label_propagation.algorithm);
+    json.field("maximum_iterations", context.refinement.label_propagation.maximum_iterations);
+    json.field("rebalancing", context.refinement.label_propagation.rebalancing);
+    json.field("hyperedge_size_activation_threshold",
+      context.refinement.label_propagation.hyperedge_size_activation_threshold);
+    json.endObject();
+    json.key("fm").beginObject();
+    json.field("algorithm", context.refinement.fm.algorithm);
+    json.field("multitry_rounds", context.refinement.fm.multitry_rounds);
+    json.field("num_seed_nodes", context.refinement.fm.num_seed_nodes);
+    json.field("pq_type", context.refinement.fm.pq_type);
+    json.field("rollback_parallel", context.refinement.fm.rollback_parallel);
+    json.field("rollback_balance_violation_factor", context.refinement.fm.rollback_balance_violation_factor);
+    json.field("min_improvement", context.refinement.fm.min_improvement);
+    json.field("release_nodes", context.refinement.fm.release_nodes);
+    json.field("time_limit_factor", context.refinement.fm.time_limit_factor);
+    json.field("unconstrained_rounds", context.refinement.fm.unconstrained_rounds);
+    json.endObject();
+    json.key("global_fm").beginObject();
+    json.field("use_global_fm", context.refinement.global_fm.use_global_fm);
+    json.field("refine_until_no_improvement", context.refinement.global_fm.refine_until_no_improvement);
+    json.field("num_seed_nodes", context.refinement.global_fm.num_seed_nodes);
+    json.endObject();
+    json.key("flows").beginObject();
+    json.field("algorithm", context.refinement.flows.algorithm);
+    json.field("alpha", context.refinement.flows.alpha);
+    json.field("max_num_pins", context.refinement.flows.max_num_pins);
+    json.field("num_parallel_searches", context.refinement.flows.num_parallel_searches);
+    json.field("max_bfs_distance", context.refinement.flows.max_bfs_distance);
+    json.field("min_relative_improvement_per_round", context.refinement.flows.min_relative_improvement_per_round);
+    json.field("time_limit_factor", context.refinement.flows.time_limit_factor);
+    json.endObject();
+    json.endObject();
+
+    if ( context.partition.objective == Objective::steiner_tree ) {
+      json.key("mapping").beginObject();
+      json.field("target_graph_file", basename(context.mapping.target_graph_file));
+      json.field("strategy", context.mapping.strategy);
+      json.field("use_local_search", context.mapping.use_local_search);
+      json.field("use_two_phase_approach", context.mapping.use_two_phase_approach);
+      json.field("max_steiner_tree_size", context.mapping.max_steiner_tree_size);
+      json.endObject();
+    }
+
+    json.key("shared_memory").beginObject();
+    json.field("num_threads", context.shared_memory.num_threads);
+    json.field("static_balancing_work_packages", context.shared_memory.static_balancing_work_packages);
+    json.field("use_localized_random_shuffle", context.shared_memory.use_localized_random_shuffle);
+    json.field("shuffle_block_size", context.shared_memory.shuffle_block_size);
+    json.endObject();
+
+    json.endObject();
+  }
+}  // namespace
+
+template<typename PartitionedHypergraph>
+std::string serialize(const PartitionedHypergraph& phg,
+                      const Context& context,
+                      const std::chrono::duration<double>& elapsed_seconds) {
+  std::stringstream oss;
+  utils::JSONWriter json(oss);
+  utils::Utilities& utils = utils::Utilities::instance();
+
+  json.beginObject();
+  json.field("algorithm", context.algorithm_name);
+  json.field("graph", basename(context.partition.graph_filename));
+  json.field("partition_type", context.partition.partition_type);
+  json.field("num_nodes", phg.initialNumNodes());
+  json.field("num_edges", PartitionedHypergraph::is_graph ? phg.initialNumEdges() / 2 : phg.initialNumEdges());
+  json.field("num_pins", phg.initialNumPins());
+  json.field("total_weight", phg.totalWeight());
+  json.field("k", phg.k());
+  json.field("epsilon", context.partition.epsilon);
+  json.field("seed", context.partition.seed);
+  json.field("num_threads", context.shared_memory.num_threads);
+  json.field("total_partition_time", elapsed_seconds.count());
+
+  // Metrics
+  json.key("metrics").beginObject();
+  json.field("objective", context.partition.objective);
+  if ( phg.initialNumEdges() > 0 ) {
+    json.field("quality", metrics::quality(phg, context));
+    if ( context.partition.objective == Objective::steiner_tree ) {
+      json.field("approximation_factor", metrics::approximationFactorForProcessMapping(phg, context));
+    }
+    json.field("cut", metrics::quality(phg, Objective::cut));
+    json.field("km1", metrics::quality(phg, Objective::km1));
+    json.field("soed", metrics::quality(phg, Objective::soed));
+  }
+  json.field("imbalance", metrics::imbalance(phg, context));
+  if ( context.initial_km1 != std::numeric_limits<size_t>::max() ) {
+    json.field("initial_quality", context.initial_km1);
+  }
+  json.key("part_weights").beginArray();
+  for ( PartitionID block = 0; block < phg.k(); ++block ) {
+    json.value(phg.partWeight(block));
+  }
+  json.endArray();
+  json.endObject();
+
+  // Timings
+  json.key("timings");
+  utils.getTimer(context.utility_id).serializeJSON(json);
+
+  // Per-level statistics of the multilevel hierarchy and objective deltas of each phase
+  utils.getPerformanceLog(context.utility_id).serializeJSON(json);
+
+  // Stats
+  json.key("stats");
+  utils.getStats(context.utility_id).serializeJSON(json);
+
+  // Memory Consumption
+  json.key("memory").beginObject();
+  utils::MemoryTreeNode phg_memory_consumption("Partitioned Hypergraph", utils::OutputType::BYTES);
+  phg.memoryConsumption(&phg_memory_consumption);
+  phg_memory_consumption.finalize();
+  json.key("partitioned_hypergraph");
+  phg_memory_consumption.serializeJSON(json);
+  utils::MemoryTreeNode memory_pool_consumption("Memory Pool", utils::OutputType::BYTES);
+  parallel::MemoryPool::instance().memory_consumption(&memory_pool_consumption);
+  memory_pool_consumption.finalize();
+  json.key("memory_pool");
+  memory_pool_consumption.serializeJSON(json);
+  if ( context.partition.measure_peak_memory ) {
+    const utils::PeakMemory peak_memory = utils::MemorySampler::instance().processPeak();
+    json.field("peak_rss_bytes", peak_memory.rss);
+    json.field("peak_tracked_bytes", peak_memory.tracked);
+  }
+  json.endObject();
+
+  // Context
+  json.key("context");
+  serializeContext(json, context);
+
+  json.endObject();
+  return oss.str();
+}
+
+namespace {
+#define SERIALIZE(X) std::string serialize(const X& phg,                                         \
+                                           const Context& context,                               \
+                                           const std::chrono::duration<double>& elapsed_seconds)
+} // namespace
+
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SERIALIZE)
+
+}  // namespace mt_kahypar::io::json
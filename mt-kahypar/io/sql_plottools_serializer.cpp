@@ -69,17 +69,25 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " large_hyperedge_size_threshold=" << context.partition.large_hyperedge_size_threshold
         << " ignore_hyperedge_size_threshold=" << context.partition.ignore_hyperedge_size_threshold
         << " time_limit=" << context.partition.time_limit
+        << " max_memory=" << context.partition.max_memory
         << " use_individual_part_weights=" << context.partition.use_individual_part_weights
         << " perfect_balance_part_weight=" << context.partition.perfect_balance_part_weights[0]
         << " max_part_weight=" << context.partition.max_part_weights[0]
         << " total_graph_weight=" << hypergraph.totalWeight();
     oss << " use_community_detection=" << std::boolalpha << context.preprocessing.use_community_detection
+        << " relabeling=" << context.preprocessing.relabeling
+        << " compress_incidence_arrays=" << std::boolalpha << context.preprocessing.compress_incidence_arrays
+        << " use_identical_vertex_reduction=" << std::boolalpha << context.preprocessing.use_identical_vertex_reduction
         << " disable_community_detection_for_mesh_graphs=" << std::boolalpha << context.preprocessing.disable_community_detection_for_mesh_graphs
         << " community_edge_weight_function=" << context.preprocessing.community_detection.edge_weight_function
         << " community_max_pass_iterations=" << context.preprocessing.community_detection.max_pass_iterations
         << " community_min_vertex_move_fraction=" << context.preprocessing.community_detection.min_vertex_move_fraction
         << " community_vertex_degree_sampling_threshold=" << context.preprocessing.community_detection.vertex_degree_sampling_threshold
         << " community_num_sub_rounds_deterministic=" << context.preprocessing.community_detection.num_sub_rounds_deterministic
+        << " community_adaptive_skipping=" << std::boolalpha << context.preprocessing.community_detection.adaptive_skipping
+        << " community_min_clustering_coefficient=" << context.preprocessing.community_detection.min_clustering_coefficient
+        << " community_min_modularity_gain=" << context.preprocessing.community_detection.min_modularity_gain
+        << " community_min_modularity_gain_for_contraction=" << context.preprocessing.community_detection.min_modularity_gain_for_contraction
         << " community_low_memory_contraction=" << context.preprocessing.community_detection.low_memory_contraction;
     oss << " coarsening_algorithm=" << context.coarsening.algorithm
         << " coarsening_contraction_limit_multiplier=" << context.coarsening.contraction_limit_multiplier
@@ -91,10 +99,14 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " coarsening_max_allowed_node_weight=" << context.coarsening.max_allowed_node_weight
         << " coarsening_vertex_degree_sampling_threshold=" << context.coarsening.vertex_degree_sampling_threshold
         << " coarsening_num_sub_rounds_deterministic=" << context.coarsening.num_sub_rounds_deterministic
+        << " coarsening_use_two_hop_clustering=" << std::boolalpha << context.coarsening.use_two_hop_clustering
+        << " coarsening_two_hop_degree_threshold=" << context.coarsening.two_hop_degree_threshold
         << " coarsening_contraction_limit=" << context.coarsening.contraction_limit
+        << " coarsening_spill_fine_levels=" << std::boolalpha << context.coarsening.spill_fine_levels
         << " rating_function=" << context.coarsening.rating.rating_function
         << " rating_heavy_node_penalty_policy=" << context.coarsening.rating.heavy_node_penalty_policy
-        << " rating_acceptance_policy=" << context.coarsening.rating.acceptance_policy;
+        << " rating_acceptance_policy=" << context.coarsening.rating.acceptance_policy
+        << " rating_vectorization_threshold=" << context.coarsening.rating.vectorization_threshold;
     oss << " initial_partitioning_mode=" << context.initial_partitioning.mode
         << " initial_partitioning_runs=" << context.initial_partitioning.runs
         << " initial_partitioning_use_adaptive_ip_runs=" << std::boolalpha << context.initial_partitioning.use_adaptive_ip_runs
@@ -126,6 +138,8 @@ std::string serialize(const PartitionedHypergraph& hypergraph,
         << " fm_min_improvement=" << context.refinement.fm.min_improvement
         << " fm_release_nodes=" << context.refinement.fm.release_nodes
         << " fm_iter_moves_on_recalc=" << context.refinement.fm.iter_moves_on_recalc
+        << " fm_pq_type=" << context.refinement.fm.pq_type
+        << " fm_bucket_queue_max_gain=" << context.refinement.fm.bucket_queue_max_gain
         << " fm_num_seed_nodes=" << context.refinement.fm.num_seed_nodes
         << " fm_time_limit_factor=" << context.refinement.fm.time_limit_factor
         << " fm_obey_minimal_parallelism=" << std::boolalpha << context.refinement.fm.obey_minimal_parallelism
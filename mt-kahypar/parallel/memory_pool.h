@@ -159,6 +159,9 @@ class MemoryPoolT {
     bool allocate() {
       if ( !_data && !_defer_allocation ) {
         _data = (char*) scalable_calloc(_num_elements, _size);
+        if ( _data && AllocationTracker::isEnabled() ) {
+          AllocationTracker::allocate(_data, scalable_msize(_data));
+        }
         return true;
       } else {
         return false;
@@ -168,6 +171,7 @@ class MemoryPoolT {
     // ! Frees the memory chunk
     void free() {
       if ( _data ) {
+        AllocationTracker::deallocate(_data);
         scalable_free(_data);
         _data = nullptr;
       }
@@ -31,12 +31,15 @@
 
 #include <tbb/scalable_allocator.h>
 
+#include "mt-kahypar/parallel/stl/tracked_scalable_allocator.h"
+
 namespace mt_kahypar {
 namespace parallel {
 
 template<typename T>
 struct tbb_deleter {
   void operator()(T *p) {
+    AllocationTracker::deallocate(p);
     scalable_free(p);
   }
 };
@@ -47,6 +50,9 @@ using tbb_unique_ptr = std::unique_ptr<T, tbb_deleter<T>>;
 template<typename T>
 static tbb_unique_ptr<T> make_unique(const size_t size) {
   T* ptr = (T*) scalable_malloc(sizeof(T) * size);
+  if ( ptr && AllocationTracker::isEnabled() ) {
+    AllocationTracker::allocate(ptr, scalable_msize(ptr));
+  }
   return tbb_unique_ptr<T>(ptr, parallel::tbb_deleter<T>());
 }
 
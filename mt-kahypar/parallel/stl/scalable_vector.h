@@ -34,15 +34,17 @@
 #include <tbb/scalable_allocator.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/stl/tracked_scalable_allocator.h"
 
 namespace mt_kahypar {
 
+// Allocations are reported to the parallel::AllocationTracker
 template<typename T>
-using vec = std::vector<T, tbb::scalable_allocator<T> >;  // shorter name
+using vec = std::vector<T, parallel::tracked_scalable_allocator<T> >;  // shorter name
 
 namespace parallel {
 template <typename T>
-using scalable_vector = std::vector<T, tbb::scalable_allocator<T> >;
+using scalable_vector = std::vector<T, tracked_scalable_allocator<T> >;
 
 template<typename T>
 static inline void free(scalable_vector<T>& vec) {
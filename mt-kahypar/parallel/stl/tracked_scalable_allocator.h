@@ -0,0 +1,174 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+#include <tbb/concurrent_hash_map.h>
+#include <tbb/scalable_allocator.h>
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+namespace parallel {
+
+/*!
+ * Tracks the number of bytes allocated by all tracked allocators (e.g.,
+ * parallel::scalable_vector) and the peak of this value. The peak can be
+ * reset to the current value, which allows to measure the high-water mark
+ * of a phase of the algorithm.
+ *
+ * Tracking is disabled by default such that allocations only pay for a
+ * relaxed load of the flag. Memory that is allocated before tracking is
+ * enabled is not reported. Therefore, we remember the addresses of all tracked
+ * allocations and ignore frees of memory that was allocated before (e.g., the
+ * input hypergraph if it is constructed before tracking starts). Otherwise, these
+ * frees would decrement the current value and bias the peak towards lower values.
+ */
+class AllocationTracker {
+
+  using TrackedAllocations = tbb::concurrent_hash_map<const void*, size_t>;
+
+ public:
+  // ! Enables tracking. Should be called before any parallel work starts, since
+  // ! the counters are reset and previously tracked allocations are forgotten.
+  static void enable() {
+    if ( !_is_enabled.load(std::memory_order_relaxed) ) {
+      trackedAllocations().clear();
+      _current.store(0, std::memory_order_relaxed);
+      _peak.store(0, std::memory_order_relaxed);
+      _is_enabled.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  static void disable() {
+    _is_enabled.store(false, std::memory_order_relaxed);
+  }
+
+  static bool isEnabled() {
+    return _is_enabled.load(std::memory_order_relaxed);
+  }
+
+  static void allocate(const void* ptr, const size_t bytes) {
+    if ( ptr && isEnabled() ) {
+      trackedAllocations().insert({ ptr, bytes });
+      const int64_t current = _current.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+      int64_t peak = _peak.load(std::memory_order_relaxed);
+      while ( current > peak && !_peak.compare_exchange_weak(peak, current, std::memory_order_relaxed) ) { }
+    }
+  }
+
+  static void deallocate(const void* ptr) {
+    if ( ptr && isEnabled() ) {
+      TrackedAllocations::accessor acc;
+      if ( trackedAllocations().find(acc, ptr) ) {
+        _current.fetch_sub(acc->second, std::memory_order_relaxed);
+        trackedAllocations().erase(acc);
+      }
+    }
+  }
+
+  // ! Number of bytes that are currently allocated
+  static size_t current() {
+    return std::max(_current.load(std::memory_order_relaxed), INT64_C(0));
+  }
+
+  // ! Maximum number of allocated bytes since the last reset
+  static size_t peak() {
+    return std::max(_peak.load(std::memory_order_relaxed), INT64_C(0));
+  }
+
+  // ! Resets the peak to the current value and returns the previous peak
+  static size_t resetPeak() {
+    return std::max(_peak.exchange(
+      _current.load(std::memory_order_relaxed), std::memory_order_relaxed), INT64_C(0));
+  }
+
+ private:
+  // ! Intentionally never destroyed, since static objects can release
+  // ! their memory after the tracked allocations are destructed
+  static TrackedAllocations& trackedAllocations() {
+    static TrackedAllocations* tracked_allocations = new TrackedAllocations();
+    return *tracked_allocations;
+  }
+
+  // Signed, since memory allocated before main (e.g., static objects) can be
+  // released in a different order than it is tracked
+  static inline std::atomic<bool> _is_enabled { false };
+  static inline std::atomic<int64_t> _current { 0 };
+  static inline std::atomic<int64_t> _peak { 0 };
+};
+
+/*!
+ * TBB scalable allocator that reports all allocations to the AllocationTracker.
+ */
+template<typename T>
+class tracked_scalable_allocator : public tbb::scalable_allocator<T> {
+
+  using Base = tbb::scalable_allocator<T>;
+
+ public:
+  using value_type = T;
+
+  template<typename U>
+  struct rebind {
+    using other = tracked_scalable_allocator<U>;
+  };
+
+  tracked_scalable_allocator() noexcept : Base() { }
+
+  tracked_scalable_allocator(const tracked_scalable_allocator& other) noexcept : Base(other) { }
+
+  template<typename U>
+  tracked_scalable_allocator(const tracked_scalable_allocator<U>&) noexcept : Base() { }
+
+  T* allocate(const size_t n) {
+    T* ptr = Base::allocate(n);
+    AllocationTracker::allocate(ptr, n * sizeof(T));
+    return ptr;
+  }
+
+  void deallocate(T* ptr, const size_t n) {
+    AllocationTracker::deallocate(ptr);
+    Base::deallocate(ptr, n);
+  }
+};
+
+template<typename T, typename U>
+bool operator== (const tracked_scalable_allocator<T>&, const tracked_scalable_allocator<U>&) {
+  return true;
+}
+
+template<typename T, typename U>
+bool operator!= (const tracked_scalable_allocator<T>&, const tracked_scalable_allocator<U>&) {
+  return false;
+}
+
+}  // namespace parallel
+}  // namespace mt_kahypar
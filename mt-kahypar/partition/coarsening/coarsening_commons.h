@@ -28,8 +28,18 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+#include "include/libmtkahypartypes.h"
+
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/exception.h"
 #include "mt-kahypar/definitions.h"
 
 namespace mt_kahypar {
@@ -38,14 +48,21 @@ template<typename TypeTraits>
 class Level {
 
   using Hypergraph = typename TypeTraits::Hypergraph;
+  using Factory = typename Hypergraph::Factory;
 
 public:
+  // ! The binary format is only implemented for static hypergraphs and graphs
+  static constexpr bool supports_spilling =
+    Hypergraph::TYPE == STATIC_HYPERGRAPH || Hypergraph::TYPE == STATIC_GRAPH;
+
   explicit Level(Hypergraph&& contracted_hypergraph,
                  parallel::scalable_vector<HypernodeID>&& communities,
                  double coarsening_time) :
     _contracted_hypergraph(std::move(contracted_hypergraph)),
     _communities(std::move(communities)),
-    _coarsening_time(coarsening_time) { }
+    _coarsening_time(coarsening_time),
+    _spill_file(),
+    _is_spilled(false) { }
 
   Hypergraph& contractedHypergraph() {
     return _contracted_hypergraph;
@@ -62,6 +79,10 @@ public:
     return _communities[hn];
   }
 
+  const parallel::scalable_vector<HypernodeID>& communities() const {
+    return _communities;
+  }
+
   double coarseningTime() const {
     return _coarsening_time;
   }
@@ -74,6 +95,48 @@ public:
     });
   }
 
+  bool isSpilled() const {
+    return _is_spilled;
+  }
+
+  const std::string& spillFile() const {
+    return _spill_file;
+  }
+
+  // ! Writes the contracted hypergraph to the given file (only once) and frees its memory.
+  // ! Note that the community IDs of the contracted hypergraph are not preserved.
+  void spill(const std::string& filename) {
+    ASSERT(!_is_spilled);
+    if constexpr ( supports_spilling ) {
+      if ( _spill_file.empty() ) {
+        std::ofstream out(filename, std::ios::binary);
+        if ( out ) {
+          Factory::writeBinary(_contracted_hypergraph, out);
+          out.close();
+        }
+        if ( !out ) {
+          std::remove(filename.c_str());
+          throw SystemException("Failed to spill level of the multilevel hierarchy to " + filename);
+        }
+        _spill_file = filename;
+      }
+      _contracted_hypergraph = Hypergraph();
+      _is_spilled = true;
+    } else {
+      unused(filename);
+    }
+  }
+
+  // ! Maps the contracted hypergraph of a spilled level back into memory
+  void reload() {
+    if constexpr ( supports_spilling ) {
+      if ( _is_spilled ) {
+        _contracted_hypergraph = Factory::constructFromBinary(io::mmapBinaryFile(_spill_file));
+        _is_spilled = false;
+      }
+    }
+  }
+
 private:
   // ! Contracted Hypergraph
   Hypergraph _contracted_hypergraph;
@@ -83,6 +146,9 @@ private:
   // ! Time to create the coarsened hypergraph
   // ! (includes coarsening + contraction time)
   double _coarsening_time;
+  // ! File to which the contracted hypergraph was spilled (empty, if never spilled)
+  std::string _spill_file;
+  bool _is_spilled;
 };
 
 template<typename TypeTraits>
@@ -97,7 +163,10 @@ public:
   explicit UncoarseningData(bool n_level, Hypergraph& hg, const Context& context) :
     nlevel(n_level),
     _hg(hg),
-    _context(context) {
+    _context(context),
+    _spill_fine_levels(!n_level && Level<TypeTraits>::supports_spilling &&
+      context.coarsening.spill_fine_levels && context.type == ContextType::main &&
+      !hg.hasFixedVertices()) {
       if (n_level) {
         compactified_hg = std::make_unique<Hypergraph>();
         compactified_phg = std::make_unique<PartitionedHypergraph>();
@@ -119,6 +188,11 @@ public:
     tbb::parallel_for(UL(0), hierarchy.size(), [&](const size_t i) {
       (hierarchy)[i].freeInternalData();
     }, tbb::static_partitioner());
+    for ( const Level<TypeTraits>& level : hierarchy ) {
+      if ( !level.spillFile().empty() ) {
+        std::remove(level.spillFile().c_str());
+      }
+    }
   }
 
   void setPartitionedHypergraph(PartitionedHypergraph&& phg) {
@@ -159,21 +233,74 @@ public:
         partitioned_hg->setHypergraph(hierarchy.back().contractedHypergraph());
       }
       is_phg_initialized = true;
+
+      if (_context.type == ContextType::main) {
+        utils::PerformanceLog& performance_log =
+          utils::Utilities::instance().getPerformanceLog(_context.utility_id);
+        for (size_t i = 0; i < hierarchy.size(); ++i) {
+          const Hypergraph& contracted_hg = hierarchy[i].contractedHypergraph();
+          performance_log.addCoarseningLevel(i + 1, contracted_hg.initialNumNodes(),
+            Hypergraph::is_graph ? contracted_hg.initialNumEdges() / 2 : contracted_hg.initialNumEdges(),
+            contracted_hg.initialNumPins(), hierarchy[i].coarseningTime());
+        }
+      }
       timer.stop_timer("finalize_multilevel_hierarchy");
     }
     is_finalized = true;
   }
 
+  // ! Constructs a new partitioned hypergraph with k blocks on the coarsest
+  // ! hypergraph of the multilevel hierarchy. This allows us to reuse the same
+  // ! hierarchy for initial partitioning and refinement with different values of k.
+  void resetPartitionedHypergraph(const PartitionID k) {
+    ASSERT(!nlevel && is_finalized);
+    *partitioned_hg = PartitionedHypergraph(k, _hg, parallel_tag_t());
+    if (!hierarchy.empty()) {
+      loadLevel(hierarchy.size() - 1);
+      partitioned_hg->setHypergraph(hierarchy.back().contractedHypergraph());
+    }
+  }
+
+  // ! Ensures that the contracted hypergraph of the level is in memory
+  void loadLevel(const size_t level) {
+    ASSERT(level < hierarchy.size());
+    if ( hierarchy[level].isSpilled() ) {
+      utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+      timer.start_timer("reload_level", "Reload Spilled Level");
+      hierarchy[level].reload();
+      timer.stop_timer("reload_level");
+    }
+  }
+
+  // ! Frees the contracted hypergraph of the level once it is no longer needed
+  // ! for uncoarsening, if the level was spilled to disk during coarsening
+  void releaseLevel(const size_t level) {
+    ASSERT(level < hierarchy.size());
+    if ( _spill_fine_levels && !hierarchy[level].isSpilled() &&
+         !hierarchy[level].spillFile().empty() ) {
+      hierarchy[level].spill(hierarchy[level].spillFile());
+    }
+  }
+
   void performMultilevelContraction(
           parallel::scalable_vector<HypernodeID>&& communities, bool deterministic,
           const HighResClockTimepoint& round_start) {
     ASSERT(!is_finalized);
     Hypergraph& current_hg = hierarchy.empty() ? _hg : hierarchy.back().contractedHypergraph();
     ASSERT(current_hg.initialNumNodes() == communities.size());
-    Hypergraph contracted_hg = current_hg.contract(communities, deterministic);
+    Hypergraph contracted_hg = contract(current_hg, communities, deterministic);
     const HighResClockTimepoint round_end = std::chrono::high_resolution_clock::now();
     const double elapsed_time = std::chrono::duration<double>(round_end - round_start).count();
     hierarchy.emplace_back(std::move(contracted_hg), std::move(communities), elapsed_time);
+
+    if ( _spill_fine_levels && hierarchy.size() > 1 ) {
+      // The finer level is not needed until uncoarsening reaches it
+      utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+      timer.start_timer("spill_level", "Spill Fine Level");
+      const size_t level = hierarchy.size() - 2;
+      hierarchy[level].spill(spillFilename(level));
+      timer.stop_timer("spill_level");
+    }
   }
 
   PartitionedHypergraph& coarsestPartitionedHypergraph() {
@@ -211,8 +338,30 @@ public:
   bool nlevel;
 
 private:
+  Hypergraph contract(Hypergraph& hypergraph,
+                      parallel::scalable_vector<HypernodeID>& communities,
+                      const bool deterministic) {
+    if constexpr ( Hypergraph::is_static_hypergraph && !Hypergraph::is_graph ) {
+      // The static hypergraph reports the time spent in identical net detection
+      utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+      return hypergraph.contract(communities, deterministic, &timer);
+    } else {
+      return hypergraph.contract(communities, deterministic);
+    }
+  }
+
+  std::string spillFilename(const size_t level) const {
+    // The address of this object distinguishes concurrent hierarchies of the same process
+    return (std::filesystem::temp_directory_path() / ("mt_kahypar_level_" +
+      std::to_string(std::chrono::high_resolution_clock::now().time_since_epoch().count()) + "_" +
+      std::to_string(reinterpret_cast<uintptr_t>(this)) + "_" + std::to_string(level) + ".bin")).string();
+  }
+
   Hypergraph& _hg;
   const Context& _context;
+  // ! Fine levels are written to disk once the next level is contracted
+  // ! and reloaded during uncoarsening (see MemoryBudget)
+  const bool _spill_fine_levels;
 };
 
 typedef struct uncoarsening_data_s uncoarsening_data_t;
@@ -0,0 +1,464 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include <tbb/parallel_reduce.h>
+
+#include "include/libmtkahypartypes.h"
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/datastructures/binary_format.h"
+#include "mt-kahypar/utils/hash.h"
+#include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/utilities.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar {
+
+/**
+ * Persists the community detection result and the multilevel hierarchy on disk, such that
+ * repeated runs on the same input (e.g., with different seeds or imbalance factors) can skip
+ * community detection and coarsening entirely.
+ *
+ * A cache file consists of a header, the cache key, the community IDs of the input hypergraph
+ * and for each level of the hierarchy the mapping to the coarse nodes, the community IDs of
+ * the coarse nodes and the contracted hypergraph in the binary format (see binary_format.h).
+ * The key contains a hash of the (preprocessed) input hypergraph and all parameters that
+ * influence community detection and coarsening. If it does not match, the cache is stale
+ * and is rebuilt. The seed is deliberately not part of the key.
+ * Each entry starts at a multiple of SECTION_ALIGNMENT. Thus, the contracted hypergraphs can
+ * adopt their arrays directly from the buffer into which the file is read.
+ */
+template<typename TypeTraits>
+class HierarchyCache {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using Factory = typename Hypergraph::Factory;
+
+  static constexpr uint64_t MAGIC_NUMBER = 0x43485948414B544DULL; // "MTKAHYHC"
+  static constexpr uint32_t VERSION = 1;
+  // ! The binary format is only implemented for static hypergraphs and graphs
+  static constexpr bool is_supported =
+    Hypergraph::TYPE == STATIC_HYPERGRAPH || Hypergraph::TYPE == STATIC_GRAPH;
+
+  struct Header {
+    uint64_t magic_number;
+    uint32_t version;
+    uint32_t hypergraph_type;
+    uint64_t input_hash;
+    uint64_t key_length;
+    uint64_t num_nodes;
+    uint64_t num_levels;
+  };
+
+  struct LevelHeader {
+    double coarsening_time;
+    // ! Number of nodes of the finer hypergraph
+    uint64_t num_nodes;
+    uint64_t num_coarse_nodes;
+    // ! Size of the contracted hypergraph in the binary format in bytes
+    uint64_t binary_size;
+  };
+
+ public:
+  explicit HierarchyCache(const Context& context) :
+    _context(context),
+    _input_hash(0),
+    _is_loaded(false),
+    _community_ids(),
+    _levels() { }
+
+  HierarchyCache(const HierarchyCache&) = delete;
+  HierarchyCache & operator= (const HierarchyCache &) = delete;
+
+  HierarchyCache(HierarchyCache&&) = delete;
+  HierarchyCache & operator= (HierarchyCache &&) = delete;
+
+  bool isApplicable(const Hypergraph& hypergraph) const {
+    return is_supported &&
+      !_context.partition.hierarchy_cache_file.empty() &&
+      _context.type == ContextType::main &&
+      _context.partition.mode == Mode::direct &&
+      !_context.isNLevelPartitioning() &&
+      !_context.coarsening.spill_fine_levels &&
+      !hypergraph.hasFixedVertices();
+  }
+
+  bool isLoaded() const {
+    return _is_loaded;
+  }
+
+  // ! Tries to load the cache for the given input hypergraph. Must be called before the
+  // ! hypergraph is sanitized. Returns false, if the cache file does not exist or is stale.
+  bool load(const Hypergraph& hypergraph) {
+    ASSERT(isApplicable(hypergraph));
+    utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+    timer.start_timer("load_hierarchy_cache", "Load Hierarchy Cache");
+    _input_hash = computeInputHash(hypergraph);
+    if constexpr ( is_supported ) {
+      try {
+        _is_loaded = read(hypergraph);
+      } catch ( const InvalidInputException& e ) {
+        // Contracted hypergraph was written by a build with a different layout
+        reject(e.what());
+        _is_loaded = false;
+      }
+      if ( !_is_loaded ) {
+        _community_ids.clear();
+        _levels.clear();
+      }
+    }
+    timer.stop_timer("load_hierarchy_cache");
+
+    if ( _is_loaded && _context.partition.verbose_output ) {
+      LOG << "Loaded community detection result and" << _levels.size()
+          << "levels of the multilevel hierarchy from" << _context.partition.hierarchy_cache_file;
+    }
+    return _is_loaded;
+  }
+
+  // ! Assigns the cached community IDs to the input hypergraph
+  void applyCommunities(Hypergraph& hypergraph) {
+    ASSERT(_is_loaded && _community_ids.size() == hypergraph.initialNumNodes());
+    hypergraph.setCommunityIDs(std::move(_community_ids));
+  }
+
+  // ! Moves the cached levels into the uncoarsening data and finalizes the hierarchy
+  void moveHierarchy(UncoarseningData<TypeTraits>& uncoarsening_data) {
+    ASSERT(_is_loaded && !uncoarsening_data.nlevel);
+    ASSERT(uncoarsening_data.hierarchy.empty());
+    for ( Level<TypeTraits>& level : _levels ) {
+      uncoarsening_data.hierarchy.emplace_back(std::move(level));
+    }
+    _levels.clear();
+    uncoarsening_data.finalizeCoarsening();
+  }
+
+  // ! Writes the community IDs of the input hypergraph and the multilevel hierarchy
+  // ! to the cache file. Failing to write the cache is not fatal.
+  void store(const Hypergraph& hypergraph,
+             const UncoarseningData<TypeTraits>& uncoarsening_data) const {
+    ASSERT(isApplicable(hypergraph) && !uncoarsening_data.nlevel);
+    if constexpr ( is_supported ) {
+      utils::Timer& timer = utils::Utilities::instance().getTimer(_context.utility_id);
+      timer.start_timer("store_hierarchy_cache", "Store Hierarchy Cache");
+      const std::string& filename = _context.partition.hierarchy_cache_file;
+      // We write to a temporary file first such that concurrent runs on the
+      // same cache file never read a partially written cache.
+      const std::string tmp_filename = filename + ".tmp" + std::to_string(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count());
+      std::ofstream out(tmp_filename, std::ios::binary);
+      bool success = static_cast<bool>(out);
+      if ( success ) {
+        try {
+          write(out, hypergraph, uncoarsening_data);
+        } catch ( const SystemException& ) {
+          success = false;
+        }
+        out.close();
+        success = success && !out.fail() &&
+          std::rename(tmp_filename.c_str(), filename.c_str()) == 0;
+      }
+      if ( !success ) {
+        std::remove(tmp_filename.c_str());
+        WARNING("Could not write hierarchy cache file" << filename);
+      } else if ( _context.partition.verbose_output ) {
+        LOG << "Stored community detection result and" << uncoarsening_data.hierarchy.size()
+            << "levels of the multilevel hierarchy in" << filename;
+      }
+      timer.stop_timer("store_hierarchy_cache");
+    } else {
+      unused(hypergraph);
+      unused(uncoarsening_data);
+    }
+  }
+
+ private:
+  // ! Hash of the node weights, edge weights and pins of all enabled nodes and edges
+  static uint64_t computeInputHash(const Hypergraph& hypergraph) {
+    using namespace hashing::integer;
+    const uint64_t node_hash = tbb::parallel_reduce(
+      tbb::blocked_range<HypernodeID>(ID(0), hypergraph.initialNumNodes()), UL(0),
+      [&](const tbb::blocked_range<HypernodeID>& range, uint64_t hash) {
+        for ( HypernodeID hn = range.begin(); hn < range.end(); ++hn ) {
+          if ( hypergraph.nodeIsEnabled(hn) ) {
+            hash += combine64(hash64(hn), hash64(hypergraph.nodeWeight(hn)));
+          }
+        }
+        return hash;
+      }, std::plus<>());
+    const uint64_t edge_hash = tbb::parallel_reduce(
+      tbb::blocked_range<HyperedgeID>(ID(0), hypergraph.initialNumEdges()), UL(0),
+      [&](const tbb::blocked_range<HyperedgeID>& range, uint64_t hash) {
+        for ( HyperedgeID he = range.begin(); he < range.end(); ++he ) {
+          if ( hypergraph.edgeIsEnabled(he) ) {
+            uint64_t edge_hash = combine64(hash64(he), hash64(hypergraph.edgeWeight(he)));
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              edge_hash = combine64(edge_hash, hash64(pin));
+            }
+            hash += edge_hash;
+          }
+        }
+        return hash;
+      }, std::plus<>());
+
+    uint64_t hash = combine64(hash64(hypergraph.initialNumNodes()), hash64(hypergraph.initialNumEdges()));
+    hash = combine64(hash, hash64(hypergraph.initialNumPins()));
+    hash = combine64(hash, node_hash);
+    return combine64(hash, edge_hash);
+  }
+
+  // ! All parameters that influence the result of community detection and coarsening
+  std::string cacheKey() const {
+    std::stringstream key;
+    key << _context.preprocessing << _context.coarsening
+        << "Deterministic: " << std::boolalpha << _context.partition.deterministic << std::endl
+        << "Ignore HE Size Threshold: " << _context.partition.ignore_hyperedge_size_threshold << std::endl
+        << "Large HE Size Threshold: " << _context.partition.large_hyperedge_size_threshold << std::endl;
+    return key.str();
+  }
+
+  void reject(const std::string& reason) const {
+    if ( _context.partition.verbose_output ) {
+      LOG << "Hierarchy cache file" << _context.partition.hierarchy_cache_file
+          << reason << "-> recompute community detection and multilevel hierarchy";
+    }
+  }
+
+  bool read(const Hypergraph& hypergraph) {
+    const std::string& filename = _context.partition.hierarchy_cache_file;
+    std::ifstream file(filename, std::ios::binary | std::ios::ate);
+    if ( !file ) {
+      reject("does not exist");
+      return false;
+    }
+    const size_t length = file.tellg();
+    file.seekg(0);
+    // The file is read into a buffer aligned to SECTION_ALIGNMENT such that the contracted
+    // hypergraphs can adopt their arrays. The buffer is freed once the last hypergraph
+    // that references it is destroyed.
+    char* data = static_cast<char*>(std::aligned_alloc(ds::binary::SECTION_ALIGNMENT,
+      ds::binary::alignSection(std::max(length, UL(1)))));
+    if ( !data ) {
+      throw SystemException("Failed to allocate memory for hierarchy cache file " + filename);
+    }
+    std::shared_ptr<void> owner(data, [](void* ptr) { std::free(ptr); });
+    if ( !file.read(data, length) ) {
+      reject("could not be read");
+      return false;
+    }
+
+    // Returns a pointer to the next entry consisting of num_elements elements of the given
+    // size, or nullptr if the entry does not fit into the file. All counts are read from the
+    // file, the checks are therefore formulated such that they cannot overflow.
+    size_t pos = 0;
+    auto next = [&](const uint64_t num_elements, const size_t element_size) -> char* {
+      ASSERT(element_size > 0);
+      pos = ds::binary::alignSection(std::min(pos, length));
+      if ( pos > length || num_elements > ( length - pos ) / element_size ) {
+        return nullptr;
+      }
+      char* entry = data + pos;
+      pos += num_elements * element_size;
+      return entry;
+    };
+
+    const Header* header = reinterpret_cast<const Header*>(next(1, sizeof(Header)));
+    if ( !header || header->magic_number != MAGIC_NUMBER || header->version != VERSION ) {
+      reject("is not a hierarchy cache file or has an unsupported version");
+      return false;
+    }
+    if ( header->hypergraph_type != static_cast<uint32_t>(Hypergraph::TYPE) ) {
+      reject("was computed for a different hypergraph type");
+      return false;
+    }
+    if ( header->input_hash != _input_hash || header->num_nodes != hypergraph.initialNumNodes() ) {
+      reject("was computed for a different input");
+      return false;
+    }
+    const std::string key = cacheKey();
+    const char* stored_key = next(header->key_length, sizeof(char));
+    if ( !stored_key || std::string(stored_key, header->key_length) != key ) {
+      reject("was computed with different preprocessing or coarsening parameters");
+      return false;
+    }
+
+    const HypernodeID num_input_nodes = hypergraph.initialNumNodes();
+    const char* community_ids = next(num_input_nodes, sizeof(PartitionID));
+    if ( !community_ids ) {
+      reject("is truncated");
+      return false;
+    }
+    // Each level occupies at least the size of its header
+    const uint64_t num_levels = header->num_levels;
+    if ( num_levels > length / sizeof(LevelHeader) ) {
+      reject("is truncated");
+      return false;
+    }
+    _community_ids.resize(num_input_nodes);
+    std::memcpy(_community_ids.data(), community_ids, num_input_nodes * sizeof(PartitionID));
+
+    HypernodeID num_nodes = num_input_nodes;
+    _levels.reserve(num_levels);
+    for ( size_t i = 0; i < num_levels; ++i ) {
+      const LevelHeader* level = reinterpret_cast<const LevelHeader*>(next(1, sizeof(LevelHeader)));
+      // Contractions never increase the number of nodes
+      if ( !level || level->num_nodes != num_nodes ||
+           level->num_coarse_nodes > num_nodes || level->num_coarse_nodes == 0 ) {
+        reject("contains an invalid level");
+        return false;
+      }
+      const HypernodeID num_coarse_nodes = level->num_coarse_nodes;
+      const char* communities = next(num_nodes, sizeof(HypernodeID));
+      const char* coarse_community_ids = next(num_coarse_nodes, sizeof(PartitionID));
+      char* binary = next(level->binary_size, sizeof(char));
+      if ( !communities || !coarse_community_ids || !binary ||
+           level->binary_size < sizeof(ds::binary::Header) ) {
+        reject("is truncated");
+        return false;
+      }
+
+      parallel::scalable_vector<HypernodeID> mapping(num_nodes);
+      std::memcpy(mapping.data(), communities, num_nodes * sizeof(HypernodeID));
+      // The mapping is used as index into the contracted hypergraph
+      const bool is_valid_mapping = std::all_of(mapping.begin(), mapping.end(),
+        [&](const HypernodeID coarse_node) { return coarse_node < num_coarse_nodes; });
+      if ( !is_valid_mapping ) {
+        reject("contains an invalid level");
+        return false;
+      }
+
+      ds::binary::MappedFile block;
+      block.header = reinterpret_cast<const ds::binary::Header*>(binary);
+      block.data = binary;
+      block.length = level->binary_size;
+      block.owner = owner;
+      if ( block.header->magic_number != ds::binary::MAGIC_NUMBER ||
+           block.header->version != ds::binary::VERSION ) {
+        reject("contains an invalid contracted hypergraph");
+        return false;
+      }
+      Hypergraph contracted_hg = Factory::constructFromBinary(block);
+      if ( contracted_hg.initialNumNodes() != num_coarse_nodes ) {
+        reject("contains an invalid contracted hypergraph");
+        return false;
+      }
+      ds::Clustering contracted_community_ids(num_coarse_nodes);
+      std::memcpy(contracted_community_ids.data(), coarse_community_ids,
+        num_coarse_nodes * sizeof(PartitionID));
+      contracted_hg.setCommunityIDs(std::move(contracted_community_ids));
+      _levels.emplace_back(std::move(contracted_hg), std::move(mapping), level->coarsening_time);
+      num_nodes = num_coarse_nodes;
+    }
+    return true;
+  }
+
+  void write(std::ofstream& out,
+             const Hypergraph& hypergraph,
+             const UncoarseningData<TypeTraits>& uncoarsening_data) const {
+    const char padding[ds::binary::SECTION_ALIGNMENT] = { };
+    auto write_padding = [&] {
+      const size_t pos = out.tellp();
+      out.write(padding, ds::binary::alignSection(pos) - pos);
+    };
+    auto write_bytes = [&](const void* data, const size_t num_bytes) {
+      write_padding();
+      out.write(reinterpret_cast<const char*>(data), num_bytes);
+    };
+
+    const std::string key = cacheKey();
+    Header header { };
+    header.magic_number = MAGIC_NUMBER;
+    header.version = VERSION;
+    header.hypergraph_type = static_cast<uint32_t>(Hypergraph::TYPE);
+    header.input_hash = _input_hash;
+    header.key_length = key.size();
+    header.num_nodes = hypergraph.initialNumNodes();
+    header.num_levels = uncoarsening_data.hierarchy.size();
+    write_bytes(&header, sizeof(Header));
+    write_bytes(key.data(), key.size());
+
+    vec<PartitionID> community_ids(hypergraph.initialNumNodes());
+    hypergraph.doParallelForAllNodes([&](const HypernodeID& hn) {
+      community_ids[hn] = hypergraph.communityID(hn);
+    });
+    write_bytes(community_ids.data(), community_ids.size() * sizeof(PartitionID));
+
+    for ( const Level<TypeTraits>& level : uncoarsening_data.hierarchy ) {
+      const Hypergraph& contracted_hg = level.contractedHypergraph();
+      LevelHeader level_header { };
+      level_header.coarsening_time = level.coarseningTime();
+      level_header.num_nodes = level.communities().size();
+      level_header.num_coarse_nodes = contracted_hg.initialNumNodes();
+      level_header.binary_size = 0;
+      write_bytes(&level_header, sizeof(LevelHeader));
+      const size_t level_header_pos = static_cast<size_t>(out.tellp()) - sizeof(LevelHeader);
+      write_bytes(level.communities().data(), level.communities().size() * sizeof(HypernodeID));
+
+      community_ids.assign(contracted_hg.initialNumNodes(), 0);
+      contracted_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+        community_ids[hn] = contracted_hg.communityID(hn);
+      });
+      write_bytes(community_ids.data(), community_ids.size() * sizeof(PartitionID));
+
+      // The size of the contracted hypergraph is only known after writing it
+      write_padding();
+      const size_t binary_pos = out.tellp();
+      Factory::writeBinary(contracted_hg, out);
+      const size_t end_pos = out.tellp();
+      level_header.binary_size = end_pos - binary_pos;
+      out.seekp(level_header_pos);
+      out.write(reinterpret_cast<const char*>(&level_header), sizeof(LevelHeader));
+      out.seekp(end_pos);
+    }
+    if ( !out ) {
+      throw SystemException("Failed to write hierarchy cache file");
+    }
+  }
+
+  const Context& _context;
+  uint64_t _input_hash;
+  bool _is_loaded;
+  // ! Community IDs of the input hypergraph
+  ds::Clustering _community_ids;
+  // ! Cached levels of the multilevel hierarchy
+  vec<Level<TypeTraits>> _levels;
+};
+
+}  // namespace mt_kahypar
@@ -40,6 +40,7 @@
 
 #include "mt-kahypar/partition/coarsening/multilevel_coarsener_base.h"
 #include "mt-kahypar/partition/coarsening/multilevel_vertex_pair_rater.h"
+#include "mt-kahypar/partition/coarsening/two_hop_clustering.h"
 #include "mt-kahypar/partition/coarsening/i_coarsener.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
@@ -50,6 +51,7 @@
 #include "mt-kahypar/utils/randomize.h"
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/timer.h"
+#include "mt-kahypar/utils/utilities.h"
 
 namespace mt_kahypar {
 template <class TypeTraits = Mandatory,
@@ -92,6 +94,7 @@ class MultilevelCoarsener : public ICoarsener,
          uncoarsening::to_reference<TypeTraits>(uncoarseningData)),
     _rater(utils::cast<Hypergraph>(hypergraph).initialNumNodes(),
            utils::cast<Hypergraph>(hypergraph).maxEdgeSize(), context),
+    _two_hop_clustering(context),
     _initial_num_nodes(utils::cast<Hypergraph>(hypergraph).initialNumNodes()),
     _current_vertices(),
     _matching_state(),
@@ -288,6 +291,25 @@ class MultilevelCoarsener : public ICoarsener,
         }
       }
     });
+
+    HypernodeID num_contracted_nodes = contracted_nodes.combine(std::plus<>());
+    const HypernodeID num_nodes_after_matching = num_hns_before_pass - num_contracted_nodes;
+    if ( _context.coarsening.use_two_hop_clustering &&
+         num_nodes_after_matching > hierarchy_contraction_limit &&
+         static_cast<double>(num_hns_before_pass) / static_cast<double>(num_nodes_after_matching) <=
+           _context.coarsening.minimum_shrink_factor ) {
+      // Coarsening stalls on this level (e.g., on star-like instances) => cluster
+      // the remaining singletons via common neighbors, but do not exceed the
+      // contraction limit of the level
+      _timer.start_timer("two_hop_clustering", "Two-Hop Clustering");
+      const HypernodeID num_two_hop_contracted_nodes = _two_hop_clustering.performClustering(
+        current_hg, cluster_ids, _cluster_weight, num_nodes_after_matching - hierarchy_contraction_limit);
+      num_contracted_nodes += num_two_hop_contracted_nodes;
+      utils::Utilities::instance().getStats(_context.utility_id).update_stat(
+        "two_hop_contracted_nodes", static_cast<int64_t>(num_two_hop_contracted_nodes));
+      _timer.stop_timer("two_hop_clustering");
+    }
+
     if ( _context.partition.show_detailed_clustering_timings ) {
       _timer.stop_timer("clustering_level_" + std::to_string(_pass_nr));
     }
@@ -331,10 +353,15 @@ class MultilevelCoarsener : public ICoarsener,
       }(), "Fixed vertex support is corrupted");
     }
 
-    return num_hns_before_pass - contracted_nodes.combine(std::plus<>());
+    return num_hns_before_pass - num_contracted_nodes;
   }
 
   void terminateImpl() override {
+    // Recursive bipartitioning and deep multilevel partitioning build several
+    // hierarchies => we record the total number of levels and hierarchies
+    utils::Stats& stats = utils::Utilities::instance().getStats(_context.utility_id);
+    stats.update_stat("coarsening_levels", static_cast<int64_t>(_pass_nr));
+    stats.update_stat("coarsening_hierarchies", static_cast<int64_t>(1));
     _progress_bar += (_initial_num_nodes - _progress_bar.count());
     _progress_bar.disable();
     _uncoarseningData.finalizeCoarsening();
@@ -513,6 +540,7 @@ class MultilevelCoarsener : public ICoarsener,
   using Base::_timer;
   using Base::_uncoarseningData;
   Rater _rater;
+  TwoHopClustering<Hypergraph> _two_hop_clustering;
   HypernodeID _initial_num_nodes;
   parallel::scalable_vector<HypernodeID> _current_vertices;
   parallel::scalable_vector<AtomicMatchingState> _matching_state;
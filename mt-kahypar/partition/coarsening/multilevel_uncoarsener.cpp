@@ -67,6 +67,8 @@ namespace mt_kahypar {
   template<typename TypeTraits>
   void MultilevelUncoarsener<TypeTraits>::projectToNextLevelAndRefineImpl() {
     PartitionedHypergraph& partitioned_hg = *_uncoarseningData.partitioned_hg;
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    const HyperedgeWeight quality_before = _current_metrics.quality;
     if ( _current_level == _num_levels ) {
       // We always start with a refinement pass on the smallest hypergraph.
       // The next calls to this function will then project the partition to the next level
@@ -82,6 +84,7 @@ namespace mt_kahypar {
       if (_current_level == 0) {
         partitioned_hg.setHypergraph(_hg);
       } else {
+        _uncoarseningData.loadLevel(_current_level - 1);
         partitioned_hg.setHypergraph((_uncoarseningData.hierarchy)[_current_level-1].contractedHypergraph());
       }
       // Hypergraph stores partition from previous level.
@@ -99,6 +102,8 @@ namespace mt_kahypar {
         partitioned_hg.setOnlyNodePart(hn, block);
       });
       partitioned_hg.initializePartition();
+      // The coarser level is no longer referenced by the partitioned hypergraph
+      _uncoarseningData.releaseLevel(_current_level);
       _timer.stop_timer("projecting_partition");
 
       // Improve partition
@@ -112,11 +117,30 @@ namespace mt_kahypar {
     ASSERT(metrics::quality(*_uncoarseningData.partitioned_hg, _context) == _current_metrics.quality,
       V(_current_metrics.quality) << V(metrics::quality(*_uncoarseningData.partitioned_hg, _context)));
 
+    if ( _context.type == ContextType::main ) {
+      // Level 0 is the input hypergraph and level i the i-th level of the hierarchy
+      const HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+      const Hypergraph& current_hg = partitioned_hg.hypergraph();
+      utils::Utilities::instance().getPerformanceLog(_context.utility_id).addRefinementLevel(
+        _current_level == _num_levels ? _num_levels : _current_level,
+        current_hg.initialNumNodes(),
+        Hypergraph::is_graph ? current_hg.initialNumEdges() / 2 : current_hg.initialNumEdges(),
+        current_hg.initialNumPins(),
+        std::chrono::duration<double>(end - start).count(),
+        quality_before, _current_metrics.quality);
+    }
+
     --_current_level;
   }
 
   template<typename TypeTraits>
   void MultilevelUncoarsener<TypeTraits>::rebalancingImpl() {
+    utils::PerformanceLog& performance_log =
+      utils::Utilities::instance().getPerformanceLog(_context.utility_id);
+    if (_context.type == ContextType::main) {
+      performance_log.addPhase("refinement", _context.initial_km1, _current_metrics.quality);
+    }
+
     // If we reach the top-level hypergraph and the partition is still imbalanced,
     // we use a rebalancing algorithm to restore balance.
     if (_context.type == ContextType::main && !metrics::isBalanced(*_uncoarseningData.partitioned_hg, _context)) {
@@ -142,6 +166,7 @@ namespace mt_kahypar {
         _timer.stop_timer("rebalance");
 
         const HyperedgeWeight quality_after = _current_metrics.quality;
+        performance_log.addPhase("rebalancing", quality_before, quality_after);
         if (_context.partition.verbose_output) {
           const HyperedgeWeight quality_delta = quality_after - quality_before;
           if (quality_delta > 0) {
@@ -210,6 +235,15 @@ namespace mt_kahypar {
     parallel::scalable_vector<HypernodeID> dummy;
     bool improvement_found = true;
     mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(partitioned_hypergraph);
+    if ( _context.isTimeLimitExceeded() ) {
+      // If the global time limit is exceeded, we only project the partition to the next level.
+      // The rebalancer is still initialized such that balance can be restored on the top level.
+      if ( _rebalancer && _context.refinement.rebalancer != RebalancingAlgorithm::do_nothing ) {
+        _rebalancer->initialize(phg);
+      }
+      return;
+    }
+
     while( improvement_found ) {
       improvement_found = false;
       const HyperedgeWeight metric_before = _current_metrics.quality;
@@ -30,6 +30,7 @@
 #include <algorithm>
 #include <limits>
 #include <stack>
+#include <type_traits>
 #include <vector>
 
 #include <tbb/enumerable_thread_specific.h>
@@ -37,8 +38,11 @@
 #include "kahypar-resources/datastructure/fast_reset_flag_array.h"
 #include "kahypar-resources/meta/mandatory.h"
 
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/compressed_incidence_array.h"
 #include "mt-kahypar/datastructures/sparse_map.h"
 #include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/rating_kernels.h"
 #include "mt-kahypar/partition/coarsening/policies/rating_fixed_vertex_acceptance_policy.h"
 
 
@@ -86,6 +90,15 @@ class MultilevelVertexPairRater {
     LARGE_RATING_MAP
   };
 
+  // ! Buffers for the vectorized rating kernels. The pins are gathered directly from
+  // ! the incidence array, the candidates are read from the entries of the rating map.
+  struct VectorizationBuffers {
+    parallel::scalable_vector<HypernodeID> representatives;
+    parallel::scalable_vector<HypernodeWeight> weights;
+    parallel::scalable_vector<uint32_t> feasible;
+  };
+  using ThreadLocalVectorizationBuffers = tbb::enumerable_thread_specific<VectorizationBuffers>;
+
   using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
 
  public:
@@ -97,6 +110,10 @@ class MultilevelVertexPairRater {
     _context(context),
     _current_num_nodes(num_hypernodes),
     _vertex_degree_sampling_threshold(context.coarsening.vertex_degree_sampling_threshold),
+    // A threshold of zero disables the vectorized kernels
+    _vectorization_threshold(context.coarsening.rating.vectorization_threshold == 0 ?
+      std::numeric_limits<size_t>::max() : context.coarsening.rating.vectorization_threshold),
+    _instruction_set(rating::supportedInstructionSet()),
     _local_cache_efficient_rating_map(0.0),
     _local_vertex_degree_bounded_rating_map(3UL * _vertex_degree_sampling_threshold, 0.0),
     _local_large_rating_map([&] {
@@ -106,6 +123,7 @@ class MultilevelVertexPairRater {
     _bloom_filter_mask(align_to_next_power_of_two(
       std::min(ID(10) * max_edge_size, _current_num_nodes)) - 1),
     _local_bloom_filter(_bloom_filter_mask + 1),
+    _local_vectorization_buffers(),
     _already_matched(num_hypernodes) { }
 
   MultilevelVertexPairRater(const MultilevelVertexPairRater&) = delete;
@@ -153,6 +171,12 @@ class MultilevelVertexPairRater {
     _current_num_nodes = current_num_nodes;
   }
 
+  // ! Overrides the instruction set used by the vectorized rating kernels
+  // ! (by default, the widest instruction set supported by the CPU)
+  void setInstructionSet(const rating::InstructionSet instruction_set) {
+    _instruction_set = instruction_set;
+  }
+
  private:
   template<bool has_fixed_vertices, typename Hypergraph, typename RatingMap>
   VertexPairRating rate(const Hypergraph& hypergraph,
@@ -176,31 +200,60 @@ class MultilevelVertexPairRater {
     RatingType max_rating = std::numeric_limits<RatingType>::min();
     HypernodeID target = std::numeric_limits<HypernodeID>::max();
     HypernodeID target_id = std::numeric_limits<HypernodeID>::max();
-    for (auto it = tmp_ratings.end() - 1; it >= tmp_ratings.begin(); --it) {
-      const HypernodeID tmp_target_id = it->key;
+    auto evaluate_candidate = [&](const HypernodeID tmp_target_id,
+                                  const RatingType score,
+                                  const HypernodeWeight target_weight) {
       const HypernodeID tmp_target = tmp_target_id;
-      const HypernodeWeight target_weight = cluster_weight[tmp_target_id];
-
-      if ( tmp_target != u && weight_u + target_weight <= max_allowed_node_weight ) {
-        HypernodeWeight penalty = HeavyNodePenaltyPolicy::penalty(weight_u, target_weight);
-        penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), 1) : penalty;
-        const RatingType tmp_rating = it->value / static_cast<double>(penalty);
-
-        bool accept_fixed_vertex_contraction = true;
-        if constexpr ( has_fixed_vertices ) {
-          accept_fixed_vertex_contraction =
-            FixedVertexAcceptancePolicy::acceptContraction(
-              hypergraph, fixed_vertices, _context, tmp_target, u);
-        }
+      HypernodeWeight penalty = HeavyNodePenaltyPolicy::penalty(weight_u, target_weight);
+      penalty = penalty == 0 ? std::max(std::max(weight_u, target_weight), 1) : penalty;
+      const RatingType tmp_rating = score / static_cast<double>(penalty);
+
+      bool accept_fixed_vertex_contraction = true;
+      if constexpr ( has_fixed_vertices ) {
+        accept_fixed_vertex_contraction =
+          FixedVertexAcceptancePolicy::acceptContraction(
+            hypergraph, fixed_vertices, _context, tmp_target, u);
+      }
 
-        DBG << "r(" << u << "," << tmp_target << ")=" << tmp_rating;
-        if ( accept_fixed_vertex_contraction &&
-             community_u_id == hypergraph.communityID(tmp_target) &&
-             AcceptancePolicy::acceptRating( tmp_rating, max_rating,
-               target_id, tmp_target_id, cpu_id, _already_matched) ) {
-          max_rating = tmp_rating;
-          target_id = tmp_target_id;
-          target = tmp_target;
+      DBG << "r(" << u << "," << tmp_target << ")=" << tmp_rating;
+      if ( accept_fixed_vertex_contraction &&
+           community_u_id == hypergraph.communityID(tmp_target) &&
+           AcceptancePolicy::acceptRating( tmp_rating, max_rating,
+             target_id, tmp_target_id, cpu_id, _already_matched) ) {
+        max_rating = tmp_rating;
+        target_id = tmp_target_id;
+        target = tmp_target;
+      }
+    };
+
+    const size_t num_candidates = tmp_ratings.size();
+    if ( num_candidates >= _vectorization_threshold ) {
+      // The weights of the candidates are packed into a contiguous array (in the same order
+      // as they are visited in the scalar loop) such that the weight constraint can be checked
+      // for several candidates at once. Since only infeasible candidates are filtered,
+      // the acceptance policy is evaluated on exactly the same sequence of candidates.
+      VectorizationBuffers& buffers = _local_vectorization_buffers.local();
+      buffers.weights.resize(num_candidates);
+      buffers.feasible.resize(num_candidates);
+      const auto last = tmp_ratings.end() - 1;
+      for ( size_t i = 0; i < num_candidates; ++i ) {
+        buffers.weights[i] = cluster_weight[(last - i)->key].load(std::memory_order_relaxed);
+      }
+      const size_t num_feasible = rating::filterFeasibleCandidates(buffers.weights.data(),
+        num_candidates, weight_u, max_allowed_node_weight, buffers.feasible.data(), _instruction_set);
+      for ( size_t j = 0; j < num_feasible; ++j ) {
+        const uint32_t pos = buffers.feasible[j];
+        const auto it = last - pos;
+        if ( it->key != u ) {
+          evaluate_candidate(it->key, it->value, buffers.weights[pos]);
+        }
+      }
+    } else {
+      for (auto it = tmp_ratings.end() - 1; it >= tmp_ratings.begin(); --it) {
+        const HypernodeID tmp_target_id = it->key;
+        const HypernodeWeight target_weight = cluster_weight[tmp_target_id];
+        if ( tmp_target_id != u && weight_u + target_weight <= max_allowed_node_weight ) {
+          evaluate_candidate(tmp_target_id, it->value, target_weight);
         }
       }
     }
@@ -233,7 +286,17 @@ class MultilevelVertexPairRater {
       for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
         HypernodeID edge_size = hypergraph.edgeSize(he);
         ASSERT(edge_size > 1, V(he));
-        if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+        if ( edge_size >= _vectorization_threshold &&
+             edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+          const HypernodeID num_pins = edge_size;
+          const HypernodeID* representatives = gatherRepresentatives(
+            hypergraph, he, cluster_ids, _local_vectorization_buffers.local());
+          edge_size = _context.coarsening.use_adaptive_edge_size ?
+            std::max(adaptiveEdgeSize(representatives, num_pins, bloom_filter), ID(2)) : edge_size;
+          const RatingType score = ScorePolicy::score(
+            hypergraph.edgeWeight(he), edge_size);
+          accumulateScore(representatives, num_pins, score, tmp_ratings, bloom_filter);
+        } else if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
           edge_size = _context.coarsening.use_adaptive_edge_size ?
             std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
           const RatingType score = ScorePolicy::score(
@@ -276,7 +339,23 @@ class MultilevelVertexPairRater {
       kahypar::ds::FastResetFlagArray<>& bloom_filter = _local_bloom_filter.local();
       for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
         HypernodeID edge_size = hypergraph.edgeSize(he);
-        if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+        if ( edge_size >= _vectorization_threshold &&
+             edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
+          const HypernodeID num_pins = edge_size;
+          const HypernodeID* representatives = gatherRepresentatives(
+            hypergraph, he, cluster_ids, _local_vectorization_buffers.local());
+          edge_size = _context.coarsening.use_adaptive_edge_size ?
+            std::max(adaptiveEdgeSize(representatives, num_pins, bloom_filter), ID(2)) : edge_size;
+          // Break if number of accesses to the tmp rating map would exceed
+          // vertex degree sampling threshold
+          if ( num_tmp_rating_map_accesses + edge_size > _vertex_degree_sampling_threshold  ) {
+            break;
+          }
+          const RatingType score = ScorePolicy::score(
+            hypergraph.edgeWeight(he), edge_size);
+          num_tmp_rating_map_accesses += accumulateScore(
+            representatives, num_pins, score, tmp_ratings, bloom_filter);
+        } else if ( edge_size < _context.partition.ignore_hyperedge_size_threshold ) {
           edge_size = _context.coarsening.use_adaptive_edge_size ?
             std::max(adaptiveEdgeSize(hypergraph, he, bloom_filter, cluster_ids), ID(2)) : edge_size;
           // Break if number of accesses to the tmp rating map would exceed
@@ -321,6 +400,75 @@ class MultilevelVertexPairRater {
     return edge_size;
   }
 
+  // ! Stores the representatives of the pins of hyperedge he in a packed array. The cluster IDs
+  // ! are gathered directly from the incidence array if the pins are stored contiguously.
+  template<typename Hypergraph>
+  const HypernodeID* gatherRepresentatives(const Hypergraph& hypergraph,
+                                           const HyperedgeID he,
+                                           const parallel::scalable_vector<HypernodeID>& cluster_ids,
+                                           VectorizationBuffers& buffers) {
+    const HypernodeID edge_size = hypergraph.edgeSize(he);
+    buffers.representatives.resize(edge_size);
+    auto pins = hypergraph.pins(he);
+    const HypernodeID* contiguous_pins = nullptr;
+    if constexpr ( std::is_same_v<std::remove_cv_t<decltype(pins.begin())>,
+                                  std::remove_cv_t<typename ds::Array<HypernodeID>::const_iterator>> ) {
+      contiguous_pins = &*pins.begin();
+    } else if constexpr ( std::is_same_v<std::remove_cv_t<decltype(pins.begin())>,
+                                         ds::CompressibleIterator<HypernodeID>> ) {
+      // nullptr, if the incidence array is compressed
+      contiguous_pins = pins.begin().raw();
+    }
+
+    if ( contiguous_pins ) {
+      rating::gatherClusterIDs(contiguous_pins, edge_size, cluster_ids.data(),
+        cluster_ids.size(), buffers.representatives.data(), _instruction_set);
+    } else {
+      size_t i = 0;
+      for ( const HypernodeID& v : pins ) {
+        buffers.representatives[i++] = cluster_ids[v];
+      }
+    }
+    return buffers.representatives.data();
+  }
+
+  // ! Adds the score to the rating of each distinct representative and
+  // ! returns the number of accesses to the rating map
+  template<typename RatingMap>
+  inline size_t accumulateScore(const HypernodeID* representatives,
+                                const HypernodeID num_pins,
+                                const RatingType score,
+                                RatingMap& tmp_ratings,
+                                kahypar::ds::FastResetFlagArray<>& bloom_filter) {
+    size_t num_tmp_rating_map_accesses = 0;
+    for ( HypernodeID i = 0; i < num_pins; ++i ) {
+      const HypernodeID representative = representatives[i];
+      const HypernodeID bloom_filter_rep = representative & _bloom_filter_mask;
+      if ( !bloom_filter[bloom_filter_rep] ) {
+        tmp_ratings[representative] += score;
+        bloom_filter.set(bloom_filter_rep, true);
+        ++num_tmp_rating_map_accesses;
+      }
+    }
+    bloom_filter.reset();
+    return num_tmp_rating_map_accesses;
+  }
+
+  inline HypernodeID adaptiveEdgeSize(const HypernodeID* representatives,
+                                      const HypernodeID num_pins,
+                                      kahypar::ds::FastResetFlagArray<>& bloom_filter) {
+    HypernodeID edge_size = 0;
+    for ( HypernodeID i = 0; i < num_pins; ++i ) {
+      const HypernodeID bloom_filter_rep = representatives[i] & _bloom_filter_mask;
+      if ( !bloom_filter[bloom_filter_rep] ) {
+        ++edge_size;
+        bloom_filter.set(bloom_filter_rep, true);
+      }
+    }
+    bloom_filter.reset();
+    return edge_size;
+  }
+
   template<typename Hypergraph>
   inline RatingMapType getRatingMapTypeForRatingOfHypernode(const Hypergraph& hypergraph,
                                                             const HypernodeID u) {
@@ -384,6 +532,11 @@ class MultilevelVertexPairRater {
   HypernodeID _current_num_nodes;
   // ! Maximum number of neighbors that are considered for rating
   size_t _vertex_degree_sampling_threshold;
+  // ! Hyperedges with at least this many pins and rating maps with at least
+  // ! this many candidates are processed with vectorized kernels
+  size_t _vectorization_threshold;
+  // ! Instruction set used by the vectorized rating kernels
+  rating::InstructionSet _instruction_set;
 
   // ! Cache efficient rating map (with linear probing) that is used if the
   // ! estimated number of neighbors smaller than 10922 (= 32768 / 3)
@@ -402,6 +555,9 @@ class MultilevelVertexPairRater {
   size_t _bloom_filter_mask;
   ThreadLocalFastResetFlagArray _local_bloom_filter;
 
+  // ! Packed arrays for the vectorized rating kernels
+  ThreadLocalVectorizationBuffers _local_vectorization_buffers;
+
   // ! Marks all matched vertices
   kahypar::ds::FastResetFlagArray<> _already_matched;
 };
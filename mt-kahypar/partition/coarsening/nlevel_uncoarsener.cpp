@@ -228,6 +228,12 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   void NLevelUncoarsener<TypeTraits>::rebalancingImpl() {
+    utils::PerformanceLog& performance_log =
+      utils::Utilities::instance().getPerformanceLog(_context.utility_id);
+    if ( _context.type == ContextType::main ) {
+      performance_log.addPhase("refinement", _context.initial_km1, _current_metrics.quality);
+    }
+
     // If we reach the top-level hypergraph and the partition is still imbalanced,
     // we use a rebalancing algorithm to restore balance.
     if ( _context.type == ContextType::main && !metrics::isBalanced(*_uncoarseningData.partitioned_hg, _context)) {
@@ -249,6 +255,7 @@ namespace mt_kahypar {
       _timer.stop_timer("rebalance");
 
       const HyperedgeWeight quality_after = _current_metrics.quality;
+      performance_log.addPhase("rebalancing", quality_before, quality_after);
       if ( _context.partition.verbose_output ) {
         const HyperedgeWeight quality_delta = quality_after - quality_before;
         if ( quality_delta > 0 ) {
@@ -299,6 +306,11 @@ namespace mt_kahypar {
     _tmp_refinement_nodes.clear_parallel();
     _border_vertices_of_batch.reset();
 
+    if ( _context.isTimeLimitExceeded() ) {
+      // Global time limit is exceeded => only uncontract the remaining nodes
+      return;
+    }
+
     if ( debug && _context.type == ContextType::main ) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
         _context, "Refinement Hypergraph", false);
@@ -354,7 +366,7 @@ namespace mt_kahypar {
       return tmp_global_fm;
     };
 
-    if ( _context.refinement.global_fm.use_global_fm ) {
+    if ( _context.refinement.global_fm.use_global_fm && !_context.isTimeLimitExceeded() ) {
       if ( debug && _context.type == ContextType::main ) {
         io::printHypergraphInfo(partitioned_hypergraph.hypergraph(),
           _context, "Refinement Hypergraph", false);
@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/coarsening/rating_kernels.h"
+
+#include <limits>
+#include <type_traits>
+
+#include "mt-kahypar/macros.h"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define MT_KAHYPAR_X86_SIMD_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace mt_kahypar {
+namespace rating {
+
+std::ostream & operator<< (std::ostream& os, const InstructionSet& instruction_set) {
+  switch (instruction_set) {
+    case InstructionSet::scalar: return os << "scalar";
+    case InstructionSet::avx2: return os << "avx2";
+    case InstructionSet::avx512: return os << "avx512";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(instruction_set);
+}
+
+InstructionSet supportedInstructionSet() {
+  static const InstructionSet instruction_set = [] {
+    #ifdef MT_KAHYPAR_X86_SIMD_DISPATCH
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") ) {
+      return InstructionSet::avx512;
+    } else if ( __builtin_cpu_supports("avx2") ) {
+      return InstructionSet::avx2;
+    }
+    #endif
+    return InstructionSet::scalar;
+  }();
+  return instruction_set;
+}
+
+namespace {
+
+void gatherClusterIDsScalar(const HypernodeID* pins,
+                            const size_t begin,
+                            const size_t end,
+                            const HypernodeID* cluster_ids,
+                            HypernodeID* representatives) {
+  for ( size_t i = begin; i < end; ++i ) {
+    representatives[i] = cluster_ids[pins[i]];
+  }
+}
+
+size_t filterFeasibleCandidatesScalar(const HypernodeWeight* target_weights,
+                                      const size_t begin,
+                                      const size_t end,
+                                      const HypernodeWeight max_target_weight,
+                                      uint32_t* feasible,
+                                      size_t num_feasible) {
+  for ( size_t i = begin; i < end; ++i ) {
+    feasible[num_feasible] = i;
+    num_feasible += target_weights[i] <= max_target_weight;
+  }
+  return num_feasible;
+}
+
+#ifdef MT_KAHYPAR_X86_SIMD_DISPATCH
+__attribute__((target("avx2")))
+void gatherClusterIDsAVX2(const HypernodeID* pins,
+                          const size_t num_pins,
+                          const HypernodeID* cluster_ids,
+                          HypernodeID* representatives) {
+  size_t i = 0;
+  if constexpr ( sizeof(HypernodeID) == 4 ) {
+    for ( ; i + 8 <= num_pins; i += 8 ) {
+      const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pins + i));
+      const __m256i reps = _mm256_i32gather_epi32(reinterpret_cast<const int*>(cluster_ids), idx, 4);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(representatives + i), reps);
+    }
+  } else {
+    for ( ; i + 4 <= num_pins; i += 4 ) {
+      const __m256i idx = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(pins + i));
+      const __m256i reps = _mm256_i64gather_epi64(reinterpret_cast<const long long*>(cluster_ids), idx, 8);
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(representatives + i), reps);
+    }
+  }
+  gatherClusterIDsScalar(pins, i, num_pins, cluster_ids, representatives);
+}
+
+__attribute__((target("avx512f")))
+void gatherClusterIDsAVX512(const HypernodeID* pins,
+                            const size_t num_pins,
+                            const HypernodeID* cluster_ids,
+                            HypernodeID* representatives) {
+  size_t i = 0;
+  if constexpr ( sizeof(HypernodeID) == 4 ) {
+    for ( ; i + 16 <= num_pins; i += 16 ) {
+      const __m512i idx = _mm512_loadu_si512(pins + i);
+      const __m512i reps = _mm512_i32gather_epi32(idx, cluster_ids, 4);
+      _mm512_storeu_si512(representatives + i, reps);
+    }
+  } else {
+    for ( ; i + 8 <= num_pins; i += 8 ) {
+      const __m512i idx = _mm512_loadu_si512(pins + i);
+      const __m512i reps = _mm512_i64gather_epi64(idx, cluster_ids, 8);
+      _mm512_storeu_si512(representatives + i, reps);
+    }
+  }
+  gatherClusterIDsScalar(pins, i, num_pins, cluster_ids, representatives);
+}
+
+__attribute__((target("avx2,bmi")))
+size_t filterFeasibleCandidatesAVX2(const HypernodeWeight* target_weights,
+                                    const size_t num_candidates,
+                                    const HypernodeWeight max_target_weight,
+                                    uint32_t* feasible) {
+  static_assert(sizeof(HypernodeWeight) == 4);
+  const __m256i limit = _mm256_set1_epi32(max_target_weight);
+  size_t num_feasible = 0;
+  size_t i = 0;
+  for ( ; i + 8 <= num_candidates; i += 8 ) {
+    const __m256i weights = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(target_weights + i));
+    // A candidate is feasible if its weight is not greater than the limit
+    uint32_t mask = ~_mm256_movemask_ps(_mm256_castsi256_ps(
+      _mm256_cmpgt_epi32(weights, limit))) & 0xFF;
+    while ( mask ) {
+      feasible[num_feasible++] = i + _tzcnt_u32(mask);
+      mask &= mask - 1;
+    }
+  }
+  return filterFeasibleCandidatesScalar(target_weights, i,
+    num_candidates, max_target_weight, feasible, num_feasible);
+}
+
+__attribute__((target("avx512f")))
+size_t filterFeasibleCandidatesAVX512(const HypernodeWeight* target_weights,
+                                      const size_t num_candidates,
+                                      const HypernodeWeight max_target_weight,
+                                      uint32_t* feasible) {
+  static_assert(sizeof(HypernodeWeight) == 4);
+  const __m512i limit = _mm512_set1_epi32(max_target_weight);
+  const __m512i offsets = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  size_t num_feasible = 0;
+  size_t i = 0;
+  for ( ; i + 16 <= num_candidates; i += 16 ) {
+    const __m512i weights = _mm512_loadu_si512(target_weights + i);
+    const __mmask16 mask = _mm512_cmple_epi32_mask(weights, limit);
+    const __m512i indices = _mm512_add_epi32(_mm512_set1_epi32(i), offsets);
+    _mm512_mask_compressstoreu_epi32(feasible + num_feasible, mask, indices);
+    num_feasible += __builtin_popcount(mask);
+  }
+  return filterFeasibleCandidatesScalar(target_weights, i,
+    num_candidates, max_target_weight, feasible, num_feasible);
+}
+#endif
+
+}  // namespace
+
+void gatherClusterIDs(const HypernodeID* pins,
+                      const size_t num_pins,
+                      const HypernodeID* cluster_ids,
+                      const HypernodeID num_cluster_ids,
+                      HypernodeID* representatives,
+                      const InstructionSet instruction_set) {
+  #ifdef MT_KAHYPAR_X86_SIMD_DISPATCH
+  // Gather instructions interpret the indices as signed integers
+  const bool fits_into_signed_index = num_cluster_ids <=
+    static_cast<HypernodeID>(std::numeric_limits<std::make_signed_t<HypernodeID>>::max());
+  if ( fits_into_signed_index ) {
+    if ( instruction_set == InstructionSet::avx512 ) {
+      gatherClusterIDsAVX512(pins, num_pins, cluster_ids, representatives);
+      return;
+    } else if ( instruction_set == InstructionSet::avx2 ) {
+      gatherClusterIDsAVX2(pins, num_pins, cluster_ids, representatives);
+      return;
+    }
+  }
+  #else
+  unused(num_cluster_ids);
+  unused(instruction_set);
+  #endif
+  gatherClusterIDsScalar(pins, 0, num_pins, cluster_ids, representatives);
+}
+
+size_t filterFeasibleCandidates(const HypernodeWeight* target_weights,
+                                const size_t num_candidates,
+                                const HypernodeWeight weight_u,
+                                const HypernodeWeight max_allowed_node_weight,
+                                uint32_t* feasible,
+                                const InstructionSet instruction_set) {
+  // weight_u + w <= max_allowed_node_weight <=> w <= max_allowed_node_weight - weight_u
+  const HypernodeWeight max_target_weight = max_allowed_node_weight - weight_u;
+  #ifdef MT_KAHYPAR_X86_SIMD_DISPATCH
+  if ( instruction_set == InstructionSet::avx512 ) {
+    return filterFeasibleCandidatesAVX512(target_weights, num_candidates, max_target_weight, feasible);
+  } else if ( instruction_set == InstructionSet::avx2 ) {
+    return filterFeasibleCandidatesAVX2(target_weights, num_candidates, max_target_weight, feasible);
+  }
+  #else
+  unused(instruction_set);
+  #endif
+  return filterFeasibleCandidatesScalar(target_weights, 0,
+    num_candidates, max_target_weight, feasible, 0);
+}
+
+}  // namespace rating
+}  // namespace mt_kahypar
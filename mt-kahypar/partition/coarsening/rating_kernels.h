@@ -0,0 +1,70 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+namespace mt_kahypar {
+namespace rating {
+
+enum class InstructionSet : uint8_t {
+  scalar,
+  avx2,
+  avx512
+};
+
+std::ostream & operator<< (std::ostream& os, const InstructionSet& instruction_set);
+
+// ! Widest instruction set supported by the CPU on which the binary is executed.
+// ! The result is determined once at runtime such that the same binary runs
+// ! on machines with and without AVX2/AVX-512 support.
+InstructionSet supportedInstructionSet();
+
+// ! Stores the cluster ID of each pin in representatives (representatives[i] = cluster_ids[pins[i]]).
+// ! Uses vector gather instructions if supported by the instruction set.
+void gatherClusterIDs(const HypernodeID* pins,
+                      const size_t num_pins,
+                      const HypernodeID* cluster_ids,
+                      const HypernodeID num_cluster_ids,
+                      HypernodeID* representatives,
+                      const InstructionSet instruction_set = supportedInstructionSet());
+
+// ! Writes the indices of all candidates i with weight_u + target_weights[i] <= max_allowed_node_weight
+// ! into feasible (in increasing order) and returns the number of feasible candidates.
+// ! Candidates are compared in packed vector registers if supported by the instruction set.
+size_t filterFeasibleCandidates(const HypernodeWeight* target_weights,
+                                const size_t num_candidates,
+                                const HypernodeWeight weight_u,
+                                const HypernodeWeight max_allowed_node_weight,
+                                uint32_t* feasible,
+                                const InstructionSet instruction_set = supportedInstructionSet());
+
+}  // namespace rating
+}  // namespace mt_kahypar
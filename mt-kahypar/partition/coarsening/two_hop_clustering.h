@@ -0,0 +1,218 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <tuple>
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+
+/*!
+ * Second clustering sweep that is applied to all vertices that were not clustered
+ * by the matching-based clustering pass. On star-like and power-law instances, many
+ * vertices are only connected to a few high-degree vertices and rarely find a contraction
+ * partner since all of their neighbors are already matched or too heavy. Such vertices
+ * are clustered with each other if they share a common neighbor (two-hop matching):
+ *  1.) Degree-one vertices (leaves) are clustered with all other leaves attached to the same neighbor
+ *  2.) Vertices are clustered with all other vertices attached to the same neighbor, if
+ *      that neighbor has degree at least c-two-hop-degree-threshold
+ * For hypergraphs, the common neighbor is the heaviest incident hyperedge of a vertex
+ * (its degree is the size of the hyperedge). Clusters respect the maximum allowed node weight
+ * and community structure, and fixed vertices are never clustered in this sweep.
+ * The sweep is an opt-in experiment (c-two-hop-clustering) and is not enabled in any preset,
+ * since its effect on the number of levels and the initial partitioning time is not evaluated yet.
+ */
+template<typename Hypergraph>
+class TwoHopClustering {
+
+  using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
+
+  static constexpr bool debug = false;
+  static constexpr HypernodeID kInvalidAnchor = std::numeric_limits<HypernodeID>::max();
+
+  struct Candidate {
+    PartitionID community;
+    HypernodeID anchor;
+    HypernodeID node;
+
+    bool operator< (const Candidate& other) const {
+      return std::tie(community, anchor, node) <
+        std::tie(other.community, other.anchor, other.node);
+    }
+
+    bool sharesAnchor(const Candidate& other) const {
+      return community == other.community && anchor == other.anchor;
+    }
+  };
+
+ public:
+  explicit TwoHopClustering(const Context& context) :
+    _context(context) { }
+
+  TwoHopClustering(const TwoHopClustering&) = delete;
+  TwoHopClustering & operator= (const TwoHopClustering &) = delete;
+
+  TwoHopClustering(TwoHopClustering&&) = delete;
+  TwoHopClustering & operator= (TwoHopClustering &&) = delete;
+
+  // ! Clusters the vertices that are still singletons in the given clustering
+  // ! and returns the number of contracted vertices. At most max_contracted_nodes
+  // ! vertices are contracted such that the contraction limit of the level is respected.
+  HypernodeID performClustering(const Hypergraph& hypergraph,
+                                parallel::scalable_vector<HypernodeID>& cluster_ids,
+                                parallel::scalable_vector<AtomicWeight>& cluster_weight,
+                                const HypernodeID max_contracted_nodes = std::numeric_limits<HypernodeID>::max()) {
+    if ( max_contracted_nodes == 0 ) {
+      return 0;
+    }
+
+    // Collect all unclustered vertices together with their common neighbor (anchor)
+    tbb::enumerable_thread_specific<parallel::scalable_vector<Candidate>> local_candidates;
+    tbb::parallel_for(ID(0), hypergraph.initialNumNodes(), [&](const HypernodeID hn) {
+      if ( hypergraph.nodeIsEnabled(hn) && isSingleton(hypergraph, hn, cluster_ids, cluster_weight) &&
+           !hypergraph.isFixed(hn) ) {
+        const HypernodeID anchor = computeAnchor(hypergraph, hn);
+        if ( anchor != kInvalidAnchor ) {
+          local_candidates.local().push_back(Candidate { hypergraph.communityID(hn), anchor, hn });
+        }
+      }
+    });
+    parallel::scalable_vector<Candidate> candidates;
+    for ( const auto& local : local_candidates ) {
+      candidates.insert(candidates.end(), local.begin(), local.end());
+    }
+    if ( candidates.size() < 2 ) {
+      return 0;
+    }
+    tbb::parallel_sort(candidates.begin(), candidates.end());
+
+    // Candidates with the same anchor form consecutive ranges
+    parallel::scalable_vector<size_t> group_start;
+    group_start.push_back(0);
+    for ( size_t i = 1; i < candidates.size(); ++i ) {
+      if ( !candidates[i].sharesAnchor(candidates[i - 1]) ) {
+        group_start.push_back(i);
+      }
+    }
+    group_start.push_back(candidates.size());
+
+    // Each vertex is part of exactly one group => groups can be clustered independently
+    tbb::enumerable_thread_specific<HypernodeID> contracted_nodes(0);
+    std::atomic<HypernodeID> num_reserved_contractions(0);
+    tbb::parallel_for(UL(0), group_start.size() - 1, [&](const size_t group) {
+      HypernodeID& local_contracted_nodes = contracted_nodes.local();
+      HypernodeID rep = candidates[group_start[group]].node;
+      for ( size_t i = group_start[group] + 1; i < group_start[group + 1]; ++i ) {
+        const HypernodeID hn = candidates[i].node;
+        const HypernodeWeight weight_hn = hypergraph.nodeWeight(hn);
+        if ( cluster_weight[rep] + weight_hn <= _context.coarsening.max_allowed_node_weight ) {
+          if ( num_reserved_contractions.fetch_add(1, std::memory_order_relaxed) >= max_contracted_nodes ) {
+            // Contraction limit of the level is reached
+            break;
+          }
+          cluster_ids[hn] = rep;
+          cluster_weight[rep].fetch_add(weight_hn, std::memory_order_relaxed);
+          ++local_contracted_nodes;
+        } else {
+          // Cluster is full => start a new cluster
+          rep = hn;
+        }
+      }
+    });
+
+    const HypernodeID num_contracted_nodes = contracted_nodes.combine(std::plus<>());
+    DBG << V(candidates.size()) << V(group_start.size() - 1) << V(num_contracted_nodes);
+    return num_contracted_nodes;
+  }
+
+ private:
+  bool isSingleton(const Hypergraph& hypergraph,
+                   const HypernodeID hn,
+                   const parallel::scalable_vector<HypernodeID>& cluster_ids,
+                   const parallel::scalable_vector<AtomicWeight>& cluster_weight) const {
+    return cluster_ids[hn] == hn && cluster_weight[hn] == hypergraph.nodeWeight(hn);
+  }
+
+  // ! Returns the common neighbor via which hn is clustered in this sweep
+  // ! or kInvalidAnchor, if hn is neither a leaf nor attached to a high-degree neighbor
+  HypernodeID computeAnchor(const Hypergraph& hypergraph, const HypernodeID hn) const {
+    const bool is_leaf = hypergraph.nodeDegree(hn) == 1;
+    HypernodeID anchor = kInvalidAnchor;
+    HyperedgeWeight max_weight = 0;
+    HypernodeID anchor_degree = 0;
+    if constexpr ( Hypergraph::is_graph ) {
+      // Heaviest neighbor (ties are broken in favor of the neighbor with smaller ID)
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        const HypernodeID target = hypergraph.edgeTarget(he);
+        const HyperedgeWeight weight = hypergraph.edgeWeight(he);
+        if ( target != hn && ( weight > max_weight || ( weight == max_weight && target < anchor ) ) ) {
+          anchor = target;
+          max_weight = weight;
+        }
+      }
+      if ( anchor != kInvalidAnchor ) {
+        anchor_degree = hypergraph.nodeDegree(anchor);
+      }
+    } else {
+      // Heaviest incident hyperedge (ties are broken in favor of smaller hyperedges)
+      HypernodeID min_size = std::numeric_limits<HypernodeID>::max();
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        const HypernodeID size = hypergraph.edgeSize(he);
+        const HyperedgeWeight weight = hypergraph.edgeWeight(he);
+        if ( size > 1 && size < _context.partition.ignore_hyperedge_size_threshold &&
+             ( weight > max_weight || ( weight == max_weight &&
+               ( size < min_size || ( size == min_size && he < anchor ) ) ) ) ) {
+          anchor = he;
+          max_weight = weight;
+          min_size = size;
+        }
+      }
+      anchor_degree = min_size;
+    }
+
+    if ( is_leaf || ( anchor != kInvalidAnchor &&
+         anchor_degree >= _context.coarsening.two_hop_degree_threshold ) ) {
+      return anchor;
+    }
+    return kInvalidAnchor;
+  }
+
+  const Context& _context;
+};
+
+}  // namespace mt_kahypar
@@ -40,6 +40,9 @@ namespace mt_kahypar {
     if ( params.fixed_vertex_filename != "" ) {
       str << "  Fixed Vertex File:                  " << params.fixed_vertex_filename << std::endl;
     }
+    if ( params.hierarchy_cache_file != "" ) {
+      str << "  Hierarchy Cache File:               " << params.hierarchy_cache_file << std::endl;
+    }
     if ( params.write_partition_file ) {
       str << "  Partition File:                     " << params.graph_partition_filename << std::endl;
     }
@@ -58,6 +61,12 @@ namespace mt_kahypar {
     str << "  epsilon:                            " << params.epsilon << std::endl;
     str << "  seed:                               " << params.seed << std::endl;
     str << "  Number of V-Cycles:                 " << params.num_vcycles << std::endl;
+    if ( params.time_limit > 0 ) {
+      str << "  Time Limit:                         " << params.time_limit << "s" << std::endl;
+    }
+    if ( params.max_memory > 0 ) {
+      str << "  Memory Budget:                      " << params.max_memory << " MB" << std::endl;
+    }
     str << "  Ignore HE Size Threshold:           " << params.ignore_hyperedge_size_threshold << std::endl;
     str << "  Large HE Size Threshold:            " << params.large_hyperedge_size_threshold << std::endl;
     if ( params.use_individual_part_weights ) {
@@ -81,6 +90,12 @@ namespace mt_kahypar {
     str << "    Minimum Vertex Move Fraction:        " << params.min_vertex_move_fraction << std::endl;
     str << "    Vertex Degree Sampling Threshold:    " << params.vertex_degree_sampling_threshold << std::endl;
     str << "    Number of subrounds (deterministic): " << params.num_sub_rounds_deterministic << std::endl;
+    str << "    Adaptive Skipping:                   " << std::boolalpha << params.adaptive_skipping << std::endl;
+    if ( params.adaptive_skipping ) {
+      str << "    Min. Clustering Coefficient:         " << params.min_clustering_coefficient << std::endl;
+      str << "    Min. Modularity Gain:                " << params.min_modularity_gain << std::endl;
+      str << "    Min. Modularity Gain (Contraction):  " << params.min_modularity_gain_for_contraction << std::endl;
+    }
     return str;
   }
 
@@ -88,6 +103,9 @@ namespace mt_kahypar {
     str << "Preprocessing Parameters:" << std::endl;
     str << "  Use Community Detection:            " << std::boolalpha << params.use_community_detection << std::endl;
     str << "  Disable C. D. for Mesh Graphs:      " << std::boolalpha << params.disable_community_detection_for_mesh_graphs << std::endl;
+    str << "  Locality Relabeling:                " << params.relabeling << std::endl;
+    str << "  Compress Incidence Arrays:          " << std::boolalpha << params.compress_incidence_arrays << std::endl;
+    str << "  Identical Vertex Reduction:         " << std::boolalpha << params.use_identical_vertex_reduction << std::endl;
     if (params.use_community_detection) {
       str << std::endl << params.community_detection;
     }
@@ -99,6 +117,7 @@ namespace mt_kahypar {
     str << "    Rating Function:                  " << params.rating_function << std::endl;
     str << "    Heavy Node Penalty:               " << params.heavy_node_penalty_policy << std::endl;
     str << "    Acceptance Policy:                " << params.acceptance_policy << std::endl;
+    str << "    Vectorization Threshold:          " << params.vectorization_threshold << std::endl;
     return str;
   }
 
@@ -115,6 +134,10 @@ namespace mt_kahypar {
     str << "  Maximum Shrink Factor:              " << params.maximum_shrink_factor << std::endl;
     str << "  Vertex Degree Sampling Threshold:   " << params.vertex_degree_sampling_threshold << std::endl;
     str << "  Number of subrounds (deterministic):" << params.num_sub_rounds_deterministic << std::endl;
+    str << "  Use Two-Hop Clustering:             " << std::boolalpha << params.use_two_hop_clustering << std::endl;
+    if ( params.use_two_hop_clustering ) {
+      str << "  Two-Hop Degree Threshold:           " << params.two_hop_degree_threshold << std::endl;
+    }
     str << std::endl << params.rating;
     return str;
   }
@@ -145,6 +168,10 @@ namespace mt_kahypar {
       out << "    Minimum Improvement Factor:       " << params.min_improvement << std::endl;
       out << "    Release Nodes:                    " << std::boolalpha << params.release_nodes << std::endl;
       out << "    Time Limit Factor:                " << params.time_limit_factor << std::endl;
+      out << "    Priority Queue Type:              " << params.pq_type << std::endl;
+      if ( params.pq_type == FMPriorityQueueType::bucket_queue ) {
+        out << "    Bucket Queue Max. Gain:           " << params.bucket_queue_max_gain << std::endl;
+      }
     }
     if ( params.algorithm == FMAlgorithm::unconstrained_fm ) {
       out << "    Unconstrained Rounds:             " << params.unconstrained_rounds << std::endl;
@@ -266,6 +293,19 @@ namespace mt_kahypar {
       refinement.refine_until_no_improvement;
   }
 
+  void Context::startTimeLimit() {
+    start_time = std::chrono::high_resolution_clock::now();
+  }
+
+  bool Context::isTimeLimitExceeded() const {
+    if ( partition.time_limit <= 0 ) {
+      return false;
+    }
+    const double elapsed_time = std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - start_time).count();
+    return elapsed_time > partition.time_limit;
+  }
+
   void Context::setupPartWeights(const HypernodeWeight total_hypergraph_weight) {
     if (partition.use_individual_part_weights) {
       ASSERT(static_cast<size_t>(partition.k) == partition.max_part_weights.size());
@@ -367,6 +407,14 @@ namespace mt_kahypar {
 
     shared_memory.static_balancing_work_packages = std::clamp(shared_memory.static_balancing_work_packages, size_t(4), size_t(256));
 
+    #ifndef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+    if ( preprocessing.compress_incidence_arrays ) {
+      throw InvalidParameterException(
+        "Compressed incidence arrays are deactivated. Add -DKAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS=ON "
+        "to the cmake command and rebuild Mt-KaHyPar.");
+    }
+    #endif
+
     if ( partition.objective == Objective::steiner_tree ) {
       if ( !target_graph ) {
         partition.objective = Objective::km1;
@@ -422,6 +470,13 @@ namespace mt_kahypar {
     // Set correct gain policy type
     setupGainPolicy();
 
+    if ( partition.preset_type == PresetType::large_k &&
+         partition.gain_policy != GainPolicy::sparse_km1 ) {
+      // Only the sparse gain cache of the connectivity metric requires less than O(n * k) memory.
+      // All other gain caches are infeasible for large k => disable FM
+      refinement.fm.algorithm = FMAlgorithm::do_nothing;
+    }
+
     if ( partition.preset_type == PresetType::large_k ) {
       // Silently switch to deep multilevel scheme for large k partitioning
       partition.mode = Mode::deep_multilevel;
@@ -459,7 +514,15 @@ namespace mt_kahypar {
 
     if ( partition.instance_type == InstanceType::hypergraph ) {
       switch ( partition.objective ) {
-        case Objective::km1: partition.gain_policy = GainPolicy::km1; break;
+        case Objective::km1:
+          partition.gain_policy = GainPolicy::km1;
+          #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+          if ( partition.preset_type == PresetType::large_k ) {
+            // The dense gain cache requires O(n * k) memory
+            partition.gain_policy = GainPolicy::sparse_km1;
+          }
+          #endif
+          break;
         case Objective::cut: partition.gain_policy = GainPolicy::cut; break;
         case Objective::soed: partition.gain_policy = GainPolicy::soed; break;
         case Objective::steiner_tree: partition.gain_policy = GainPolicy::steiner_tree; break;
@@ -502,10 +565,16 @@ namespace mt_kahypar {
     // preprocessing
     preprocessing.use_community_detection = true;
     preprocessing.disable_community_detection_for_mesh_graphs = true;
+    preprocessing.compress_incidence_arrays = false;
+    preprocessing.use_identical_vertex_reduction = false;
     preprocessing.community_detection.edge_weight_function = LouvainEdgeWeight::hybrid;
     preprocessing.community_detection.max_pass_iterations = 5;
     preprocessing.community_detection.min_vertex_move_fraction = 0.01;
     preprocessing.community_detection.vertex_degree_sampling_threshold = 200000;
+    preprocessing.community_detection.adaptive_skipping = false;
+    preprocessing.community_detection.min_clustering_coefficient = 0.05;
+    preprocessing.community_detection.min_modularity_gain = 0.1;
+    preprocessing.community_detection.min_modularity_gain_for_contraction = 0.3;
 
     // coarsening
     coarsening.algorithm = CoarseningAlgorithm::multilevel_coarsener;
@@ -515,11 +584,14 @@ namespace mt_kahypar {
     coarsening.max_allowed_weight_multiplier = 1.0;
     coarsening.contraction_limit_multiplier = 160;
     coarsening.vertex_degree_sampling_threshold = 200000;
+    coarsening.use_two_hop_clustering = false;
+    coarsening.two_hop_degree_threshold = 100;
 
     // coarsening -> rating
     coarsening.rating.rating_function = RatingFunction::heavy_edge;
     coarsening.rating.heavy_node_penalty_policy = HeavyNodePenaltyPolicy::no_penalty;
     coarsening.rating.acceptance_policy = AcceptancePolicy::best_prefer_unmatched;
+    coarsening.rating.vectorization_threshold = 0;
 
     // initial partitioning
     initial_partitioning.mode = Mode::recursive_bipartitioning;
@@ -634,11 +706,17 @@ namespace mt_kahypar {
     // preprocessing
     preprocessing.use_community_detection = true;
     preprocessing.disable_community_detection_for_mesh_graphs = true;
+    preprocessing.compress_incidence_arrays = false;
+    preprocessing.use_identical_vertex_reduction = false;
     preprocessing.stable_construction_of_incident_edges = true;
     preprocessing.community_detection.edge_weight_function = LouvainEdgeWeight::hybrid;
     preprocessing.community_detection.max_pass_iterations = 5;
     preprocessing.community_detection.min_vertex_move_fraction = 0.01;
     preprocessing.community_detection.vertex_degree_sampling_threshold = 200000;
+    preprocessing.community_detection.adaptive_skipping = false;
+    preprocessing.community_detection.min_clustering_coefficient = 0.05;
+    preprocessing.community_detection.min_modularity_gain = 0.1;
+    preprocessing.community_detection.min_modularity_gain_for_contraction = 0.3;
     preprocessing.community_detection.low_memory_contraction = true;
     preprocessing.community_detection.num_sub_rounds_deterministic = 16;
 
@@ -650,12 +728,15 @@ namespace mt_kahypar {
     coarsening.max_allowed_weight_multiplier = 1.0;
     coarsening.contraction_limit_multiplier = 160;
     coarsening.vertex_degree_sampling_threshold = 200000;
+    coarsening.use_two_hop_clustering = false;
+    coarsening.two_hop_degree_threshold = 100;
     coarsening.num_sub_rounds_deterministic = 3;
 
     // coarsening -> rating
     coarsening.rating.rating_function = RatingFunction::heavy_edge;
     coarsening.rating.heavy_node_penalty_policy = HeavyNodePenaltyPolicy::no_penalty;
     coarsening.rating.acceptance_policy = AcceptancePolicy::best_prefer_unmatched;
+    coarsening.rating.vectorization_threshold = 0;
 
     // initial partitioning
     initial_partitioning.mode = Mode::recursive_bipartitioning;
@@ -729,10 +810,16 @@ namespace mt_kahypar {
     // preprocessing
     preprocessing.use_community_detection = true;
     preprocessing.disable_community_detection_for_mesh_graphs = true;
+    preprocessing.compress_incidence_arrays = false;
+    preprocessing.use_identical_vertex_reduction = false;
     preprocessing.community_detection.edge_weight_function = LouvainEdgeWeight::hybrid;
     preprocessing.community_detection.max_pass_iterations = 5;
     preprocessing.community_detection.min_vertex_move_fraction = 0.01;
     preprocessing.community_detection.vertex_degree_sampling_threshold = 200000;
+    preprocessing.community_detection.adaptive_skipping = false;
+    preprocessing.community_detection.min_clustering_coefficient = 0.05;
+    preprocessing.community_detection.min_modularity_gain = 0.1;
+    preprocessing.community_detection.min_modularity_gain_for_contraction = 0.3;
 
     // coarsening
     coarsening.algorithm = CoarseningAlgorithm::nlevel_coarsener;
@@ -742,11 +829,14 @@ namespace mt_kahypar {
     coarsening.max_allowed_weight_multiplier = 1.0;
     coarsening.contraction_limit_multiplier = 160;
     coarsening.vertex_degree_sampling_threshold = 200000;
+    coarsening.use_two_hop_clustering = false;
+    coarsening.two_hop_degree_threshold = 100;
 
     // coarsening -> rating
     coarsening.rating.rating_function = RatingFunction::heavy_edge;
     coarsening.rating.heavy_node_penalty_policy = HeavyNodePenaltyPolicy::no_penalty;
     coarsening.rating.acceptance_policy = AcceptancePolicy::best_prefer_unmatched;
+    coarsening.rating.vectorization_threshold = 0;
 
     // initial partitioning
     initial_partitioning.mode = Mode::recursive_bipartitioning;
@@ -868,10 +958,16 @@ namespace mt_kahypar {
     // preprocessing
     preprocessing.use_community_detection = true;
     preprocessing.disable_community_detection_for_mesh_graphs = true;
+    preprocessing.compress_incidence_arrays = false;
+    preprocessing.use_identical_vertex_reduction = false;
     preprocessing.community_detection.edge_weight_function = LouvainEdgeWeight::hybrid;
     preprocessing.community_detection.max_pass_iterations = 5;
     preprocessing.community_detection.min_vertex_move_fraction = 0.01;
     preprocessing.community_detection.vertex_degree_sampling_threshold = 200000;
+    preprocessing.community_detection.adaptive_skipping = false;
+    preprocessing.community_detection.min_clustering_coefficient = 0.05;
+    preprocessing.community_detection.min_modularity_gain = 0.1;
+    preprocessing.community_detection.min_modularity_gain_for_contraction = 0.3;
 
     // coarsening
     coarsening.algorithm = CoarseningAlgorithm::multilevel_coarsener;
@@ -882,11 +978,14 @@ namespace mt_kahypar {
     coarsening.contraction_limit_multiplier = 500;
     coarsening.deep_ml_contraction_limit_multiplier = 160;
     coarsening.vertex_degree_sampling_threshold = 200000;
+    coarsening.use_two_hop_clustering = false;
+    coarsening.two_hop_degree_threshold = 100;
 
     // coarsening -> rating
     coarsening.rating.rating_function = RatingFunction::heavy_edge;
     coarsening.rating.heavy_node_penalty_policy = HeavyNodePenaltyPolicy::no_penalty;
     coarsening.rating.acceptance_policy = AcceptancePolicy::best_prefer_unmatched;
+    coarsening.rating.vectorization_threshold = 0;
 
     // initial partitioning
     initial_partitioning.mode = Mode::direct;
@@ -926,7 +1025,16 @@ namespace mt_kahypar {
     refinement.label_propagation.hyperedge_size_activation_threshold = 100;
 
     // refinement -> fm
-    refinement.fm.algorithm = FMAlgorithm::do_nothing;
+    refinement.fm.algorithm = FMAlgorithm::kway_fm;
+    refinement.fm.multitry_rounds = 5;
+    refinement.fm.rollback_parallel = true;
+    refinement.fm.rollback_balance_violation_factor = 1.0;
+    refinement.fm.num_seed_nodes = 25;
+    refinement.fm.obey_minimal_parallelism = true;
+    refinement.fm.release_nodes = true;
+    refinement.fm.time_limit_factor = 0.25;
+    refinement.fm.min_improvement = -1;
+    refinement.fm.iter_moves_on_recalc = true;
 
     // refinement -> flows
     refinement.flows.algorithm = FlowAlgorithm::do_nothing;
@@ -27,6 +27,8 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 #include "mt-kahypar/utils/utilities.h"
@@ -51,6 +53,8 @@ struct PartitioningParameters {
   bool perform_parallel_recursion_in_deep_multilevel = true;
 
   int time_limit = 0;
+  // ! Memory budget in MB (0 = no memory budget)
+  size_t max_memory = 0;
   bool use_individual_part_weights = false;
   std::vector<HypernodeWeight> perfect_balance_part_weights;
   std::vector<HypernodeWeight> max_part_weights;
@@ -63,6 +67,8 @@ struct PartitioningParameters {
   bool show_detailed_timings = false;
   bool show_detailed_clustering_timings = false;
   bool measure_detailed_uncontraction_timings = false;
+  bool measure_perf_counters = false;
+  bool measure_peak_memory = false;
   size_t timings_output_depth = std::numeric_limits<size_t>::max();
   bool show_memory_consumption = false;
   bool show_advanced_cut_analysis = false;
@@ -78,6 +84,9 @@ struct PartitioningParameters {
   std::string graph_partition_filename { };
   std::string graph_community_filename { };
   std::string preset_file { };
+  std::string hierarchy_cache_file { };
+  std::string performance_report_file { };
+  std::string trace_file { };
 };
 
 std::ostream & operator<< (std::ostream& str, const PartitioningParameters& params);
@@ -89,6 +98,12 @@ struct CommunityDetectionParameters {
   long double min_vertex_move_fraction = std::numeric_limits<long double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
   size_t num_sub_rounds_deterministic = 16;
+  // ! Predicts from a sample of the input and the modularity gain of the first local moving
+  // ! round whether community detection is worth its running time
+  bool adaptive_skipping = false;
+  double min_clustering_coefficient = 0.05;
+  double min_modularity_gain = 0.1;
+  double min_modularity_gain_for_contraction = 0.3;
 };
 
 std::ostream & operator<< (std::ostream& str, const CommunityDetectionParameters& params);
@@ -97,6 +112,14 @@ struct PreprocessingParameters {
   bool stable_construction_of_incident_edges = false;
   bool use_community_detection = false;
   bool disable_community_detection_for_mesh_graphs = true;
+  // ! Relabels nodes and hyperedges of the input to improve the cache locality
+  RelabelingType relabeling = RelabelingType::none;
+  // ! Stores the incidence array and incident nets of the input hypergraph
+  // ! compressed during partitioning (only static hypergraphs)
+  bool compress_incidence_arrays = false;
+  // ! Collapses vertices with identical incident nets and identical nets of the
+  // ! input hypergraph before community detection and coarsening
+  bool use_identical_vertex_reduction = false;
   CommunityDetectionParameters community_detection = { };
 };
 
@@ -106,6 +129,7 @@ struct RatingParameters {
   RatingFunction rating_function = RatingFunction::UNDEFINED;
   HeavyNodePenaltyPolicy heavy_node_penalty_policy = HeavyNodePenaltyPolicy::UNDEFINED;
   AcceptancePolicy acceptance_policy = AcceptancePolicy::UNDEFINED;
+  size_t vectorization_threshold = std::numeric_limits<size_t>::max();
 };
 
 std::ostream & operator<< (std::ostream& str, const RatingParameters& params);
@@ -121,10 +145,14 @@ struct CoarseningParameters {
   double maximum_shrink_factor = std::numeric_limits<double>::max();
   size_t vertex_degree_sampling_threshold = std::numeric_limits<size_t>::max();
   size_t num_sub_rounds_deterministic = 16;
+  bool use_two_hop_clustering = false;
+  HypernodeID two_hop_degree_threshold = std::numeric_limits<HypernodeID>::max();
 
   // Those will be determined dynamically
   HypernodeWeight max_allowed_node_weight = 0;
   HypernodeID contraction_limit = 0;
+  // ! Enabled if the multilevel hierarchy does not fit into the memory budget (see memory_budget.h)
+  bool spill_fine_levels = false;
 };
 
 
@@ -158,6 +186,11 @@ struct FMParameters {
   mutable bool obey_minimal_parallelism = false;
   bool release_nodes = true;
 
+  // ! Priority queues used by the localized FM searches. The bucket queue falls back to
+  // ! the binary heap if the gains can exceed bucket_queue_max_gain in absolute value.
+  FMPriorityQueueType pq_type = FMPriorityQueueType::heap;
+  size_t bucket_queue_max_gain = 256;
+
   // unconstrained
   size_t unconstrained_rounds = 1;
   double treshold_border_node_inclusion = 0.75;
@@ -282,6 +315,9 @@ class Context {
   std::string algorithm_name = "Mt-KaHyPar";
   mutable size_t initial_km1 = std::numeric_limits<size_t>::max();
   size_t utility_id = std::numeric_limits<size_t>::max();
+  // ! Point in time at which partitioning started (used to enforce the global time limit).
+  // ! Copies of the context share the same start time and therefore the same deadline.
+  std::chrono::high_resolution_clock::time_point start_time = std::chrono::high_resolution_clock::now();
 
   Context(const bool register_utilities = true) {
     if ( register_utilities ) {
@@ -293,6 +329,13 @@ class Context {
 
   bool forceGainCacheUpdates() const;
 
+  // ! Starts the clock for the global time limit (partition.time_limit)
+  void startTimeLimit();
+
+  // ! Returns true, if a global time limit is set and partitioning exceeds it.
+  // ! In this case, all remaining refinement steps and V-cycles are skipped.
+  bool isTimeLimitExceeded() const;
+
   void setupPartWeights(const HypernodeWeight total_hypergraph_weight);
 
   void setupContractionLimit(const HypernodeWeight total_hypergraph_weight);
@@ -48,6 +48,7 @@ namespace mt_kahypar {
     switch (format) {
       case FileFormat::hMetis: return os << "hMetis";
       case FileFormat::Metis: return os << "Metis";
+      case FileFormat::Binary: return os << "Binary";
         // omit default case to trigger compiler warning for missing cases
     }
     return os << static_cast<uint8_t>(format);
@@ -129,6 +130,7 @@ namespace mt_kahypar {
       case GainPolicy::steiner_tree: return os << "steiner_tree";
       case GainPolicy::cut_for_graphs: return os << "cut_for_graphs";
       case GainPolicy::steiner_tree_for_graphs: return os << "steiner_tree_for_graphs";
+      case GainPolicy::sparse_km1: return os << "sparse_km1";
       case GainPolicy::none: return os << "none";
         // omit default case to trigger compiler warning for missing cases
     }
@@ -147,6 +149,17 @@ namespace mt_kahypar {
     return os << static_cast<uint8_t>(type);
   }
 
+  std::ostream & operator<< (std::ostream& os, const RelabelingType& type) {
+    switch (type) {
+      case RelabelingType::none: return os << "none";
+      case RelabelingType::bfs: return os << "bfs";
+      case RelabelingType::rcm: return os << "rcm";
+      case RelabelingType::degree: return os << "degree";
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return os << static_cast<uint8_t>(type);
+  }
+
   std::ostream & operator<< (std::ostream& os, const SimiliarNetCombinerStrategy& strategy) {
     switch (strategy) {
       case SimiliarNetCombinerStrategy::union_nets: return os << "union";
@@ -236,6 +249,15 @@ namespace mt_kahypar {
     return os << static_cast<uint8_t>(algo);
   }
 
+  std::ostream & operator<< (std::ostream& os, const FMPriorityQueueType& type) {
+    switch (type) {
+      case FMPriorityQueueType::heap: return os << "heap";
+      case FMPriorityQueueType::bucket_queue: return os << "bucket_queue";
+        // omit default case to trigger compiler warning for missing cases
+    }
+    return os << static_cast<uint8_t>(type);
+  }
+
   std::ostream & operator<< (std::ostream& os, const FlowAlgorithm& algo) {
     switch (algo) {
       case FlowAlgorithm::flow_cutter: return os << "flow_cutter";
@@ -343,6 +365,20 @@ namespace mt_kahypar {
     return LouvainEdgeWeight::UNDEFINED;
   }
 
+  RelabelingType relabelingTypeFromString(const std::string& type) {
+    if (type == "none") {
+      return RelabelingType::none;
+    } else if (type == "bfs") {
+      return RelabelingType::bfs;
+    } else if (type == "rcm") {
+      return RelabelingType::rcm;
+    } else if (type == "degree") {
+      return RelabelingType::degree;
+    }
+    throw InvalidParameterException("Illegal option: " + type);
+    return RelabelingType::none;
+  }
+
   SimiliarNetCombinerStrategy similiarNetCombinerStrategyFromString(const std::string& type) {
     if (type == "union") {
       return SimiliarNetCombinerStrategy::union_nets;
@@ -456,6 +492,16 @@ namespace mt_kahypar {
     return FMAlgorithm::do_nothing;
   }
 
+  FMPriorityQueueType fmPriorityQueueTypeFromString(const std::string& type) {
+    if (type == "heap") {
+      return FMPriorityQueueType::heap;
+    } else if (type == "bucket_queue") {
+      return FMPriorityQueueType::bucket_queue;
+    }
+    throw InvalidParameterException("Illegal option: " + type);
+    return FMPriorityQueueType::heap;
+  }
+
   FlowAlgorithm flowAlgorithmFromString(const std::string& type) {
     if (type == "flow_cutter") {
       return FlowAlgorithm::flow_cutter;
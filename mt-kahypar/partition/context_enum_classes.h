@@ -46,6 +46,7 @@ enum class Type : int8_t {
 enum class FileFormat : int8_t {
   hMetis = 0,
   Metis = 1,
+  Binary = 2,
 };
 
 enum class InstanceType : int8_t {
@@ -90,6 +91,7 @@ enum class GainPolicy : uint8_t {
   steiner_tree,
   cut_for_graphs,
   steiner_tree_for_graphs,
+  sparse_km1,
   none
 };
 
@@ -101,6 +103,13 @@ enum class LouvainEdgeWeight : uint8_t {
   UNDEFINED
 };
 
+enum class RelabelingType : uint8_t {
+  none,
+  bfs,
+  rcm,
+  degree
+};
+
 enum class SimiliarNetCombinerStrategy : uint8_t {
   union_nets,
   max_size,
@@ -159,6 +168,11 @@ enum class FMAlgorithm : uint8_t {
   do_nothing
 };
 
+enum class FMPriorityQueueType : uint8_t {
+  heap,
+  bucket_queue
+};
+
 enum class FlowAlgorithm : uint8_t {
   flow_cutter,
   mock,
@@ -202,6 +216,8 @@ std::ostream & operator<< (std::ostream& os, const GainPolicy& type);
 
 std::ostream & operator<< (std::ostream& os, const LouvainEdgeWeight& type);
 
+std::ostream & operator<< (std::ostream& os, const RelabelingType& type);
+
 std::ostream & operator<< (std::ostream& os, const SimiliarNetCombinerStrategy& strategy);
 
 std::ostream & operator<< (std::ostream& os, const CoarseningAlgorithm& algo);
@@ -218,6 +234,8 @@ std::ostream & operator<< (std::ostream& os, const LabelPropagationAlgorithm& al
 
 std::ostream & operator<< (std::ostream& os, const FMAlgorithm& algo);
 
+std::ostream & operator<< (std::ostream& os, const FMPriorityQueueType& type);
+
 std::ostream & operator<< (std::ostream& os, const FlowAlgorithm& algo);
 
 std::ostream & operator<< (std::ostream& os, const RebalancingAlgorithm& algo);
@@ -236,6 +254,8 @@ Objective objectiveFromString(const std::string& obj);
 
 LouvainEdgeWeight louvainEdgeWeightFromString(const std::string& type);
 
+RelabelingType relabelingTypeFromString(const std::string& type);
+
 SimiliarNetCombinerStrategy similiarNetCombinerStrategyFromString(const std::string& type);
 
 CoarseningAlgorithm coarseningAlgorithmFromString(const std::string& type);
@@ -252,6 +272,8 @@ LabelPropagationAlgorithm labelPropagationAlgorithmFromString(const std::string&
 
 FMAlgorithm fmAlgorithmFromString(const std::string& type);
 
+FMPriorityQueueType fmPriorityQueueTypeFromString(const std::string& type);
+
 FlowAlgorithm flowAlgorithmFromString(const std::string& type);
 
 RebalancingAlgorithm rebalancingAlgorithmFromString(const std::string& type);
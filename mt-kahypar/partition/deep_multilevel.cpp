@@ -265,6 +265,7 @@ bool disableTimerAndStats(const Context& context) {
     parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
     utils.getTimer(context.utility_id).disable();
     utils.getStats(context.utility_id).disable();
+    utils.getPerformanceLog(context.utility_id).disable();
   }
   return was_enabled_before;
 }
@@ -275,6 +276,7 @@ void enableTimerAndStats(const Context& context, const bool was_enabled_before)
     parallel::MemoryPool::instance().activate_unused_memory_allocations();
     utils.getTimer(context.utility_id).enable();
     utils.getStats(context.utility_id).enable();
+    utils.getPerformanceLog(context.utility_id).enable();
   }
 }
 
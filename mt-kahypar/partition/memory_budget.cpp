@@ -0,0 +1,234 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "memory_budget.h"
+
+#include <cmath>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/datastructures/connectivity_set.h"
+#include "mt-kahypar/parallel/memory_pool.h"
+#include "mt-kahypar/parallel/stl/tracked_scalable_allocator.h"
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
+#include "mt-kahypar/utils/memory_tree.h"
+#include "mt-kahypar/utils/exception.h"
+
+namespace mt_kahypar {
+namespace memory_budget {
+
+namespace {
+  static constexpr size_t MB = 1024 * 1024;
+
+  size_t toMB(const size_t bytes) {
+    return (bytes + MB - 1) / MB;
+  }
+
+  template<typename Hypergraph>
+  bool supportsSpilling(const Hypergraph& hypergraph, const Context& context) {
+    return ( Hypergraph::TYPE == STATIC_HYPERGRAPH || Hypergraph::TYPE == STATIC_GRAPH ) &&
+      context.partition.mode == Mode::direct &&
+      !context.isNLevelPartitioning() &&
+      !hypergraph.hasFixedVertices();
+  }
+
+  // ! Locality relabeling and identical vertex reduction partition a copy of the input
+  template<typename Hypergraph>
+  bool supportsCopies(const Hypergraph& hypergraph) {
+    return !hypergraph.hasFixedVertices() && hypergraph.numRemovedHypernodes() == 0;
+  }
+}
+
+template<typename Hypergraph>
+Estimate estimate(const Hypergraph& hypergraph, const Context& context) {
+  const size_t num_nodes = hypergraph.initialNumNodes();
+  const size_t num_edges = hypergraph.initialNumEdges();
+  const size_t num_pins = hypergraph.initialNumPins();
+  const size_t k = std::max(context.partition.k, 2);
+  // If the memory pool is initialized, the memory for preprocessing,
+  // coarsening and refinement is already allocated
+  const bool has_memory_pool = parallel::MemoryPool::instance().isInitialized();
+
+  utils::MemoryTreeNode hypergraph_memory("Hypergraph");
+  hypergraph.memoryConsumption(&hypergraph_memory);
+  hypergraph_memory.finalize();
+  const size_t hg_bytes = hypergraph_memory.sizeInBytes();
+
+  Estimate estimate;
+  // Without allocation tracking (see --measure-peak-memory), we only account for the input
+  // hypergraph. Allocations made before tracking is enabled are not reported (e.g., the input
+  // hypergraph when it is constructed via the library interface), but the input is always in memory.
+  estimate.used = std::max(parallel::AllocationTracker::isEnabled() ?
+    parallel::AllocationTracker::current() : 0, hg_bytes);
+
+  // The input and its copy are in memory at the same time, at least while the copy is
+  // constructed. The reduced hypergraph is at most as large as the input.
+  if ( supportsCopies(hypergraph) ) {
+    if ( context.preprocessing.relabeling != RelabelingType::none ) {
+      estimate.input_copies += hg_bytes;
+    }
+    if ( context.preprocessing.use_identical_vertex_reduction ) {
+      estimate.input_copies += hg_bytes;
+    }
+  }
+
+  if ( context.preprocessing.use_community_detection && !has_memory_pool ) {
+    // Star expansion graph used for community detection and its contraction buffers
+    const size_t num_star_nodes = num_nodes + (Hypergraph::is_graph ? 0 : num_edges);
+    const size_t num_star_edges = Hypergraph::is_graph ? num_pins : 2 * num_pins;
+    const size_t buffer_factor = context.preprocessing.community_detection.low_memory_contraction ? 1 : 2;
+    estimate.preprocessing = buffer_factor * ( num_star_nodes * ( sizeof(size_t) + sizeof(ArcWeight) ) +
+      num_star_edges * sizeof(Arc) ) + num_star_nodes * 2 * sizeof(HypernodeID);
+  }
+
+  // The size of the hypergraph roughly halves on each level of the hierarchy
+  size_t num_levels_nodes = num_nodes;
+  size_t level_bytes = hg_bytes;
+  size_t all_levels = 0;
+  size_t largest_levels = 0;
+  size_t num_levels = 0;
+  const size_t contraction_limit = std::max<size_t>(context.coarsening.contraction_limit, 1);
+  while ( num_levels_nodes > contraction_limit && level_bytes > 0 ) {
+    num_levels_nodes /= 2;
+    level_bytes /= 2;
+    all_levels += level_bytes;
+    if ( num_levels < 2 ) {
+      largest_levels += level_bytes;
+    }
+    ++num_levels;
+  }
+  // With spilling, only the two finest levels that are currently processed are in memory
+  estimate.hierarchy = context.coarsening.spill_fine_levels ? largest_levels : all_levels;
+  // Clustering, and temporary buffers of the contraction algorithm
+  estimate.coarsening = num_nodes * 3 * sizeof(HypernodeID) + ( has_memory_pool ? 0 : hg_bytes );
+
+  // Each thread partitions its own copy of the coarsest hypergraph
+  size_t num_ip_algos = 0;
+  for ( const bool enabled : context.initial_partitioning.enabled_ip_algos ) {
+    num_ip_algos += enabled;
+  }
+  num_ip_algos = std::max(num_ip_algos, UL(1));
+  const size_t num_ip_threads = std::min(context.shared_memory.num_threads,
+    std::max(context.initial_partitioning.runs, UL(1)) * num_ip_algos);
+  const double coarsest_fraction = std::min(1.0,
+    static_cast<double>(contraction_limit) / std::max(num_nodes, UL(1)));
+  estimate.initial_partitioning = num_ip_threads * 2 *
+    static_cast<size_t>(std::ceil(coarsest_fraction * hg_bytes));
+
+  if ( !has_memory_pool ) {
+    estimate.refinement = num_nodes * sizeof(PartitionID);
+    if ( Hypergraph::is_graph ) {
+      estimate.refinement += num_nodes * ( k + 1 ) * sizeof(HyperedgeWeight);
+    } else {
+      estimate.refinement +=
+        ds::PinCountInPart::num_elements(num_edges, k, hypergraph.maxEdgeSize()) *
+          sizeof(ds::PinCountInPart::Value) +
+        ds::ConnectivitySets::num_elements(num_edges, k) * sizeof(ds::ConnectivitySets::UnsafeBlock);
+      if ( context.refinement.fm.algorithm != FMAlgorithm::do_nothing ) {
+        estimate.refinement += context.partition.gain_policy == GainPolicy::sparse_km1 ?
+          SparseKm1GainCache::size_in_bytes(num_nodes, hypergraph.initialTotalVertexDegree(), k) :
+          num_nodes * ( k + 1 ) * sizeof(HyperedgeWeight);
+      }
+    }
+  }
+
+  if ( context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+    // Each flow problem contains a region around the cut of two blocks whose size
+    // is bounded by alpha * epsilon times the weight of a block
+    const size_t num_searches = std::max(context.refinement.flows.num_parallel_searches, UL(1));
+    const double region_fraction = std::min(1.0, 2.0 * context.refinement.flows.alpha *
+      context.partition.epsilon / k);
+    estimate.flows = num_searches * 2 * static_cast<size_t>(std::ceil(region_fraction * hg_bytes));
+  }
+
+  return estimate;
+}
+
+template<typename Hypergraph>
+void plan(const Hypergraph& hypergraph, Context& context) {
+  if ( context.partition.max_memory == 0 ) {
+    return;
+  }
+
+  const size_t budget = context.partition.max_memory * MB;
+  const bool verbose = context.partition.verbose_output && context.type == ContextType::main;
+  Estimate current = estimate(hypergraph, context);
+  if ( current.peak() <= budget ) {
+    return;
+  }
+
+  if ( current.input_copies > 0 ) {
+    context.preprocessing.relabeling = RelabelingType::none;
+    context.preprocessing.use_identical_vertex_reduction = false;
+    current = estimate(hypergraph, context);
+    if ( verbose ) {
+      LOG << "Memory budget: locality relabeling and identical vertex reduction are disabled";
+    }
+  }
+
+  if ( current.peak() > budget && supportsSpilling(hypergraph, context) ) {
+    context.coarsening.spill_fine_levels = true;
+    current = estimate(hypergraph, context);
+    if ( verbose ) {
+      LOG << "Memory budget: fine levels of the multilevel hierarchy are written to disk";
+    }
+  }
+
+  const size_t initial_runs = context.initial_partitioning.runs;
+  while ( current.peak() > budget && context.initial_partitioning.runs > 1 ) {
+    context.initial_partitioning.runs /= 2;
+    current = estimate(hypergraph, context);
+  }
+  if ( verbose && context.initial_partitioning.runs != initial_runs ) {
+    LOG << "Memory budget: reduced initial partitioning runs from" << initial_runs
+        << "to" << context.initial_partitioning.runs;
+  }
+
+  if ( current.peak() > budget && context.refinement.flows.algorithm != FlowAlgorithm::do_nothing ) {
+    context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+    current = estimate(hypergraph, context);
+    if ( verbose ) {
+      LOG << "Memory budget: flow-based refinement is disabled";
+    }
+  }
+
+  if ( current.peak() > budget ) {
+    throw InvalidParameterException(
+      "Memory budget of " + STR(context.partition.max_memory) + " MB is too small. "
+      "Partitioning the input requires at least " + STR(toMB(current.peak())) + " MB (estimated).");
+  }
+}
+
+namespace {
+#define ESTIMATE(X) Estimate estimate(const X& hypergraph, const Context& context)
+#define PLAN(X) void plan(const X& hypergraph, Context& context)
+}
+
+INSTANTIATE_FUNC_WITH_HYPERGRAPHS(ESTIMATE)
+INSTANTIATE_FUNC_WITH_HYPERGRAPHS(PLAN)
+
+}  // namespace memory_budget
+}  // namespace mt_kahypar
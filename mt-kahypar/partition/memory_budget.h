@@ -0,0 +1,77 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+namespace memory_budget {
+
+/*!
+ * Estimated memory requirements (in bytes) of the phases of the multilevel
+ * partitioning algorithm. The estimates are derived from the size of the input
+ * hypergraph and only include memory that is not allocated yet.
+ */
+struct Estimate {
+  // ! Memory allocated at the time of the estimation
+  size_t used = 0;
+  // ! Relabeled and reduced copies of the input hypergraph (alive until the end)
+  size_t input_copies = 0;
+  size_t preprocessing = 0;
+  size_t coarsening = 0;
+  // ! Levels of the multilevel hierarchy that are kept in memory
+  size_t hierarchy = 0;
+  size_t initial_partitioning = 0;
+  size_t refinement = 0;
+  size_t flows = 0;
+
+  // ! Memory of the most expensive phase (the hierarchy is alive from coarsening to refinement)
+  size_t peak() const {
+    return used + input_copies + std::max({ preprocessing,
+                             coarsening + hierarchy,
+                             hierarchy + initial_partitioning,
+                             hierarchy + refinement + flows });
+  }
+};
+
+template<typename Hypergraph>
+Estimate estimate(const Hypergraph& hypergraph, const Context& context);
+
+// ! Adapts the context such that the partitioner fits into the memory budget
+// ! (see context.partition.max_memory). In the following order, we
+// !  1.) partition the input instead of a relabeled or reduced copy,
+// !  2.) write the fine levels of the multilevel hierarchy to disk and reload them during uncoarsening,
+// !  3.) reduce the number of initial partitioning runs, and
+// !  4.) disable flow-based refinement.
+// ! Throws an InvalidParameterException if the memory budget cannot be met.
+template<typename Hypergraph>
+void plan(const Hypergraph& hypergraph, Context& context);
+
+}  // namespace memory_budget
+}  // namespace mt_kahypar
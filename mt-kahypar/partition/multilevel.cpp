@@ -35,6 +35,7 @@
 
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/partition/factories.h"
+#include "mt-kahypar/partition/metrics.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
 #include "mt-kahypar/partition/initial_partitioning/pool_initial_partitioner.h"
@@ -47,6 +48,7 @@
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/partition/coarsening/multilevel_uncoarsener.h"
 #include "mt-kahypar/partition/coarsening/nlevel_uncoarsener.h"
+#include "mt-kahypar/partition/coarsening/hierarchy_cache.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/utils/exception.h"
@@ -60,6 +62,7 @@ namespace {
       parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
       utils.getTimer(context.utility_id).disable();
       utils.getStats(context.utility_id).disable();
+      utils.getPerformanceLog(context.utility_id).disable();
     }
   }
 
@@ -69,25 +72,17 @@ namespace {
       parallel::MemoryPool::instance().activate_unused_memory_allocations();
       utils.getTimer(context.utility_id).enable();
       utils.getStats(context.utility_id).enable();
+      utils.getPerformanceLog(context.utility_id).enable();
     }
   }
 
   template<typename TypeTraits>
-  typename TypeTraits::PartitionedHypergraph multilevel_partitioning(
-    typename TypeTraits::Hypergraph& hypergraph,
-    const Context& context,
-    const TargetGraph* target_graph,
-    const bool is_vcycle) {
+  void coarsen(typename TypeTraits::Hypergraph& hypergraph,
+               UncoarseningData<TypeTraits>& uncoarseningData,
+               const Context& context) {
     using Hypergraph = typename TypeTraits::Hypergraph;
-    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
-    PartitionedHypergraph partitioned_hg;
-
-    // ################## COARSENING ##################
     mt_kahypar::io::printCoarseningBanner(context);
 
-    const bool nlevel = context.isNLevelPartitioning();
-    UncoarseningData<TypeTraits> uncoarseningData(nlevel, hypergraph, context);
-
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("coarsening", "Coarsening");
     {
@@ -104,11 +99,17 @@ namespace {
       }
     }
     timer.stop_timer("coarsening");
+  }
 
-    // ################## INITIAL PARTITIONING ##################
+  template<typename TypeTraits>
+  void initial_partitioning(typename TypeTraits::PartitionedHypergraph& phg,
+                            const Context& context,
+                            const TargetGraph* target_graph,
+                            const bool is_vcycle) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
     io::printInitialPartitioningBanner(context);
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("initial_partitioning", "Initial Partitioning");
-    PartitionedHypergraph& phg = uncoarseningData.coarsestPartitionedHypergraph();
 
     if ( !is_vcycle ) {
       DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
@@ -184,9 +185,17 @@ namespace {
         context.utility_id).printInitialPartitioningStats();
     }
     timer.stop_timer("initial_partitioning");
+  }
 
-    // ################## UNCOARSENING ##################
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph uncoarsen(
+    typename TypeTraits::Hypergraph& hypergraph,
+    UncoarseningData<TypeTraits>& uncoarseningData,
+    const Context& context,
+    const TargetGraph* target_graph) {
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
     io::printLocalSearchBanner(context);
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("refinement", "Refinement");
     std::unique_ptr<IUncoarsener<TypeTraits>> uncoarsener(nullptr);
     if (uncoarseningData.nlevel) {
@@ -196,20 +205,48 @@ namespace {
       uncoarsener = std::make_unique<MultilevelUncoarsener<TypeTraits>>(
         hypergraph, context, uncoarseningData, target_graph);
     }
-    partitioned_hg = uncoarsener->uncoarsen();
+    PartitionedHypergraph partitioned_hg = uncoarsener->uncoarsen();
 
     io::printPartitioningResults(partitioned_hg, context, "Local Search Results:");
     timer.stop_timer("refinement");
-
     return partitioned_hg;
   }
+
+  template<typename TypeTraits>
+  typename TypeTraits::PartitionedHypergraph multilevel_partitioning(
+    typename TypeTraits::Hypergraph& hypergraph,
+    const Context& context,
+    const TargetGraph* target_graph,
+    const bool is_vcycle,
+    HierarchyCache<TypeTraits>* hierarchy_cache = nullptr) {
+    // ################## COARSENING ##################
+    const bool nlevel = context.isNLevelPartitioning();
+    UncoarseningData<TypeTraits> uncoarseningData(nlevel, hypergraph, context);
+    if ( hierarchy_cache && hierarchy_cache->isLoaded() ) {
+      hierarchy_cache->moveHierarchy(uncoarseningData);
+    } else {
+      coarsen(hypergraph, uncoarseningData, context);
+      if ( hierarchy_cache ) {
+        // Must be stored before initial partitioning modifies the coarsest hypergraph
+        hierarchy_cache->store(hypergraph, uncoarseningData);
+      }
+    }
+
+    // ################## INITIAL PARTITIONING ##################
+    initial_partitioning<TypeTraits>(uncoarseningData.coarsestPartitionedHypergraph(),
+      context, target_graph, is_vcycle);
+
+    // ################## UNCOARSENING ##################
+    return uncoarsen(hypergraph, uncoarseningData, context, target_graph);
+  }
 }
 
 template<typename TypeTraits>
 typename Multilevel<TypeTraits>::PartitionedHypergraph Multilevel<TypeTraits>::partition(
-  Hypergraph& hypergraph, const Context& context, const TargetGraph* target_graph) {
-  PartitionedHypergraph partitioned_hg =
-    multilevel_partitioning<TypeTraits>(hypergraph, context, target_graph, false);
+  Hypergraph& hypergraph, const Context& context, const TargetGraph* target_graph,
+  HierarchyCache<TypeTraits>* hierarchy_cache) {
+  PartitionedHypergraph partitioned_hg = multilevel_partitioning<TypeTraits>(
+    hypergraph, context, target_graph, false, hierarchy_cache);
 
   // ################## V-CYCLES ##################
   if ( context.partition.num_vcycles > 0 && context.type == ContextType::main ) {
@@ -231,6 +268,34 @@ void Multilevel<TypeTraits>::partition(PartitionedHypergraph& partitioned_hg,
   partitioned_hg.initializePartition();
 }
 
+template<typename TypeTraits>
+vec<typename Multilevel<TypeTraits>::PartitionedHypergraph> Multilevel<TypeTraits>::partitionForMultipleK(
+  Hypergraph& hypergraph, const Context& coarsening_context, const vec<Context>& contexts) {
+  ASSERT(!coarsening_context.isNLevelPartitioning());
+
+  // ################## COARSENING ##################
+  // The hierarchy is computed only once and shared by all values of k
+  UncoarseningData<TypeTraits> uncoarseningData(false, hypergraph, coarsening_context);
+  coarsen(hypergraph, uncoarseningData, coarsening_context);
+
+  vec<PartitionedHypergraph> partitioned_hgs;
+  for ( const Context& context : contexts ) {
+    ASSERT(!context.isNLevelPartitioning());
+    if ( context.partition.verbose_output ) {
+      LOG << "\nCompute partition for k =" << context.partition.k;
+    }
+    uncoarseningData.resetPartitionedHypergraph(context.partition.k);
+
+    // ################## INITIAL PARTITIONING ##################
+    initial_partitioning<TypeTraits>(uncoarseningData.coarsestPartitionedHypergraph(),
+      context, nullptr, false);
+
+    // ################## UNCOARSENING ##################
+    partitioned_hgs.emplace_back(uncoarsen(hypergraph, uncoarseningData, context, nullptr));
+  }
+  return partitioned_hgs;
+}
+
 template<typename TypeTraits>
 void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
                                              PartitionedHypergraph& partitioned_hg,
@@ -239,6 +304,14 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
   ASSERT(context.partition.num_vcycles > 0);
 
   for ( size_t i = 0; i < context.partition.num_vcycles; ++i ) {
+    if ( context.isTimeLimitExceeded() ) {
+      if ( context.partition.verbose_output ) {
+        LOG << RED << "Time limit exceeded => skip remaining"
+            << (context.partition.num_vcycles - i) << "V-cycles" << END;
+      }
+      break;
+    }
+
     // Reset memory pool
     hypergraph.reset();
     parallel::MemoryPool::instance().reset();
@@ -258,10 +331,32 @@ void Multilevel<TypeTraits>::partitionVCycle(Hypergraph& hypergraph,
       hypergraph.setCommunityID(hn, partitioned_hg.partID(hn));
     });
 
+    const bool use_time_limit = context.partition.time_limit > 0;
+    const HyperedgeWeight quality_before = metrics::quality(partitioned_hg, context);
+    const bool balanced_before = use_time_limit && metrics::isBalanced(partitioned_hg, context);
+
     // Perform V-cycle
+    utils::PerformanceLog& performance_log =
+      utils::Utilities::instance().getPerformanceLog(context.utility_id);
+    performance_log.setVCycle(i + 1);
     io::printVCycleBanner(context, i + 1);
     partitioned_hg = multilevel_partitioning<TypeTraits>(
       hypergraph, context, target_graph, true /* V-cycle flag */ );
+
+    if ( use_time_limit && context.isTimeLimitExceeded() ) {
+      // The refinement of the V-cycle may have been skipped due to the time limit. In this case,
+      // we restore the partition of the previous V-cycle (stored as community IDs) if it is better.
+      const bool balanced_after = metrics::isBalanced(partitioned_hg, context);
+      if ( ( balanced_before && !balanced_after ) || ( balanced_before == balanced_after &&
+           metrics::quality(partitioned_hg, context) > quality_before ) ) {
+        partitioned_hg.resetPartition();
+        partitioned_hg.doParallelForAllNodes([&](const HypernodeID& hn) {
+          partitioned_hg.setOnlyNodePart(hn, hypergraph.communityID(hn));
+        });
+        partitioned_hg.initializePartition();
+      }
+    }
+    performance_log.addPhase("vcycle", quality_before, metrics::quality(partitioned_hg, context));
   }
 }
 
@@ -33,6 +33,8 @@ namespace mt_kahypar {
 
 // Forward Declaration
 class TargetGraph;
+template<typename TypeTraits>
+class HierarchyCache;
 
 template<typename TypeTraits>
 class Multilevel {
@@ -41,16 +43,26 @@ class Multilevel {
   using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
 
  public:
-  // ! Partitions a hypergraph using the multilevel paradigm.
+  // ! Partitions a hypergraph using the multilevel paradigm. If a hierarchy cache
+  // ! is passed, the multilevel hierarchy is loaded from it (if it was loaded before)
+  // ! or the computed hierarchy is stored in it.
   static PartitionedHypergraph partition(Hypergraph& hypergraph,
                                          const Context& context,
-                                         const TargetGraph* target_graph = nullptr);
+                                         const TargetGraph* target_graph = nullptr,
+                                         HierarchyCache<TypeTraits>* hierarchy_cache = nullptr);
 
   // ! Partitions a hypergraph using the multilevel paradigm.
   static void partition(PartitionedHypergraph& partitioned_hg,
                         const Context& context,
                         const TargetGraph* target_graph = nullptr);
 
+  // ! Computes one partition for each context (each specifying a different k).
+  // ! The multilevel hierarchy is only computed once with the coarsening context and
+  // ! is then reused for initial partitioning and refinement of each partition.
+  static vec<PartitionedHypergraph> partitionForMultipleK(Hypergraph& hypergraph,
+                                                          const Context& coarsening_context,
+                                                          const vec<Context>& contexts);
+
   // ! Improves an existing partition using the iterated multilevel cycle technique
   // ! (also called V-cycle).
   static void partitionVCycle(Hypergraph& hypergraph,
@@ -33,9 +33,13 @@
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/partition/multilevel.h"
+#include "mt-kahypar/partition/memory_budget.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/degree_zero_hn_remover.h"
 #include "mt-kahypar/partition/preprocessing/sparsification/large_he_remover.h"
+#include "mt-kahypar/partition/preprocessing/sparsification/identical_vertex_reduction.h"
 #include "mt-kahypar/partition/preprocessing/community_detection/parallel_louvain.h"
+#include "mt-kahypar/partition/preprocessing/relabeling/locality_relabeling.h"
+#include "mt-kahypar/partition/coarsening/hierarchy_cache.h"
 #include "mt-kahypar/partition/recursive_bipartitioning.h"
 #include "mt-kahypar/partition/deep_multilevel.h"
 #include "mt-kahypar/partition/mapping/target_graph.h"
@@ -43,6 +47,7 @@
 #include "mt-kahypar/partition/mapping/initial_mapping.h"
 #endif
 #include "mt-kahypar/utils/hypergraph_statistics.h"
+#include "mt-kahypar/utils/memory_sampler.h"
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/timer.h"
 #include "mt-kahypar/utils/exception.h"
@@ -52,6 +57,11 @@ namespace mt_kahypar {
 
   template<typename Hypergraph>
   void setupContext(Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
+    // The global time limit includes preprocessing
+    context.startTimeLimit();
+    if ( context.partition.measure_peak_memory ) {
+      utils::MemorySampler::instance().enable();
+    }
     if ( target_graph ) {
       context.partition.k = target_graph->numBlocks();
     }
@@ -136,6 +146,9 @@ namespace mt_kahypar {
           "Deep multilevel partitioning scheme does not support fixed vertices!");
       }
     }
+
+    // Choose cheaper algorithms if the partitioner does not fit into the memory budget
+    memory_budget::plan(hypergraph, context);
   }
 
   template<typename Hypergraph>
@@ -247,13 +260,56 @@ namespace mt_kahypar {
     }
   }
 
+  template<typename TypeTraits>
+  typename TypeTraits::Hypergraph relabel(const typename TypeTraits::Hypergraph& hypergraph,
+                                          LocalityRelabeling<TypeTraits>& relabeling,
+                                          const Context& context) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("locality_relabeling", "Locality Relabeling");
+    Hypergraph relabeled_hypergraph = relabeling.relabel(hypergraph);
+    timer.stop_timer("locality_relabeling");
+
+    if (context.partition.verbose_output) {
+      LOG << "Relabeled nodes and hyperedges with relabeling type" << context.preprocessing.relabeling;
+      LOG << " Average hyperedge span (max. pin ID - min. pin ID) changed from"
+          << LocalityRelabeling<TypeTraits>::averageEdgeSpan(hypergraph) << "to"
+          << LocalityRelabeling<TypeTraits>::averageEdgeSpan(relabeled_hypergraph);
+      io::printStripe();
+    }
+    return relabeled_hypergraph;
+  }
+
+  template<typename TypeTraits>
+  bool reduce(const typename TypeTraits::Hypergraph& hypergraph,
+              IdenticalVertexReduction<TypeTraits>& reduction,
+              typename TypeTraits::Hypergraph& reduced_hypergraph,
+              const Context& context) {
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("identical_vertex_reduction", "Identical Vertex Reduction");
+    const bool is_reduced = reduction.reduce(hypergraph, reduced_hypergraph);
+    timer.stop_timer("identical_vertex_reduction");
+
+    if (context.partition.verbose_output && is_reduced) {
+      LOG << "Performed identical vertex and net reduction:";
+      LOG << "\033[1m\033[31m" << " # collapsed"
+          << reduction.numRemovedNodes() << "vertices with identical incident nets" << "\033[0m";
+      LOG << "\033[1m\033[31m" << " # removed"
+          << reduction.numRemovedNets() << "identical nets" << "\033[0m";
+      io::printStripe();
+    }
+    return is_reduced;
+  }
+
   template<typename Hypergraph>
-  void preprocess(Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
-    bool use_community_detection = context.preprocessing.use_community_detection;
+  void preprocess(Hypergraph& hypergraph, Context& context, TargetGraph* target_graph,
+                  const bool detect_communities = true) {
+    // Community detection is skipped if the community IDs were loaded from a hierarchy cache
+    bool use_community_detection = detect_communities && context.preprocessing.use_community_detection;
     bool is_graph = false;
 
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
-    if ( context.preprocessing.use_community_detection ) {
+    if ( use_community_detection ) {
       timer.start_timer("detect_graph_structure", "Detect Graph Structure");
       is_graph = isGraph(hypergraph);
       if ( is_graph && context.preprocessing.disable_community_detection_for_mesh_graphs ) {
@@ -262,6 +318,39 @@ namespace mt_kahypar {
       timer.stop_timer("detect_graph_structure");
     }
 
+    // A sample of the input predicts whether community detection is worth its running time
+    const bool use_adaptive_skipping = use_community_detection &&
+      context.preprocessing.community_detection.adaptive_skipping;
+    community_detection::CommunityDetectionDecision decision =
+      community_detection::CommunityDetectionDecision::full;
+    double prediction_time = 0.0;
+    double estimated_time_saved = 0.0;
+    if ( use_adaptive_skipping ) {
+      timer.start_timer("predict_community_structure", "Predict Community Structure");
+      const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+      const community_detection::SampledGraphStructure structure =
+        community_detection::sampleGraphStructure(hypergraph, context);
+      decision = community_detection::predictFromSample(structure, context);
+      prediction_time = std::chrono::duration<double>(
+        std::chrono::high_resolution_clock::now() - start).count();
+      timer.stop_timer("predict_community_structure");
+      if ( decision == community_detection::CommunityDetectionDecision::skip &&
+           structure.num_scanned_pins > 0 ) {
+        // Constructing the graph for community detection scans all pins at least once.
+        // We extrapolate the time of this scan from the time of the sampling.
+        estimated_time_saved = prediction_time *
+          static_cast<double>(hypergraph.initialNumPins()) / structure.num_scanned_pins;
+      }
+      utils::Stats& stats = utils::Utilities::instance().getStats(context.utility_id);
+      stats.add_stat("sampled_degree_variation", structure.degree_variation);
+      stats.add_stat("sampled_clustering_coefficient", structure.clustering_coefficient);
+      if ( context.partition.verbose_output ) {
+        LOG << "Sampled degree variation =" << structure.degree_variation
+            << ", sampled clustering coefficient =" << structure.clustering_coefficient;
+      }
+      use_community_detection = decision != community_detection::CommunityDetectionDecision::skip;
+    }
+
     if ( use_community_detection ) {
       io::printTopLevelPreprocessingBanner(context);
 
@@ -274,22 +363,97 @@ namespace mt_kahypar {
       }
       timer.stop_timer("construct_graph");
       timer.start_timer("perform_community_detection", "Perform Community Detection");
-      ds::Clustering communities = community_detection::run_parallel_louvain(graph, context);
-      graph.restrictClusteringToHypernodes(hypergraph, communities);
-      hypergraph.setCommunityIDs(std::move(communities));
+      ds::Clustering communities = use_adaptive_skipping ?
+        community_detection::run_adaptive_parallel_louvain(graph, context, decision, estimated_time_saved) :
+        community_detection::run_parallel_louvain(graph, context);
+      if ( decision != community_detection::CommunityDetectionDecision::skip ) {
+        graph.restrictClusteringToHypernodes(hypergraph, communities);
+        hypergraph.setCommunityIDs(std::move(communities));
+      }
       timer.stop_timer("perform_community_detection");
       timer.stop_timer("community_detection");
 
-      if (context.partition.verbose_output) {
+      if (context.partition.verbose_output && decision != community_detection::CommunityDetectionDecision::skip) {
         io::printCommunityInformation(hypergraph);
       }
     }
 
+    if ( use_adaptive_skipping ) {
+      // The saved time is estimated from the running time of the steps that were
+      // executed, since the skipped steps cannot be measured within the same run
+      utils::Stats& stats = utils::Utilities::instance().getStats(context.utility_id);
+      stats.add_stat("community_detection_decision", static_cast<int32_t>(decision));
+      stats.add_stat("community_detection_prediction_time", prediction_time);
+      stats.add_stat("community_detection_estimated_time_saved", estimated_time_saved);
+      if ( context.partition.verbose_output ) {
+        LOG << "Community detection decision:" << decision << "( prediction took"
+            << prediction_time << "s, estimated time saved:" << estimated_time_saved << "s )";
+        io::printStripe();
+      }
+    }
+
     precomputeSteinerTrees(hypergraph, target_graph, context);
 
     parallel::MemoryPool::instance().release_mem_group("Preprocessing");
   }
 
+  template<typename Hypergraph>
+  void compressIncidenceArrays(Hypergraph& hypergraph, const Context& context) {
+    if constexpr ( Hypergraph::TYPE == STATIC_HYPERGRAPH ) {
+      if ( context.preprocessing.compress_incidence_arrays ) {
+        utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+        timer.start_timer("compress_incidence_arrays", "Compress Incidence Arrays");
+        hypergraph.compress();
+        timer.stop_timer("compress_incidence_arrays");
+      }
+    } else {
+      unused(hypergraph);
+      unused(context);
+    }
+  }
+
+  template<typename Hypergraph>
+  void decompressIncidenceArrays(Hypergraph& hypergraph, const Context& context) {
+    if constexpr ( Hypergraph::TYPE == STATIC_HYPERGRAPH ) {
+      if ( hypergraph.isCompressed() ) {
+        utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+        timer.start_timer("decompress_incidence_arrays", "Decompress Incidence Arrays");
+        hypergraph.decompress();
+        timer.stop_timer("decompress_incidence_arrays");
+      }
+    } else {
+      unused(hypergraph);
+      unused(context);
+    }
+  }
+
+  void reportTimeLimit(const Context& context) {
+    if ( context.isTimeLimitExceeded() ) {
+      utils::Utilities::instance().getStats(context.utility_id).add_stat("time_limit_exceeded", true);
+      if ( context.partition.verbose_output ) {
+        LOG << RED << "Time limit of" << context.partition.time_limit
+            << "s exceeded => remaining refinement steps and V-cycles were skipped" << END;
+      }
+    }
+  }
+
+  // ! Reports the total time for partitioning a hypergraph for multiple values of k
+  // ! and the time per k amortized over all values of k
+  void reportMultipleKTime(const Context& context,
+                           const size_t num_ks,
+                           const std::chrono::high_resolution_clock::time_point& start) {
+    const double elapsed_time = std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - start).count();
+    const double time_per_k = elapsed_time / num_ks;
+    utils::Stats& stats = utils::Utilities::instance().getStats(context.utility_id);
+    stats.add_stat("multiple_k_total_time", elapsed_time);
+    stats.add_stat("multiple_k_amortized_time_per_k", time_per_k);
+    if ( context.partition.verbose_output ) {
+      LOG << "Partitioned for" << num_ks << "values of k in" << elapsed_time
+          << "s (amortized" << time_per_k << "s per k)";
+    }
+  }
+
   template<typename PartitionedHypergraph>
   void forceFixedVertexAssignment(PartitionedHypergraph& partitioned_hg,
                                   const Context& context) {
@@ -318,13 +482,13 @@ namespace mt_kahypar {
 
   template<typename TypeTraits>
   typename Partitioner<TypeTraits>::PartitionedHypergraph Partitioner<TypeTraits>::partition(
-    Hypergraph& hypergraph, Context& context, TargetGraph* target_graph) {
-    configurePreprocessing(hypergraph, context);
-    setupContext(hypergraph, context, target_graph);
+    Hypergraph& input_hypergraph, Context& context, TargetGraph* target_graph) {
+    configurePreprocessing(input_hypergraph, context);
+    setupContext(input_hypergraph, context, target_graph);
 
     io::printContext(context);
     io::printMemoryPoolConsumption(context);
-    io::printInputInformation(context, hypergraph);
+    io::printInputInformation(context, input_hypergraph);
 
     #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
     bool map_partition_to_target_graph_at_the_end = false;
@@ -339,16 +503,48 @@ namespace mt_kahypar {
     // ################## PREPROCESSING ##################
     utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
     timer.start_timer("preprocessing", "Preprocessing");
+    // If relabeling is enabled, we partition a relabeled copy of the input hypergraph
+    // and project the partition back to the input hypergraph at the end.
+    LocalityRelabeling<TypeTraits> relabeling(context);
+    const bool use_relabeling = relabeling.isApplicable(input_hypergraph);
+    Hypergraph relabeled_hypergraph;
+    bool is_input_released = false;
+    if ( use_relabeling ) {
+      relabeled_hypergraph = relabel(input_hypergraph, relabeling, context);
+      // The input hypergraph is only needed to project the partition back. Thus, we release
+      // it while partitioning and rebuild it from the relabeled copy in the postprocessing phase.
+      if ( relabeling.isRestorable() ) {
+        input_hypergraph = Hypergraph();
+        is_input_released = true;
+      }
+    }
+    Hypergraph& unreduced_hypergraph = use_relabeling ? relabeled_hypergraph : input_hypergraph;
+    // If enabled, we partition a copy of the hypergraph in which twins and identical nets
+    // are collapsed and project the partition back in the postprocessing phase.
+    IdenticalVertexReduction<TypeTraits> identical_vertex_reduction(context);
+    Hypergraph reduced_hypergraph;
+    const bool use_reduction = identical_vertex_reduction.isApplicable(unreduced_hypergraph) &&
+      reduce(unreduced_hypergraph, identical_vertex_reduction, reduced_hypergraph, context);
+    Hypergraph& hypergraph = use_reduction ? reduced_hypergraph : unreduced_hypergraph;
     DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(context);
     LargeHyperedgeRemover<TypeTraits> large_he_remover(context);
-    preprocess(hypergraph, context, target_graph);
+    // If a hierarchy cache for this input exists, community detection and coarsening are skipped
+    HierarchyCache<TypeTraits> hierarchy_cache(context);
+    const bool use_hierarchy_cache = hierarchy_cache.isApplicable(hypergraph);
+    if ( use_hierarchy_cache && hierarchy_cache.load(hypergraph) ) {
+      hierarchy_cache.applyCommunities(hypergraph);
+    }
+    preprocess(hypergraph, context, target_graph, !hierarchy_cache.isLoaded());
     sanitize(hypergraph, context, degree_zero_hn_remover, large_he_remover);
+    // The input hypergraph is not modified until postprocessing
+    compressIncidenceArrays(hypergraph, context);
     timer.stop_timer("preprocessing");
 
     // ################## MULTILEVEL & VCYCLE ##################
     PartitionedHypergraph partitioned_hypergraph;
     if (context.partition.mode == Mode::direct) {
-      partitioned_hypergraph = Multilevel<TypeTraits>::partition(hypergraph, context, target_graph);
+      partitioned_hypergraph = Multilevel<TypeTraits>::partition(hypergraph, context, target_graph,
+        use_hierarchy_cache ? &hierarchy_cache : nullptr);
     } else if (context.partition.mode == Mode::recursive_bipartitioning) {
       partitioned_hypergraph = RecursiveBipartitioning<TypeTraits>::partition(hypergraph, context, target_graph);
     } else if (context.partition.mode == Mode::deep_multilevel) {
@@ -375,9 +571,31 @@ namespace mt_kahypar {
 
     // ################## POSTPROCESSING ##################
     timer.start_timer("postprocessing", "Postprocessing");
+    decompressIncidenceArrays(hypergraph, context);
     large_he_remover.restoreLargeHyperedges(partitioned_hypergraph);
     degree_zero_hn_remover.restoreDegreeZeroHypernodes(partitioned_hypergraph);
     forceFixedVertexAssignment(partitioned_hypergraph, context);
+    if ( use_reduction ) {
+      timer.start_timer("project_reduced_partition", "Project Reduced Partition");
+      PartitionedHypergraph unreduced_partitioned_hypergraph(
+        context.partition.k, unreduced_hypergraph, parallel_tag_t { });
+      unreduced_partitioned_hypergraph.setTargetGraph(partitioned_hypergraph.targetGraph());
+      identical_vertex_reduction.projectPartition(partitioned_hypergraph, unreduced_partitioned_hypergraph);
+      partitioned_hypergraph = std::move(unreduced_partitioned_hypergraph);
+      timer.stop_timer("project_reduced_partition");
+    }
+    if ( use_relabeling ) {
+      timer.start_timer("project_relabeled_partition", "Project Relabeled Partition");
+      if ( is_input_released ) {
+        input_hypergraph = relabeling.restore(relabeled_hypergraph);
+      }
+      PartitionedHypergraph input_partitioned_hypergraph(
+        context.partition.k, input_hypergraph, parallel_tag_t { });
+      input_partitioned_hypergraph.setTargetGraph(partitioned_hypergraph.targetGraph());
+      relabeling.projectPartition(partitioned_hypergraph, input_partitioned_hypergraph);
+      partitioned_hypergraph = std::move(input_partitioned_hypergraph);
+      timer.stop_timer("project_relabeled_partition");
+    }
     timer.stop_timer("postprocessing");
 
     #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
@@ -391,6 +609,7 @@ namespace mt_kahypar {
     }
     #endif
 
+    reportTimeLimit(context);
     if (context.partition.verbose_output) {
       io::printHypergraphInfo(partitioned_hypergraph.hypergraph(), context,
         "Uncoarsened Hypergraph", context.partition.show_memory_consumption);
@@ -401,6 +620,103 @@ namespace mt_kahypar {
   }
 
 
+  template<typename TypeTraits>
+  vec<typename Partitioner<TypeTraits>::PartitionedHypergraph> Partitioner<TypeTraits>::partitionForMultipleK(
+    Hypergraph& hypergraph, const vec<PartitionID>& ks, Context& context) {
+    if ( ks.empty() ) {
+      throw InvalidParameterException("No number of blocks specified!");
+    }
+    for ( const PartitionID k : ks ) {
+      if ( k < 2 ) {
+        throw InvalidParameterException("Number of blocks must be at least two!");
+      }
+    }
+    if ( context.partition.objective == Objective::steiner_tree ) {
+      throw NonSupportedOperationException(
+        "Partitioning for multiple values of k is not supported for the steiner tree metric!");
+    }
+    if ( context.partition.use_individual_part_weights ) {
+      throw NonSupportedOperationException(
+        "Partitioning for multiple values of k does not support individual part weights!");
+    }
+    if ( hypergraph.hasFixedVertices() ) {
+      throw NonSupportedOperationException(
+        "Partitioning for multiple values of k does not support fixed vertices!");
+    }
+
+    const auto start = std::chrono::high_resolution_clock::now();
+    vec<PartitionedHypergraph> partitioned_hypergraphs;
+    if ( context.partition.mode != Mode::direct || context.isNLevelPartitioning() ) {
+      // The multilevel hierarchy can only be reused in multilevel mode.
+      // Otherwise, we partition the hypergraph independently for each k.
+      // Note that partition(...) may release the input hypergraph while partitioning its
+      // relabeled copy. The partitions computed so far are not accessed in the meantime and
+      // the hypergraph is rebuilt with the same IDs before partition(...) returns.
+      for ( const PartitionID k : ks ) {
+        Context k_context(context);
+        k_context.partition.k = k;
+        partitioned_hypergraphs.emplace_back(partition(hypergraph, k_context));
+      }
+      reportMultipleKTime(context, ks.size(), start);
+      return partitioned_hypergraphs;
+    }
+
+    configurePreprocessing(hypergraph, context);
+    vec<Context> contexts(ks.size(), context);
+    size_t max_k_idx = 0;
+    for ( size_t i = 0; i < ks.size(); ++i ) {
+      contexts[i].partition.k = ks[i];
+      setupContext(hypergraph, contexts[i], nullptr);
+      if ( ks[i] > ks[max_k_idx] ) {
+        max_k_idx = i;
+      }
+    }
+    // The hierarchy is coarsened down to the contraction limit of the largest k
+    // (with its maximum allowed node weight). The initial partitioning algorithms
+    // for smaller values of k coarsen the coarsest hypergraph further if necessary.
+    Context& coarsening_context = contexts[max_k_idx];
+
+    io::printContext(coarsening_context);
+    io::printMemoryPoolConsumption(coarsening_context);
+    io::printInputInformation(coarsening_context, hypergraph);
+
+    // ################## PREPROCESSING ##################
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("preprocessing", "Preprocessing");
+    DegreeZeroHypernodeRemover<TypeTraits> degree_zero_hn_remover(coarsening_context);
+    LargeHyperedgeRemover<TypeTraits> large_he_remover(coarsening_context);
+    preprocess(hypergraph, coarsening_context, nullptr);
+    sanitize(hypergraph, coarsening_context, degree_zero_hn_remover, large_he_remover);
+    timer.stop_timer("preprocessing");
+
+    // ################## MULTILEVEL ##################
+    partitioned_hypergraphs = Multilevel<TypeTraits>::partitionForMultipleK(
+      hypergraph, coarsening_context, contexts);
+
+    // ################## POSTPROCESSING ##################
+    // All partitions share the input hypergraph. Thus, the removed hyperedges and
+    // vertices are restored only once in the hypergraph after the last partition is
+    // computed. Afterwards, they are added to each partition.
+    timer.start_timer("postprocessing", "Postprocessing");
+    large_he_remover.restoreLargeHyperedges(hypergraph);
+    degree_zero_hn_remover.restoreDegreeZeroHypernodes(hypergraph);
+    for ( size_t i = 0; i < partitioned_hypergraphs.size(); ++i ) {
+      large_he_remover.initializeRestoredLargeHyperedges(partitioned_hypergraphs[i]);
+      degree_zero_hn_remover.assignRestoredDegreeZeroHypernodes(partitioned_hypergraphs[i], contexts[i]);
+    }
+    timer.stop_timer("postprocessing");
+
+    reportMultipleKTime(context, ks.size(), start);
+    reportTimeLimit(coarsening_context);
+    if (context.partition.verbose_output) {
+      io::printHypergraphInfo(hypergraph, context,
+        "Uncoarsened Hypergraph", context.partition.show_memory_consumption);
+      io::printStripe();
+    }
+
+    return partitioned_hypergraphs;
+  }
+
   template<typename TypeTraits>
   void Partitioner<TypeTraits>::partitionVCycle(PartitionedHypergraph& partitioned_hg,
                                                 Context& context,
@@ -442,6 +758,7 @@ namespace mt_kahypar {
     forceFixedVertexAssignment(partitioned_hg, context);
     timer.stop_timer("postprocessing");
 
+    reportTimeLimit(context);
     if (context.partition.verbose_output) {
       io::printHypergraphInfo(partitioned_hg.hypergraph(), context,
         "Uncoarsened Hypergraph", context.partition.show_memory_consumption);
@@ -45,6 +45,12 @@ class Partitioner {
                                          Context& context,
                                          TargetGraph* target_graph = nullptr);
 
+  // ! Partitions the hypergraph once for each number of blocks in ks. Preprocessing
+  // ! and coarsening are only performed once in multilevel mode.
+  static vec<PartitionedHypergraph> partitionForMultipleK(Hypergraph& hypergraph,
+                                                          const vec<PartitionID>& ks,
+                                                          Context& context);
+
   static void partitionVCycle(PartitionedHypergraph& partitioned_hg,
                               Context& context,
                               TargetGraph* target_graph = nullptr);
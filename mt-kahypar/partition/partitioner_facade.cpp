@@ -32,6 +32,7 @@
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/io/csv_output.h"
+#include "mt-kahypar/io/json_output.h"
 #include "mt-kahypar/io/sql_plottools_serializer.h"
 #include "mt-kahypar/utils/cast.h"
 #include "mt-kahypar/utils/randomize.h"
@@ -59,6 +60,27 @@ namespace internal {
         new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE };
   }
 
+  template<typename TypeTraits>
+  vec<mt_kahypar_partitioned_hypergraph_t> partitionForMultipleK(mt_kahypar_hypergraph_t hypergraph,
+                                                                 Context& context,
+                                                                 const vec<PartitionID>& ks) {
+    using Hypergraph = typename TypeTraits::Hypergraph;
+    using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+    Hypergraph& hg = utils::cast<Hypergraph>(hypergraph);
+
+    // Partition Hypergraph
+    vec<PartitionedHypergraph> partitioned_hgs =
+      Partitioner<TypeTraits>::partitionForMultipleK(hg, ks, context);
+
+    vec<mt_kahypar_partitioned_hypergraph_t> result;
+    for ( PartitionedHypergraph& partitioned_hg : partitioned_hgs ) {
+      result.push_back(mt_kahypar_partitioned_hypergraph_t {
+        reinterpret_cast<mt_kahypar_partitioned_hypergraph_s*>(
+          new PartitionedHypergraph(std::move(partitioned_hg))), PartitionedHypergraph::TYPE });
+    }
+    return result;
+  }
+
   template<typename TypeTraits>
   void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                Context& context,
@@ -129,6 +151,37 @@ namespace internal {
   }
 
 
+  vec<mt_kahypar_partitioned_hypergraph_t> PartitionerFacade::partitionForMultipleK(mt_kahypar_hypergraph_t hypergraph,
+                                                                                    Context& context,
+                                                                                    const vec<PartitionID>& ks) {
+    const mt_kahypar_partition_type_t type = to_partition_c_type(
+      context.partition.preset_type, context.partition.instance_type);
+    internal::check_if_feature_is_enabled(type);
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<StaticGraphTypeTraits>(hypergraph, context, ks);
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<StaticHypergraphTypeTraits>(hypergraph, context, ks);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return internal::partitionForMultipleK<LargeKHypergraphTypeTraits>(hypergraph, context, ks);
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<DynamicGraphTypeTraits>(hypergraph, context, ks);
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        return internal::partitionForMultipleK<DynamicHypergraphTypeTraits>(hypergraph, context, ks);
+      #endif
+      default:
+        return { };
+    }
+    return { };
+  }
+
   void PartitionerFacade::improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                                   Context& context,
                                   TargetGraph* target_graph) {
@@ -219,6 +272,35 @@ namespace internal {
     return "";
   }
 
+  std::string PartitionerFacade::serializeJSON(const mt_kahypar_partitioned_hypergraph_t phg,
+                                               const Context& context,
+                                               const std::chrono::duration<double>& elapsed_seconds) {
+    const mt_kahypar_partition_type_t type = phg.type;
+    switch ( type ) {
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case MULTILEVEL_GRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<StaticPartitionedGraph>(phg), context, elapsed_seconds);
+        break;
+      #endif
+      case MULTILEVEL_HYPERGRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<StaticPartitionedHypergraph>(phg), context, elapsed_seconds);
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+      case LARGE_K_PARTITIONING:
+        return io::json::serialize(utils::cast_const<StaticSparsePartitionedHypergraph>(phg), context, elapsed_seconds);
+      #endif
+      #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
+      #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+      case N_LEVEL_GRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<DynamicPartitionedGraph>(phg), context, elapsed_seconds);
+      #endif
+      case N_LEVEL_HYPERGRAPH_PARTITIONING:
+        return io::json::serialize(utils::cast_const<DynamicPartitionedHypergraph>(phg), context, elapsed_seconds);
+      #endif
+      default: return "";
+    }
+    return "";
+  }
+
   std::string PartitionerFacade::serializeResultLine(const mt_kahypar_partitioned_hypergraph_t phg,
                                                      const Context& context,
                                                      const std::chrono::duration<double>& elapsed_seconds) {
@@ -43,6 +43,11 @@ class PartitionerFacade {
                                                        Context& context,
                                                        TargetGraph* target_graph = nullptr);
 
+  // ! Partition the hypergraph for each number of blocks in ks (reuses the multilevel hierarchy)
+  static vec<mt_kahypar_partitioned_hypergraph_t> partitionForMultipleK(mt_kahypar_hypergraph_t hypergraph,
+                                                                        Context& context,
+                                                                        const vec<PartitionID>& ks);
+
   // ! Improves a given partition
   static void improve(mt_kahypar_partitioned_hypergraph_t partitioned_hg,
                       Context& context,
@@ -58,6 +63,12 @@ class PartitionerFacade {
                                   const Context& context,
                                   const std::chrono::duration<double>& elapsed_seconds);
 
+  // ! Serializes metrics, timings, stats, per-level statistics, memory consumption
+  // ! and the context as JSON document
+  static std::string serializeJSON(const mt_kahypar_partitioned_hypergraph_t phg,
+                                   const Context& context,
+                                   const std::chrono::duration<double>& elapsed_seconds);
+
   // ! Prints timings and metrics as a RESULT line parsable by SQL Plot Tools
   // ! https://github.com/bingmann/sqlplot-tools
   static std::string serializeResultLine(const mt_kahypar_partitioned_hypergraph_t phg,
@@ -0,0 +1,229 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar::community_detection {
+
+enum class CommunityDetectionDecision : uint8_t {
+  // ! Run all levels of the louvain method
+  full,
+  // ! Use the communities of the first level of the louvain method
+  single_level,
+  // ! Do not use community detection
+  skip
+};
+
+inline std::ostream & operator<< (std::ostream& os, const CommunityDetectionDecision& decision) {
+  switch (decision) {
+    case CommunityDetectionDecision::full: return os << "full";
+    case CommunityDetectionDecision::single_level: return os << "single_level";
+    case CommunityDetectionDecision::skip: return os << "skip";
+      // omit default case to trigger compiler warning for missing cases
+  }
+  return os << static_cast<uint8_t>(decision);
+}
+
+struct SampledGraphStructure {
+  double avg_degree = 0.0;
+  // ! Standard deviation of the vertex degrees divided by the average degree
+  double degree_variation = 0.0;
+  // ! Average local clustering coefficient of the sampled vertices
+  double clustering_coefficient = 0.0;
+  // ! Number of pins visited while sampling (used to extrapolate the saved time)
+  size_t num_scanned_pins = 0;
+};
+
+// ! Inputs with a degree variation below this value have a mesh-like degree distribution
+static constexpr double MESH_DEGREE_VARIATION = 0.5;
+static constexpr size_t SAMPLE_SIZE = 1000;
+static constexpr size_t MAX_SAMPLED_NEIGHBORS = 32;
+// ! Maximum number of incident nets scanned per sampled vertex and per sampled neighbor
+static constexpr size_t MAX_SCANNED_NETS = 64;
+// ! Neighbors with a larger degree (hubs) are not sampled
+static constexpr HyperedgeID MAX_NEIGHBOR_DEGREE = 1000;
+
+/*!
+ * Estimates the degree distribution and the clustering coefficient of the hypergraph
+ * on a random sample of its vertices. The local clustering coefficient of a vertex v
+ * is the fraction of pairs of its (at most MAX_SAMPLED_NEIGHBORS randomly chosen)
+ * neighbors that share a net not containing v. For graphs, this is the usual fraction
+ * of closed triangles. To bound the running time, only the first MAX_SCANNED_NETS
+ * incident nets of each vertex are scanned and hubs are not sampled as neighbors.
+ */
+template<typename Hypergraph>
+SampledGraphStructure sampleGraphStructure(const Hypergraph& hypergraph, const Context& context) {
+  const HypernodeID num_nodes = hypergraph.initialNumNodes();
+  vec<HypernodeID> sample;
+  if ( num_nodes <= SAMPLE_SIZE ) {
+    for ( const HypernodeID& hn : hypergraph.nodes() ) {
+      sample.push_back(hn);
+    }
+  } else {
+    std::mt19937 prng(context.partition.seed);
+    std::uniform_int_distribution<HypernodeID> distribution(0, num_nodes - 1);
+    for ( size_t i = 0; i < SAMPLE_SIZE; ++i ) {
+      const HypernodeID hn = distribution(prng);
+      if ( hypergraph.nodeIsEnabled(hn) ) {
+        sample.push_back(hn);
+      }
+    }
+  }
+
+  const HypernodeID max_edge_size = context.partition.ignore_hyperedge_size_threshold;
+  vec<double> degree(sample.size(), 0.0);
+  vec<double> clustering_coefficient(sample.size(), -1.0);
+  vec<size_t> num_scanned_pins(sample.size(), 0);
+  // ! Calls f for each of the first MAX_SCANNED_NETS incident nets of u that are not ignored
+  // ! and counts their pins towards the i-th sampled vertex
+  auto for_each_scanned_net = [&](const size_t i, const HypernodeID u, const auto& f) {
+    size_t num_scanned_nets = 0;
+    for ( const HyperedgeID& he : hypergraph.incidentEdges(u) ) {
+      if ( num_scanned_nets == MAX_SCANNED_NETS ) {
+        break;
+      }
+      if ( hypergraph.edgeIsEnabled(he) && hypergraph.edgeSize(he) <= max_edge_size ) {
+        f(he);
+        num_scanned_pins[i] += hypergraph.edgeSize(he);
+        ++num_scanned_nets;
+      }
+    }
+  };
+
+  tbb::parallel_for(UL(0), sample.size(), [&](const size_t i) {
+    const HypernodeID v = sample[i];
+    degree[i] = hypergraph.nodeDegree(v);
+
+    vec<HypernodeID> neighbors;
+    for_each_scanned_net(i, v, [&](const HyperedgeID he) {
+      for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+        if ( pin != v && hypergraph.nodeDegree(pin) <= MAX_NEIGHBOR_DEGREE ) {
+          neighbors.push_back(pin);
+        }
+      }
+    });
+    std::sort(neighbors.begin(), neighbors.end());
+    neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    if ( neighbors.size() > MAX_SAMPLED_NEIGHBORS ) {
+      // Sample the neighbors uniformly at random (partial Fisher-Yates shuffle)
+      std::mt19937 prng(context.partition.seed + i);
+      for ( size_t j = 0; j < MAX_SAMPLED_NEIGHBORS; ++j ) {
+        std::uniform_int_distribution<size_t> distribution(j, neighbors.size() - 1);
+        std::swap(neighbors[j], neighbors[distribution(prng)]);
+      }
+      neighbors.resize(MAX_SAMPLED_NEIGHBORS);
+      std::sort(neighbors.begin(), neighbors.end());
+    }
+    if ( neighbors.size() < 2 ) {
+      return;
+    }
+
+    // Collect all pairs of neighbors that share a net not containing v
+    auto is_neighbor = [&](const HypernodeID u) {
+      return std::binary_search(neighbors.begin(), neighbors.end(), u);
+    };
+    vec<std::pair<HypernodeID, HypernodeID>> closed_pairs;
+    for ( const HypernodeID& u : neighbors ) {
+      for_each_scanned_net(i, u, [&](const HyperedgeID he) {
+        const size_t num_closed_pairs_before = closed_pairs.size();
+        for ( const HypernodeID& w : hypergraph.pins(he) ) {
+          if ( w == v ) {
+            // Pairs connected via a net containing v are not closed
+            closed_pairs.resize(num_closed_pairs_before);
+            break;
+          } else if ( u < w && is_neighbor(w) ) {
+            closed_pairs.emplace_back(u, w);
+          }
+        }
+      });
+    }
+    std::sort(closed_pairs.begin(), closed_pairs.end());
+    const size_t num_closed_pairs = std::unique(closed_pairs.begin(), closed_pairs.end()) - closed_pairs.begin();
+    const size_t num_pairs = neighbors.size() * (neighbors.size() - 1) / 2;
+    clustering_coefficient[i] = static_cast<double>(num_closed_pairs) / num_pairs;
+  });
+
+  SampledGraphStructure structure;
+  for ( const size_t num_pins : num_scanned_pins ) {
+    structure.num_scanned_pins += num_pins;
+  }
+  if ( !sample.empty() ) {
+    for ( const double d : degree ) {
+      structure.avg_degree += d;
+    }
+    structure.avg_degree /= sample.size();
+    double variance = 0.0;
+    for ( const double d : degree ) {
+      variance += (d - structure.avg_degree) * (d - structure.avg_degree);
+    }
+    variance /= sample.size();
+    structure.degree_variation = structure.avg_degree > 0.0 ?
+      std::sqrt(variance) / structure.avg_degree : 0.0;
+    size_t num_valid = 0;
+    for ( const double cc : clustering_coefficient ) {
+      if ( cc >= 0.0 ) {
+        structure.clustering_coefficient += cc;
+        ++num_valid;
+      }
+    }
+    structure.clustering_coefficient = num_valid > 0 ?
+      structure.clustering_coefficient / num_valid : 0.0;
+  }
+  return structure;
+}
+
+// ! Community detection is skipped for inputs with a mesh-like degree distribution
+// ! and almost no local clustering
+inline CommunityDetectionDecision predictFromSample(const SampledGraphStructure& structure,
+                                                    const Context& context) {
+  if ( structure.degree_variation <= MESH_DEGREE_VARIATION &&
+       structure.clustering_coefficient < context.preprocessing.community_detection.min_clustering_coefficient ) {
+    return CommunityDetectionDecision::skip;
+  }
+  return CommunityDetectionDecision::full;
+}
+
+// ! Decides based on the modularity gain of the first local moving round
+inline CommunityDetectionDecision predictFromModularityGain(const double modularity_gain,
+                                                            const Context& context) {
+  if ( modularity_gain < context.preprocessing.community_detection.min_modularity_gain ) {
+    return CommunityDetectionDecision::skip;
+  } else if ( modularity_gain < context.preprocessing.community_detection.min_modularity_gain_for_contraction ) {
+    return CommunityDetectionDecision::single_level;
+  }
+  return CommunityDetectionDecision::full;
+}
+
+}  // namespace mt_kahypar::community_detection
@@ -115,7 +115,11 @@ bool ParallelLocalMovingModularity<Hypergraph>::localMoving(Graph<Hypergraph>& g
 
   // local moving
   bool clustering_changed = false;
+  bool measure_first_round = _measure_first_round;
+  _measure_first_round = false;
+  _first_round_modularity_gain = 0.0;
   if ( graph.numArcs() > 0 ) {
+    const double initial_modularity = measure_first_round ? metrics::modularity(graph, communities) : 0.0;
     size_t number_of_nodes_moved = graph.numNodes();
     for (size_t round = 0;
         number_of_nodes_moved >= _context.preprocessing.community_detection.min_vertex_move_fraction * graph.numNodes()
@@ -127,6 +131,15 @@ bool ParallelLocalMovingModularity<Hypergraph>::localMoving(Graph<Hypergraph>& g
       }
       clustering_changed |= number_of_nodes_moved > 0;
       DBG << "Louvain-Pass #" << round << " - num moves " << number_of_nodes_moved << " - Modularity:" << metrics::modularity(graph, communities);
+
+      if ( measure_first_round ) {
+        measure_first_round = false;
+        _first_round_modularity_gain = metrics::modularity(graph, communities) - initial_modularity;
+        if ( _first_round_modularity_gain < _min_first_round_modularity_gain ) {
+          // Community structure is too weak to justify further rounds
+          break;
+        }
+      }
     }
   }
   return clustering_changed;
@@ -73,6 +73,17 @@ class ParallelLocalMovingModularity {
 
   bool localMoving(Graph<Hypergraph>& graph, ds::Clustering& communities);
 
+  // ! The next call to localMoving(...) measures the modularity gain of its first round.
+  // ! If the gain is smaller than min_gain, local moving stops after the first round.
+  void measureFirstRoundModularityGain(const double min_gain) {
+    _measure_first_round = true;
+    _min_first_round_modularity_gain = min_gain;
+  }
+
+  double firstRoundModularityGain() const {
+    return _first_round_modularity_gain;
+  }
+
  private:
   size_t parallelNonDeterministicRound(const Graph<Hypergraph>& graph, ds::Clustering& communities);
   size_t synchronousParallelRound(const Graph<Hypergraph>& graph, ds::Clustering& communities);
@@ -185,6 +196,9 @@ private:
   vec<parallel::AtomicWrapper<ArcWeight>> _cluster_volumes;
   tbb::enumerable_thread_specific<ClearList> non_sampling_incident_cluster_weights;
   const bool _disable_randomization;
+  bool _measure_first_round = false;
+  double _min_first_round_modularity_gain = 0.0;
+  double _first_round_modularity_gain = 0.0;
 
   utils::ParallelPermutation<HypernodeID> permutation;
   std::mt19937 prng;
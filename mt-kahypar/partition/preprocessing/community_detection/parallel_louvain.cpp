@@ -28,11 +28,55 @@
 
 #include "parallel_louvain.h"
 
+#include <chrono>
+
+#include <tbb/parallel_reduce.h>
+
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/utils/utilities.h"
 
 namespace mt_kahypar::community_detection {
 
+  namespace {
+  size_t numCommunities(const ds::Clustering& communities) {
+    vec<uint8_t> is_community(communities.size(), false);
+    tbb::parallel_for(UL(0), communities.size(), [&](const size_t u) {
+      is_community[communities[u]] = true;
+    });
+    return tbb::parallel_reduce(tbb::blocked_range<size_t>(UL(0), is_community.size()), UL(0),
+      [&](const tbb::blocked_range<size_t>& range, size_t count) {
+        for ( size_t c = range.begin(); c < range.end(); ++c ) {
+          count += is_community[c];
+        }
+        return count;
+      }, std::plus<>());
+  }
+  } // namespace
+
+  template<typename Hypergraph>
+  void contract_recurse(Graph<Hypergraph>& fine_graph,
+                        ds::Clustering& communities,
+                        ParallelLocalMovingModularity<Hypergraph>& mlv,
+                        const Context& context) {
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("contraction_cd", "Contraction");
+    // Contract Communities
+    Graph<Hypergraph> coarse_graph = fine_graph.contract(communities, context.preprocessing.community_detection.low_memory_contraction);
+    ASSERT(coarse_graph.totalVolume() == fine_graph.totalVolume());
+    timer.stop_timer("contraction_cd");
+
+    // Recurse on contracted graph
+    ds::Clustering coarse_communities = local_moving_contract_recurse(coarse_graph, mlv, context);
+
+    timer.start_timer("project", "Project");
+    // Prolong Clustering
+    tbb::parallel_for(UL(0), communities.size(), [&](const size_t u) {
+      ASSERT(communities[u] < static_cast<PartitionID>(coarse_communities.size()));
+      communities[u] = coarse_communities[communities[u]];
+    });
+    timer.stop_timer("project");
+  }
+
   template<typename Hypergraph>
   ds::Clustering local_moving_contract_recurse(Graph<Hypergraph>& fine_graph,
                                                ParallelLocalMovingModularity<Hypergraph>& mlv,
@@ -44,22 +88,7 @@ namespace mt_kahypar::community_detection {
     timer.stop_timer("local_moving");
 
     if (communities_changed) {
-      timer.start_timer("contraction_cd", "Contraction");
-      // Contract Communities
-      Graph<Hypergraph> coarse_graph = fine_graph.contract(communities, context.preprocessing.community_detection.low_memory_contraction);
-      ASSERT(coarse_graph.totalVolume() == fine_graph.totalVolume());
-      timer.stop_timer("contraction_cd");
-
-      // Recurse on contracted graph
-      ds::Clustering coarse_communities = local_moving_contract_recurse(coarse_graph, mlv, context);
-
-      timer.start_timer("project", "Project");
-      // Prolong Clustering
-      tbb::parallel_for(UL(0), fine_graph.numNodes(), [&](const NodeID u) {
-        ASSERT(communities[u] < static_cast<PartitionID>(coarse_communities.size()));
-        communities[u] = coarse_communities[communities[u]];
-      });
-      timer.stop_timer("project");
+      contract_recurse(fine_graph, communities, mlv, context);
     }
 
     return communities;
@@ -74,11 +103,44 @@ namespace mt_kahypar::community_detection {
     return communities;
   }
 
+  template<typename Hypergraph>
+  ds::Clustering run_adaptive_parallel_louvain(Graph<Hypergraph>& graph,
+                                               const Context& context,
+                                               CommunityDetectionDecision& decision,
+                                               double& estimated_time_saved) {
+    ParallelLocalMovingModularity<Hypergraph> mlv(context, graph.numNodes());
+    utils::Timer& timer = utils::Utilities::instance().getTimer(context.utility_id);
+    timer.start_timer("local_moving", "Local Moving");
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    ds::Clustering communities(graph.numNodes());
+    mlv.measureFirstRoundModularityGain(context.preprocessing.community_detection.min_modularity_gain);
+    bool communities_changed = mlv.localMoving(graph, communities);
+    const double first_level_time = std::chrono::duration<double>(
+      std::chrono::high_resolution_clock::now() - start).count();
+    timer.stop_timer("local_moving");
+
+    decision = predictFromModularityGain(mlv.firstRoundModularityGain(), context);
+    utils::Utilities::instance().getStats(context.utility_id).add_stat(
+      "louvain_first_round_modularity_gain", mlv.firstRoundModularityGain());
+    estimated_time_saved = 0.0;
+    if (communities_changed && decision == CommunityDetectionDecision::full) {
+      contract_recurse(graph, communities, mlv, context);
+    } else if (communities_changed && graph.numNodes() > 0) {
+      // Local moving takes time linear in the number of nodes. Thus, the next level
+      // would have taken the time of the first level scaled by its number of nodes.
+      estimated_time_saved = first_level_time *
+        static_cast<double>(numCommunities(communities)) / graph.numNodes();
+    }
+    return communities;
+  }
+
   namespace {
   #define LOCAL_MOVING(X) ds::Clustering local_moving_contract_recurse(Graph<X>&, ParallelLocalMovingModularity<X>&, const Context&)
   #define PARALLEL_LOUVAIN(X) ds::Clustering run_parallel_louvain(Graph<X>&, const Context&, bool)
+  #define ADAPTIVE_PARALLEL_LOUVAIN(X) ds::Clustering run_adaptive_parallel_louvain(Graph<X>&, const Context&, CommunityDetectionDecision&, double&)
   }
 
   INSTANTIATE_FUNC_WITH_HYPERGRAPHS(LOCAL_MOVING)
   INSTANTIATE_FUNC_WITH_HYPERGRAPHS(PARALLEL_LOUVAIN)
+  INSTANTIATE_FUNC_WITH_HYPERGRAPHS(ADAPTIVE_PARALLEL_LOUVAIN)
 }
\ No newline at end of file
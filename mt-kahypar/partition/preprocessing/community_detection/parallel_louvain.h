@@ -29,6 +29,7 @@
 #pragma once
 
 #include "mt-kahypar/partition/preprocessing/community_detection/local_moving_modularity.h"
+#include "mt-kahypar/partition/preprocessing/community_detection/community_detection_predictor.h"
 
 namespace mt_kahypar::community_detection {
   template<typename Hypergraph>
@@ -39,4 +40,15 @@ namespace mt_kahypar::community_detection {
   ds::Clustering run_parallel_louvain(Graph<Hypergraph>& graph,
                                       const Context& context,
                                       bool disable_randomization = false);
+
+  // ! Runs the louvain method, but decides after the first local moving round based on
+  // ! its modularity gain whether to continue, stop after the first level or skip
+  // ! community detection entirely (communities must then be ignored).
+  // ! If coarser levels are skipped, estimated_time_saved is set to the estimated
+  // ! running time of the next level (zero otherwise).
+  template<typename Hypergraph>
+  ds::Clustering run_adaptive_parallel_louvain(Graph<Hypergraph>& graph,
+                                               const Context& context,
+                                               CommunityDetectionDecision& decision,
+                                               double& estimated_time_saved);
 }
@@ -0,0 +1,405 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+
+namespace mt_kahypar {
+
+/**
+ * Relabels the nodes and hyperedges of the input hypergraph such that nodes that are
+ * close to each other in the hypergraph also have close IDs. The incidence arrays of the
+ * relabeled hypergraph are then traversed with much better cache locality than on poorly
+ * ordered inputs (e.g., SAT primal graphs or web crawls).
+ * The partition of the relabeled hypergraph is projected back to the original IDs afterwards.
+ */
+template<typename TypeTraits>
+class LocalityRelabeling {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using Factory = typename Hypergraph::Factory;
+  using AtomicID = parallel::IntegralAtomicWrapper<HypernodeID>;
+
+ public:
+  LocalityRelabeling(const Context& context) :
+    _context(context),
+    _node_mapping(),
+    _edge_mapping(),
+    _is_restorable(false) { }
+
+  LocalityRelabeling(const LocalityRelabeling&) = delete;
+  LocalityRelabeling & operator= (const LocalityRelabeling &) = delete;
+
+  LocalityRelabeling(LocalityRelabeling&&) = delete;
+  LocalityRelabeling & operator= (LocalityRelabeling &&) = delete;
+
+  // ! Fixed vertices are not supported, since the fixed vertex
+  // ! assignment is stored with the original node IDs.
+  bool isApplicable(const Hypergraph& hypergraph) const {
+    return _context.preprocessing.relabeling != RelabelingType::none &&
+      !hypergraph.hasFixedVertices() &&
+      hypergraph.numRemovedHypernodes() == 0;
+  }
+
+  // ! Constructs a copy of the hypergraph with relabeled nodes and hyperedges
+  Hypergraph relabel(const Hypergraph& hypergraph) {
+    ASSERT(isApplicable(hypergraph));
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+
+    // Compute new node IDs
+    vec<HypernodeID> order;
+    switch ( _context.preprocessing.relabeling ) {
+      case RelabelingType::bfs: bfsOrder(hypergraph, order, false); break;
+      case RelabelingType::rcm: bfsOrder(hypergraph, order, true); break;
+      case RelabelingType::degree: degreeOrder(hypergraph, order); break;
+      case RelabelingType::none: break;
+    }
+    ASSERT(order.size() == num_nodes);
+    _node_mapping.assign(num_nodes, kInvalidHypernode);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID pos) {
+      _node_mapping[order[pos]] = pos;
+    });
+
+    // Hyperedges are ordered by the smallest new ID of their pins. For graphs,
+    // each undirected edge is only inserted once.
+    const HyperedgeID initial_num_edges = hypergraph.initialNumEdges();
+    vec<std::pair<HypernodeID, HyperedgeID>> edge_order(initial_num_edges);
+    tbb::parallel_for(ID(0), initial_num_edges, [&](const HyperedgeID he) {
+      HypernodeID key = kInvalidHypernode;
+      if ( hypergraph.edgeIsEnabled(he) && isRepresentative(hypergraph, he) ) {
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          key = std::min(key, _node_mapping[pin]);
+        }
+      }
+      edge_order[he] = std::make_pair(key, he);
+    });
+    tbb::parallel_sort(edge_order.begin(), edge_order.end());
+    const HyperedgeID num_edges = std::lower_bound(edge_order.begin(), edge_order.end(),
+      std::make_pair(kInvalidHypernode, ID(0))) - edge_order.begin();
+    _edge_mapping.resize(num_edges);
+    tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID new_he) {
+      _edge_mapping[new_he] = edge_order[new_he].second;
+    });
+    // The input can only be rebuilt from the copy if no hyperedge was dropped
+    _is_restorable = num_edges == ( Hypergraph::is_graph ? initial_num_edges / 2 : initial_num_edges );
+
+    Hypergraph relabeled_hypergraph = construct(hypergraph, _node_mapping, _edge_mapping);
+    // Single-pin hyperedges removed while reading the input are not part of the copy
+    relabeled_hypergraph.setNumRemovedHyperedges(hypergraph.numRemovedHyperedges());
+    return relabeled_hypergraph;
+  }
+
+  // ! Returns true, if the input hypergraph can be released while its relabeled
+  // ! copy is partitioned and restored afterwards (see restore(...))
+  bool isRestorable() const {
+    return _is_restorable;
+  }
+
+  // ! Reconstructs the input hypergraph from its relabeled copy. Nodes and hyperedges
+  // ! have the same IDs and weights as in the input hypergraph.
+  Hypergraph restore(const Hypergraph& relabeled_hypergraph) const {
+    ASSERT(_is_restorable);
+    const HypernodeID num_nodes = relabeled_hypergraph.initialNumNodes();
+    const HyperedgeID num_edges = _edge_mapping.size();
+    vec<HypernodeID> original_id(num_nodes);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      original_id[_node_mapping[hn]] = hn;
+    });
+
+    // The hyperedges of the copy are inserted in the order of their original IDs.
+    // For graphs, the relabeled edge ID differs from the unique ID of the edge.
+    vec<std::pair<HyperedgeID, HyperedgeID>> edge_order(num_edges);
+    tbb::parallel_for(ID(0), relabeled_hypergraph.initialNumEdges(), [&](const HyperedgeID he) {
+      if ( isRepresentative(relabeled_hypergraph, he) ) {
+        const HyperedgeID new_he = uniqueEdgeID(relabeled_hypergraph, he);
+        ASSERT(new_he < num_edges);
+        edge_order[new_he] = std::make_pair(_edge_mapping[new_he], he);
+      }
+    });
+    tbb::parallel_sort(edge_order.begin(), edge_order.end());
+    vec<HyperedgeID> edges(num_edges);
+    tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+      edges[he] = edge_order[he].second;
+    });
+
+    Hypergraph hypergraph = construct(relabeled_hypergraph, original_id, edges);
+    hypergraph.setNumRemovedHyperedges(relabeled_hypergraph.numRemovedHyperedges());
+    return hypergraph;
+  }
+
+  // ! Assigns each node of the original hypergraph to the block of its relabeled counterpart
+  void projectPartition(const PartitionedHypergraph& relabeled_phg,
+                        PartitionedHypergraph& original_phg) const {
+    ASSERT(_node_mapping.size() == original_phg.initialNumNodes());
+    original_phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      original_phg.setOnlyNodePart(hn, relabeled_phg.partID(_node_mapping[hn]));
+    });
+    original_phg.initializePartition();
+  }
+
+  // ! Average difference between the largest and smallest pin ID of a hyperedge.
+  // ! Smaller values indicate better locality of the incidence arrays.
+  static double averageEdgeSpan(const Hypergraph& hypergraph) {
+    const size_t total_span = tbb::parallel_reduce(
+      tbb::blocked_range<HyperedgeID>(ID(0), hypergraph.initialNumEdges()), UL(0),
+      [&](const tbb::blocked_range<HyperedgeID>& range, size_t init) {
+        size_t span = init;
+        for ( HyperedgeID he = range.begin(); he < range.end(); ++he ) {
+          if ( hypergraph.edgeIsEnabled(he) ) {
+            HypernodeID min_pin = kInvalidHypernode;
+            HypernodeID max_pin = 0;
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              min_pin = std::min(min_pin, pin);
+              max_pin = std::max(max_pin, pin);
+            }
+            span += min_pin <= max_pin ? max_pin - min_pin : 0;
+          }
+        }
+        return span;
+      }, std::plus<>());
+    return hypergraph.initialNumEdges() > 0 ?
+      static_cast<double>(total_span) / hypergraph.initialNumEdges() : 0.0;
+  }
+
+ private:
+  static bool isRepresentative(const Hypergraph& hypergraph, const HyperedgeID he) {
+    if constexpr ( Hypergraph::is_graph ) {
+      return hypergraph.edgeSource(he) < hypergraph.edgeTarget(he);
+    } else {
+      unused(hypergraph);
+      unused(he);
+      return true;
+    }
+  }
+
+  static HyperedgeID uniqueEdgeID(const Hypergraph& hypergraph, const HyperedgeID he) {
+    if constexpr ( Hypergraph::is_graph ) {
+      return hypergraph.uniqueEdgeID(he);
+    } else {
+      unused(hypergraph);
+      return he;
+    }
+  }
+
+  // ! Constructs a hypergraph whose i-th hyperedge consists of the pins of hyperedge edges[i]
+  // ! of the source hypergraph. Each node hn of the source hypergraph becomes node node_mapping[hn].
+  Hypergraph construct(const Hypergraph& source,
+                       const vec<HypernodeID>& node_mapping,
+                       const vec<HyperedgeID>& edges) const {
+    const HypernodeID num_nodes = source.initialNumNodes();
+    const HyperedgeID num_edges = edges.size();
+    vec<size_t> offsets;
+    vec<HyperedgeWeight> edge_weight;
+    vec<HypernodeWeight> node_weight;
+    tbb::parallel_invoke([&] {
+      offsets.assign(num_edges + 1, 0);
+      tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+        offsets[he + 1] = source.edgeSize(edges[he]);
+      });
+      parallel_prefix_sum(offsets.begin() + 1, offsets.end(),
+        offsets.begin() + 1, std::plus<>(), UL(0));
+    }, [&] {
+      edge_weight.resize(num_edges);
+      tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+        edge_weight[he] = source.edgeWeight(edges[he]);
+      });
+    }, [&] {
+      node_weight.resize(num_nodes);
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        node_weight[node_mapping[hn]] = source.nodeWeight(hn);
+      });
+    });
+
+    ds::Array<HypernodeID> incidence_array;
+    incidence_array.resizeNoAssign(offsets[num_edges]);
+    tbb::parallel_for(ID(0), num_edges, [&](const HyperedgeID he) {
+      size_t pos = offsets[he];
+      for ( const HypernodeID& pin : source.pins(edges[he]) ) {
+        incidence_array[pos++] = node_mapping[pin];
+      }
+    });
+
+    return Factory::constructFromCSR(num_nodes, num_edges, offsets.data(),
+      std::move(incidence_array), edge_weight.data(), node_weight.data(),
+      _context.preprocessing.stable_construction_of_incident_edges);
+  }
+
+  // ! Sorts the nodes in decreasing order of their degree
+  void degreeOrder(const Hypergraph& hypergraph, vec<HypernodeID>& order) const {
+    order.resize(hypergraph.initialNumNodes());
+    std::iota(order.begin(), order.end(), ID(0));
+    tbb::parallel_sort(order.begin(), order.end(),
+      [&](const HypernodeID& lhs, const HypernodeID& rhs) {
+        const HyperedgeID lhs_degree = hypergraph.nodeDegree(lhs);
+        const HyperedgeID rhs_degree = hypergraph.nodeDegree(rhs);
+        return lhs_degree > rhs_degree || (lhs_degree == rhs_degree && lhs < rhs);
+      });
+  }
+
+  // ! Visits the nodes in BFS order (one BFS per connected component). If rcm is set,
+  // ! the BFS starts at a node with minimum degree, visits neighbors in increasing order
+  // ! of their degree and the final order is reversed (Reverse Cuthill-McKee).
+  // ! The BFS is level-synchronous: the nodes of the next level are discovered in parallel
+  // ! and placed behind the current level with a prefix sum over the number of nodes
+  // ! discovered by each node of the current level. A node (or hyperedge) is discovered by
+  // ! the node with the smallest position in the current level, which yields the same order
+  // ! as a sequential BFS.
+  void bfsOrder(const Hypergraph& hypergraph, vec<HypernodeID>& order, const bool rcm) const {
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HyperedgeID num_edges = hypergraph.initialNumEdges();
+    auto compare_degree = [&](const HypernodeID& lhs, const HypernodeID& rhs) {
+      const HyperedgeID lhs_degree = hypergraph.nodeDegree(lhs);
+      const HyperedgeID rhs_degree = hypergraph.nodeDegree(rhs);
+      return lhs_degree < rhs_degree || (lhs_degree == rhs_degree && lhs < rhs);
+    };
+    vec<HypernodeID> start_nodes(num_nodes);
+    std::iota(start_nodes.begin(), start_nodes.end(), ID(0));
+    if ( rcm ) {
+      tbb::parallel_sort(start_nodes.begin(), start_nodes.end(), compare_degree);
+    }
+
+    // Visited flags are stored as bytes, since they are written concurrently
+    vec<uint8_t> visited_node(num_nodes, false);
+    vec<uint8_t> visited_edge(num_edges, false);
+    // Position of the node in the current level that discovers a node or hyperedge
+    vec<AtomicID> discovered_by(num_nodes, AtomicID(kInvalidHypernode));
+    vec<AtomicID> edge_owner(num_edges, AtomicID(kInvalidHypernode));
+    vec<HypernodeID> level_offsets(num_nodes + 1, 0);
+    order.assign(num_nodes, kInvalidHypernode);
+
+    // Calls f(he) for each unvisited hyperedge that is scanned by the node at position pos
+    auto for_each_owned_edge = [&](const HypernodeID pos, const auto& f) {
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(order[pos]) ) {
+        if ( edge_owner[he].load(std::memory_order_relaxed) == pos ) {
+          f(he);
+        }
+      }
+    };
+
+    HypernodeID num_visited = 0;
+    for ( const HypernodeID& start : start_nodes ) {
+      if ( visited_node[start] ) {
+        continue;
+      }
+      visited_node[start] = true;
+      order[num_visited] = start;
+      HypernodeID level_begin = num_visited++;
+      while ( level_begin < num_visited ) {
+        const HypernodeID level_end = num_visited;
+        // 1.) Each unvisited hyperedge is scanned by the first node of the level that contains it
+        tbb::parallel_for(level_begin, level_end, [&](const HypernodeID pos) {
+          for ( const HyperedgeID& he : hypergraph.incidentEdges(order[pos]) ) {
+            if ( !visited_edge[he] ) {
+              fetchMin(edge_owner[he], pos);
+            }
+          }
+        });
+        // 2.) Each unvisited pin is discovered by the first node that scans it
+        tbb::parallel_for(level_begin, level_end, [&](const HypernodeID pos) {
+          for_each_owned_edge(pos, [&](const HyperedgeID he) {
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              if ( !visited_node[pin] ) {
+                fetchMin(discovered_by[pin], pos);
+              }
+            }
+          });
+        });
+        // 3.) Count the nodes discovered by each node of the level
+        tbb::parallel_for(level_begin, level_end, [&](const HypernodeID pos) {
+          HypernodeID num_discovered = 0;
+          for_each_owned_edge(pos, [&](const HyperedgeID he) {
+            visited_edge[he] = true;
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              if ( discovered_by[pin].load(std::memory_order_relaxed) == pos && !visited_node[pin] ) {
+                visited_node[pin] = true;
+                ++num_discovered;
+              }
+            }
+          });
+          level_offsets[pos - level_begin + 1] = num_discovered;
+        });
+        parallel_prefix_sum(level_offsets.begin() + 1, level_offsets.begin() + level_end - level_begin + 1,
+          level_offsets.begin() + 1, std::plus<>(), ID(0));
+        // 4.) Place the discovered nodes behind the current level
+        tbb::parallel_for(level_begin, level_end, [&](const HypernodeID pos) {
+          const HypernodeID first = level_end + level_offsets[pos - level_begin];
+          HypernodeID next = first;
+          for_each_owned_edge(pos, [&](const HyperedgeID he) {
+            for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+              if ( discovered_by[pin].load(std::memory_order_relaxed) == pos ) {
+                // Pins contained in several hyperedges are only placed once
+                discovered_by[pin].store(kInvalidHypernode, std::memory_order_relaxed);
+                order[next++] = pin;
+              }
+            }
+          });
+          ASSERT(next == level_end + level_offsets[pos - level_begin + 1]);
+          if ( rcm ) {
+            std::sort(order.begin() + first, order.begin() + next, compare_degree);
+          }
+        });
+        num_visited = level_end + level_offsets[level_end - level_begin];
+        level_begin = level_end;
+      }
+    }
+    ASSERT(num_visited == num_nodes);
+
+    if ( rcm ) {
+      tbb::parallel_for(ID(0), num_nodes / 2, [&](const HypernodeID pos) {
+        std::swap(order[pos], order[num_nodes - pos - 1]);
+      });
+    }
+  }
+
+  static void fetchMin(AtomicID& value, const HypernodeID desired) {
+    HypernodeID current = value.load(std::memory_order_relaxed);
+    while ( desired < current &&
+            !value.compare_exchange_weak(current, desired, std::memory_order_relaxed) ) { }
+  }
+
+  const Context& _context;
+  // ! Maps each node of the original hypergraph to its ID in the relabeled hypergraph
+  vec<HypernodeID> _node_mapping;
+  // ! Maps each hyperedge of the relabeled hypergraph to its original ID
+  vec<HyperedgeID> _edge_mapping;
+  bool _is_restorable;
+};
+
+}  // namespace mt_kahypar
@@ -71,6 +71,42 @@ class DegreeZeroHypernodeRemover {
 
   // ! Restore degree-zero vertices
   void restoreDegreeZeroHypernodes(PartitionedHypergraph& hypergraph) {
+    restoreDegreeZeroHypernodes(hypergraph, _context);
+  }
+
+  // ! Restore degree-zero vertices and assign them to the blocks of a
+  // ! partition computed with the given context (might have a different k)
+  void restoreDegreeZeroHypernodes(PartitionedHypergraph& hypergraph,
+                                   const Context& context) {
+    assignDegreeZeroHypernodes(hypergraph, context, [&](const HypernodeID hn, const PartitionID to) {
+      hypergraph.restoreDegreeZeroHypernode(hn, to);
+    });
+    _removed_hns.clear();
+  }
+
+  // ! Restore degree-zero vertices only in the hypergraph. Afterwards,
+  // ! assignRestoredDegreeZeroHypernodes(...) must be called for each
+  // ! partition of the hypergraph.
+  void restoreDegreeZeroHypernodes(Hypergraph& hypergraph) {
+    for ( const HypernodeID& hn : _removed_hns ) {
+      hypergraph.restoreDegreeZeroHypernode(hn);
+    }
+  }
+
+  // ! Assigns degree-zero vertices that were already restored in the hypergraph to the
+  // ! blocks of a partition computed with the given context (might have a different k)
+  void assignRestoredDegreeZeroHypernodes(PartitionedHypergraph& hypergraph,
+                                          const Context& context) {
+    assignDegreeZeroHypernodes(hypergraph, context, [&](const HypernodeID hn, const PartitionID to) {
+      hypergraph.setNodePart(hn, to);
+    });
+  }
+
+ private:
+  template<typename F>
+  void assignDegreeZeroHypernodes(PartitionedHypergraph& hypergraph,
+                                  const Context& context,
+                                  const F& assign) {
     // Sort degree-zero vertices in decreasing order of their weight
     tbb::parallel_sort(_removed_hns.begin(), _removed_hns.end(),
       [&](const HypernodeID& lhs, const HypernodeID& rhs) {
@@ -79,9 +115,9 @@ class DegreeZeroHypernodeRemover {
       });
     // Sort blocks of partition in increasing order of their weight
     auto distance_to_max = [&](const PartitionID block) {
-      return hypergraph.partWeight(block) - _context.partition.max_part_weights[block];
+      return hypergraph.partWeight(block) - context.partition.max_part_weights[block];
     };
-    parallel::scalable_vector<PartitionID> blocks(_context.partition.k, 0);
+    parallel::scalable_vector<PartitionID> blocks(context.partition.k, 0);
     std::iota(blocks.begin(), blocks.end(), 0);
     std::sort(blocks.begin(), blocks.end(),
       [&](const PartitionID& lhs, const PartitionID& rhs) {
@@ -91,18 +127,16 @@ class DegreeZeroHypernodeRemover {
     // Perform Bin-Packing
     for ( const HypernodeID& hn : _removed_hns ) {
       PartitionID to = blocks.front();
-      hypergraph.restoreDegreeZeroHypernode(hn, to);
+      assign(hn, to);
       PartitionID i = 0;
-      while ( i + 1 < _context.partition.k &&
+      while ( i + 1 < context.partition.k &&
               distance_to_max(blocks[i]) > distance_to_max(blocks[i + 1]) ) {
         std::swap(blocks[i], blocks[i + 1]);
         ++i;
       }
     }
-    _removed_hns.clear();
   }
 
- private:
   const Context& _context;
   parallel::scalable_vector<HypernodeID> _removed_hns;
 };
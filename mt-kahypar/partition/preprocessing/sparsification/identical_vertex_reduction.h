@@ -0,0 +1,363 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_invoke.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_sort.h>
+
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/hash.h"
+
+namespace mt_kahypar {
+
+/**
+ * Collapses vertices with identical incident nets (twins) into one weighted representative
+ * and merges identical nets into one net whose weight is the sum of their weights. Twins and
+ * identical nets are detected by sorting order-independent fingerprints of their incident nets
+ * and pins. Each vertex (net) is compared once against the leader of the current class in its
+ * run of equal fingerprints and either joins the class or starts a new one (similar to the
+ * two-hop clustering). Hash collisions within a run can therefore hide some twins, but the
+ * running time is linear in the size of the run. For graphs, two nodes are twins if they have
+ * the same neighbors.
+ * The reduced hypergraph is partitioned instead of the input and the partition is projected
+ * back to the input afterwards. Nets that only contain twins of the same representative are
+ * never cut and are therefore removed.
+ */
+template<typename TypeTraits>
+class IdenticalVertexReduction {
+
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using Factory = typename Hypergraph::Factory;
+  using HyperedgeVector = vec<vec<HypernodeID>>;
+
+  struct Fingerprint {
+    uint64_t hash = kEdgeHashSeed;
+    size_t size = 0;
+    size_t id = 0;
+
+    bool operator< (const Fingerprint& other) const {
+      return std::tie(hash, size, id) < std::tie(other.hash, other.size, other.id);
+    }
+  };
+
+ public:
+  IdenticalVertexReduction(const Context& context) :
+    _context(context),
+    _node_mapping(),
+    _num_removed_nodes(0),
+    _num_removed_nets(0) { }
+
+  IdenticalVertexReduction(const IdenticalVertexReduction&) = delete;
+  IdenticalVertexReduction & operator= (const IdenticalVertexReduction &) = delete;
+
+  IdenticalVertexReduction(IdenticalVertexReduction&&) = delete;
+  IdenticalVertexReduction & operator= (IdenticalVertexReduction &&) = delete;
+
+  // ! Fixed vertices are not supported, since the fixed vertex
+  // ! assignment is stored with the original node IDs.
+  bool isApplicable(const Hypergraph& hypergraph) const {
+    return _context.preprocessing.use_identical_vertex_reduction &&
+      !hypergraph.hasFixedVertices() &&
+      hypergraph.numRemovedHypernodes() == 0;
+  }
+
+  // ! Constructs the reduced hypergraph. Returns false and leaves the reduced
+  // ! hypergraph untouched, if the hypergraph contains neither twins nor identical nets.
+  bool reduce(const Hypergraph& hypergraph, Hypergraph& reduced_hypergraph) {
+    ASSERT(isApplicable(hypergraph));
+    const HypernodeID num_nodes = hypergraph.initialNumNodes();
+    const HyperedgeID initial_num_edges = hypergraph.initialNumEdges();
+
+    // Compute fingerprints of the incident nets of each vertex
+    vec<Fingerprint> node_fingerprints(num_nodes);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      Fingerprint& fingerprint = node_fingerprints[hn];
+      fingerprint.id = hn;
+      for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+        if ( hypergraph.edgeIsEnabled(he) ) {
+          fingerprint.hash += hashing::integer::hash64(signatureElement(hypergraph, he));
+          ++fingerprint.size;
+        }
+      }
+    });
+    tbb::parallel_sort(node_fingerprints.begin(), node_fingerprints.end());
+
+    // The vertices of a run are packed greedily in order into classes of twins, which
+    // are not heavier than the maximum allowed node weight of the coarsening phase.
+    // The weight of a class is accumulated at its leader, which belongs to only one run.
+    vec<HypernodeID> representative(num_nodes);
+    vec<HypernodeWeight> class_weight(num_nodes);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      representative[hn] = hn;
+      class_weight[hn] = hypergraph.nodeWeight(hn);
+    });
+    forEachRunOfEqualFingerprints(node_fingerprints, [&](const size_t begin, const size_t end) {
+      vec<HypernodeID> leader_signature;
+      vec<HypernodeID> current_signature;
+      size_t leader = end;
+      for ( size_t i = begin; i < end; ++i ) {
+        if ( node_fingerprints[i].size == 0 ) {
+          // Degree-zero vertices are handled by the degree-zero vertex remover
+          continue;
+        }
+        const HypernodeID v = node_fingerprints[i].id;
+        const HypernodeWeight weight_v = hypergraph.nodeWeight(v);
+        bool is_twin = false;
+        if ( leader != end && node_fingerprints[leader].size == node_fingerprints[i].size ) {
+          signature(hypergraph, v, current_signature);
+          is_twin = leader_signature == current_signature;
+        }
+        const HypernodeID u = leader != end ? node_fingerprints[leader].id : kInvalidHypernode;
+        if ( is_twin && class_weight[u] + weight_v <= _context.coarsening.max_allowed_node_weight ) {
+          representative[v] = u;
+          class_weight[u] += weight_v;
+        } else {
+          // Class is full or v has a different signature => v starts a new class
+          if ( !is_twin ) {
+            signature(hypergraph, v, leader_signature);
+          }
+          leader = i;
+        }
+      }
+    });
+    parallel::free(node_fingerprints);
+
+    // Representatives are numbered consecutively in the order of their IDs
+    _node_mapping.resize(num_nodes);
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      _node_mapping[hn] = representative[hn] == hn;
+    });
+    parallel_prefix_sum(_node_mapping.begin(), _node_mapping.end(),
+      _node_mapping.begin(), std::plus<>(), ID(0));
+    const HypernodeID num_reduced_nodes = num_nodes > 0 ? _node_mapping.back() : 0;
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      if ( representative[hn] == hn ) {
+        --_node_mapping[hn];
+      }
+    });
+    tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+      if ( representative[hn] != hn ) {
+        _node_mapping[hn] = _node_mapping[representative[hn]];
+      }
+    });
+
+    // Compute the pins of each net in the reduced hypergraph and their fingerprints
+    HyperedgeVector reduced_pins(initial_num_edges);
+    vec<Fingerprint> net_fingerprints(initial_num_edges);
+    vec<HyperedgeWeight> net_weight(initial_num_edges, 0);
+    tbb::parallel_for(ID(0), initial_num_edges, [&](const HyperedgeID he) {
+      Fingerprint& fingerprint = net_fingerprints[he];
+      fingerprint.id = he;
+      if ( hypergraph.edgeIsEnabled(he) && isRepresentative(hypergraph, he) ) {
+        vec<HypernodeID>& pins = reduced_pins[he];
+        for ( const HypernodeID& pin : hypergraph.pins(he) ) {
+          pins.push_back(_node_mapping[pin]);
+        }
+        std::sort(pins.begin(), pins.end());
+        pins.erase(std::unique(pins.begin(), pins.end()), pins.end());
+        if ( pins.size() > 1 ) {
+          for ( const HypernodeID& pin : pins ) {
+            fingerprint.hash += hashing::integer::hash64(pin);
+          }
+          fingerprint.size = pins.size();
+          net_weight[he] = hypergraph.edgeWeight(he);
+        }
+      }
+    });
+    tbb::parallel_sort(net_fingerprints.begin(), net_fingerprints.end());
+
+    // Identical nets are merged into the leader of their class (see above)
+    forEachRunOfEqualFingerprints(net_fingerprints, [&](const size_t begin, const size_t end) {
+      HyperedgeID leader = kInvalidHyperedge;
+      for ( size_t i = begin; i < end; ++i ) {
+        const HyperedgeID he = net_fingerprints[i].id;
+        if ( net_weight[he] == 0 ) {
+          continue;
+        }
+        if ( leader != kInvalidHyperedge && reduced_pins[leader] == reduced_pins[he] ) {
+          net_weight[leader] += net_weight[he];
+          net_weight[he] = 0;
+        } else {
+          leader = he;
+        }
+      }
+    });
+    parallel::free(net_fingerprints);
+
+    // The remaining nets are numbered consecutively in the order of their IDs
+    vec<HyperedgeID> net_mapping(initial_num_edges);
+    tbb::parallel_for(ID(0), initial_num_edges, [&](const HyperedgeID he) {
+      net_mapping[he] = net_weight[he] != 0;
+    });
+    parallel_prefix_sum(net_mapping.begin(), net_mapping.end(),
+      net_mapping.begin(), std::plus<>(), ID(0));
+    const HyperedgeID num_reduced_edges = initial_num_edges > 0 ? net_mapping.back() : 0;
+    const HyperedgeID num_nets = tbb::parallel_reduce(
+      tbb::blocked_range<HyperedgeID>(ID(0), initial_num_edges), ID(0),
+      [&](const tbb::blocked_range<HyperedgeID>& range, HyperedgeID init) {
+        HyperedgeID count = init;
+        for ( HyperedgeID he = range.begin(); he < range.end(); ++he ) {
+          count += hypergraph.edgeIsEnabled(he) && isRepresentative(hypergraph, he);
+        }
+        return count;
+      }, std::plus<>());
+    _num_removed_nodes = num_nodes - num_reduced_nodes;
+    _num_removed_nets = num_nets - num_reduced_edges;
+    if ( _num_removed_nodes == 0 && _num_removed_nets == 0 ) {
+      _node_mapping.clear();
+      return false;
+    }
+
+    vec<size_t> offsets;
+    vec<HyperedgeWeight> hyperedge_weight;
+    vec<HypernodeWeight> hypernode_weight;
+    tbb::parallel_invoke([&] {
+      offsets.assign(num_reduced_edges + 1, 0);
+      hyperedge_weight.resize(num_reduced_edges);
+      tbb::parallel_for(ID(0), initial_num_edges, [&](const HyperedgeID he) {
+        if ( net_weight[he] != 0 ) {
+          offsets[net_mapping[he]] = reduced_pins[he].size();
+          hyperedge_weight[net_mapping[he] - 1] = net_weight[he];
+        }
+      });
+      parallel_prefix_sum(offsets.begin() + 1, offsets.end(),
+        offsets.begin() + 1, std::plus<>(), UL(0));
+    }, [&] {
+      hypernode_weight.resize(num_reduced_nodes);
+      tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID hn) {
+        if ( representative[hn] == hn ) {
+          hypernode_weight[_node_mapping[hn]] = class_weight[hn];
+        }
+      });
+    });
+
+    ds::Array<HypernodeID> incidence_array;
+    incidence_array.resizeNoAssign(offsets[num_reduced_edges]);
+    tbb::parallel_for(ID(0), initial_num_edges, [&](const HyperedgeID he) {
+      if ( net_weight[he] != 0 ) {
+        size_t pos = offsets[net_mapping[he] - 1];
+        for ( const HypernodeID& pin : reduced_pins[he] ) {
+          incidence_array[pos++] = pin;
+        }
+      }
+    });
+    parallel::free(reduced_pins);
+
+    reduced_hypergraph = Factory::constructFromCSR(num_reduced_nodes, num_reduced_edges,
+      offsets.data(), std::move(incidence_array), hyperedge_weight.data(), hypernode_weight.data(),
+      _context.preprocessing.stable_construction_of_incident_edges);
+    // Single-pin hyperedges removed while reading the input are not part of the copy
+    reduced_hypergraph.setNumRemovedHyperedges(hypergraph.numRemovedHyperedges());
+    return true;
+  }
+
+  // ! Assigns each node of the original hypergraph to the block of its representative
+  void projectPartition(const PartitionedHypergraph& reduced_phg,
+                        PartitionedHypergraph& original_phg) const {
+    ASSERT(_node_mapping.size() == original_phg.initialNumNodes());
+    original_phg.doParallelForAllNodes([&](const HypernodeID& hn) {
+      original_phg.setOnlyNodePart(hn, reduced_phg.partID(_node_mapping[hn]));
+    });
+    original_phg.initializePartition();
+  }
+
+  HypernodeID numRemovedNodes() const {
+    return _num_removed_nodes;
+  }
+
+  HyperedgeID numRemovedNets() const {
+    return _num_removed_nets;
+  }
+
+ private:
+  static bool isRepresentative(const Hypergraph& hypergraph, const HyperedgeID he) {
+    if constexpr ( Hypergraph::is_graph ) {
+      return hypergraph.edgeSource(he) < hypergraph.edgeTarget(he);
+    } else {
+      unused(hypergraph);
+      unused(he);
+      return true;
+    }
+  }
+
+  // ! For graphs, the signature of a node consists of its neighbors
+  // ! instead of its incident edges
+  static HypernodeID signatureElement(const Hypergraph& hypergraph, const HyperedgeID he) {
+    if constexpr ( Hypergraph::is_graph ) {
+      return hypergraph.edgeTarget(he);
+    } else {
+      unused(hypergraph);
+      return he;
+    }
+  }
+
+  static void signature(const Hypergraph& hypergraph, const HypernodeID hn, vec<HypernodeID>& elements) {
+    elements.clear();
+    for ( const HyperedgeID& he : hypergraph.incidentEdges(hn) ) {
+      if ( hypergraph.edgeIsEnabled(he) ) {
+        elements.push_back(signatureElement(hypergraph, he));
+      }
+    }
+    std::sort(elements.begin(), elements.end());
+  }
+
+  // ! Calls f(begin, end) in parallel for each range of sorted fingerprints
+  // ! with equal hash that contains at least two elements
+  template<typename F>
+  static void forEachRunOfEqualFingerprints(const vec<Fingerprint>& fingerprints, const F& f) {
+    vec<size_t> run_starts;
+    for ( size_t i = 0; i < fingerprints.size(); ++i ) {
+      if ( i == 0 || fingerprints[i].hash != fingerprints[i - 1].hash ) {
+        run_starts.push_back(i);
+      }
+    }
+    run_starts.push_back(fingerprints.size());
+    tbb::parallel_for(UL(0), run_starts.size() - 1, [&](const size_t run) {
+      if ( run_starts[run + 1] - run_starts[run] > 1 ) {
+        f(run_starts[run], run_starts[run + 1]);
+      }
+    });
+  }
+
+  const Context& _context;
+  // ! Maps each node of the original hypergraph to its representative in the reduced hypergraph
+  vec<HypernodeID> _node_mapping;
+  HypernodeID _num_removed_nodes;
+  HyperedgeID _num_removed_nets;
+};
+
+}  // namespace mt_kahypar
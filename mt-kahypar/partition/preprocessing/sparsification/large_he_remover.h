@@ -84,12 +84,27 @@ class LargeHyperedgeRemover {
       hypergraph.restoreLargeEdge(he);
       delta += metrics::contribution(hypergraph, he, _context.partition.objective);
     }
+    reportRestoredLargeHyperedges(delta);
+  }
 
-    if ( _context.partition.verbose_output && delta > 0 ) {
-      LOG << RED << "Restoring of" << _removed_hes.size() << "large hyperedges (|e| >"
-          << largeHyperedgeThreshold() << ") increased" << _context.partition.objective
-          << "by" << delta << END;
+  // ! Restores all previously removed large hyperedges only in the hypergraph.
+  // ! Afterwards, initializeRestoredLargeHyperedges(...) must be called for
+  // ! each partition of the hypergraph.
+  void restoreLargeHyperedges(Hypergraph& hypergraph) {
+    for ( const HyperedgeID& he : _removed_hes ) {
+      hypergraph.restoreLargeEdge(he);
+    }
+  }
+
+  // ! Initializes the previously removed large hyperedges in a partition
+  // ! of a hypergraph in which they were already restored
+  void initializeRestoredLargeHyperedges(PartitionedHypergraph& hypergraph) {
+    HyperedgeWeight delta = 0;
+    for ( const HyperedgeID& he : _removed_hes ) {
+      hypergraph.initializeRestoredLargeEdge(he);
+      delta += metrics::contribution(hypergraph, he, _context.partition.objective);
     }
+    reportRestoredLargeHyperedges(delta);
   }
 
   HypernodeID largeHyperedgeThreshold() const {
@@ -103,6 +118,14 @@ class LargeHyperedgeRemover {
   }
 
  private:
+  void reportRestoredLargeHyperedges(const HyperedgeWeight delta) const {
+    if ( _context.partition.verbose_output && delta > 0 ) {
+      LOG << RED << "Restoring of" << _removed_hes.size() << "large hyperedges (|e| >"
+          << largeHyperedgeThreshold() << ") increased" << _context.partition.objective
+          << "by" << delta << END;
+    }
+  }
+
   const Context& _context;
   parallel::scalable_vector<HypernodeID> _removed_hes;
 };
@@ -397,6 +397,7 @@ void RecursiveBipartitioning<TypeTraits>::partition(PartitionedHypergraph& hyper
     parallel::MemoryPool::instance().deactivate_unused_memory_allocations();
     utils.getTimer(context.utility_id).disable();
     utils.getStats(context.utility_id).disable();
+    utils.getPerformanceLog(context.utility_id).disable();
   }
 
   Context rb_context(context);
@@ -422,6 +423,7 @@ void RecursiveBipartitioning<TypeTraits>::partition(PartitionedHypergraph& hyper
     parallel::MemoryPool::instance().activate_unused_memory_allocations();
     utils.getTimer(context.utility_id).enable();
     utils.getStats(context.utility_id).enable();
+    utils.getPerformanceLog(context.utility_id).enable();
   }
 
   #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
@@ -32,6 +32,7 @@
 #include "mt-kahypar/io/partitioning_output.h"
 #include "mt-kahypar/utils/utilities.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/tracer.h"
 
 namespace mt_kahypar {
 
@@ -73,8 +74,13 @@ bool FlowRefinementScheduler<GraphAndGainTypes>::refineImpl(
     while ( i < std::max(UL(1), static_cast<size_t>(
         std::ceil(_context.refinement.flows.parallel_searches_multiplier *
             _quotient_graph.numActiveBlockPairs()))) ) {
+      if ( _context.isTimeLimitExceeded() ) {
+        // Global time limit is exceeded => do not start new flow searches
+        break;
+      }
       SearchID search_id = _quotient_graph.requestNewSearch(_refiner);
       if ( search_id != QuotientGraph<TypeTraits>::INVALID_SEARCH_ID ) {
+        utils::ScopedTrace trace("Flow Search", "flows");
         DBG << "Start search" << search_id
             << "( Blocks =" << blocksOfSearch(search_id)
             << ", Refiner =" << i << ")";
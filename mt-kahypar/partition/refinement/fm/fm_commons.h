@@ -277,6 +277,10 @@ struct FMSharedData {
 
   bool release_nodes = true;
 
+  // ! Upper bound for the absolute gain values of the current level. If it is non-zero,
+  // ! the localized searches use bucket queues instead of binary heaps.
+  Gain bucketQueueMaxGain = 0;
+
   FMSharedData(size_t numNodes, size_t numThreads) :
     numberOfNodes(numNodes),
     refinementNodes(), //numNodes, numThreads),
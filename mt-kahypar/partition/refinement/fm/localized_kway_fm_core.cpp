@@ -40,6 +40,10 @@ namespace mt_kahypar {
                                                   size_t taskID, size_t numSeeds) {
     localMoves.clear();
     thisSearch = ++sharedData.nodeTracker.highestActiveSearchID;
+    if ( bucketQueueMaxGain != sharedData.bucketQueueMaxGain ) {
+      bucketQueueMaxGain = sharedData.bucketQueueMaxGain;
+      setupPriorityQueues();
+    }
 
     HypernodeID seedNode;
     HypernodeID pushes = 0;
@@ -234,6 +238,24 @@ namespace mt_kahypar {
     while ( static_cast<size_t>(new_k) > vertexPQs.size() ) {
       vertexPQs.emplace_back(sharedData.vertexPQHandles.data(), sharedData.numberOfNodes);
     }
+    setupPriorityQueues();
+  }
+
+  template<typename GraphAndGainTypes>
+  void LocalizedKWayFM<GraphAndGainTypes>::setupPriorityQueues() {
+    // Gains are bounded by the maximum weighted degree, thus each gain value
+    // in [-bucketQueueMaxGain, bucketQueueMaxGain] gets its own bucket
+    if ( bucketQueueMaxGain > 0 ) {
+      blockPQ.useBucketQueue(-bucketQueueMaxGain, bucketQueueMaxGain);
+      for ( VertexPriorityQueue& pq : vertexPQs ) {
+        pq.useBucketQueue(-bucketQueueMaxGain, bucketQueueMaxGain);
+      }
+    } else {
+      blockPQ.useHeap();
+      for ( VertexPriorityQueue& pq : vertexPQs ) {
+        pq.useHeap();
+      }
+    }
   }
 
   template<typename GraphAndGainTypes>
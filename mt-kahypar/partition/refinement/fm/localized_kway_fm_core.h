@@ -50,8 +50,8 @@ public:
   using GainCache = typename GraphAndGainTypes::GainCache;
   using DeltaGainCache = typename GraphAndGainTypes::DeltaGainCache;
   using DeltaPartitionedHypergraph = typename PartitionedHypergraph::template DeltaPartition<DeltaGainCache::requires_connectivity_set>;
-  using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, PartitionID> >;
-  using VertexPriorityQueue = ds::MaxHeap<Gain, HypernodeID>;    // these need external handles
+  using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::BucketOrHeapQueue<Gain, PartitionID> >;
+  using VertexPriorityQueue = ds::BucketOrHeapQueue<Gain, HypernodeID>;    // these need external handles
 
 public:
   explicit LocalizedKWayFM(const Context& context,
@@ -92,6 +92,9 @@ private:
   MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
   void acquireOrUpdateNeighbors(PHG& phg, CACHE& gain_cache, const Move& move, DispatchedFMStrategy& fm_strategy);
 
+  // ! Switches the priority queues between bucket queues and binary heaps (see FMSharedData::bucketQueueMaxGain)
+  void setupPriorityQueues();
+
 
  private:
 
@@ -129,6 +132,9 @@ private:
   // ! in that block) touched by the current local search associated
   // ! with their gain values
   vec<VertexPriorityQueue> vertexPQs;
+
+  // ! Maximum absolute gain for which the priority queues are currently set up (0 = binary heaps)
+  Gain bucketQueueMaxGain = 0;
 };
 
 }
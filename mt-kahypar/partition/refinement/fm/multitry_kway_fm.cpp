@@ -27,6 +27,8 @@
 
 #include <set>
 
+#include <tbb/parallel_reduce.h>
+
 #include "mt-kahypar/partition/refinement/fm/multitry_kway_fm.h"
 
 #include "mt-kahypar/definitions.h"
@@ -200,6 +202,11 @@ namespace mt_kahypar {
         }
       }
 
+      if ( context.isTimeLimitExceeded() ) {
+        DBG << RED << "Multitry FM reached global time limit => ABORT" << END;
+        break;
+      }
+
       if ( (improvement <= 0 && (!context.refinement.fm.activate_unconstrained_dynamically || round > 1))
             || consecutive_rounds_with_too_little_improvement >= 2 ) {
         break;
@@ -416,6 +423,43 @@ namespace mt_kahypar {
     if (!gain_cache.isInitialized()) {
       gain_cache.initializeGainCache(phg);
     }
+    sharedData.bucketQueueMaxGain = computeBucketQueueMaxGain(phg);
+  }
+
+  template<typename GraphAndGainTypes>
+  Gain MultiTryKWayFM<GraphAndGainTypes>::computeBucketQueueMaxGain(const PartitionedHypergraph& phg) const {
+    // Bucket queues are only used if the gains are bounded by a small multiple of the maximum
+    // weighted degree. The unconstrained FM adds imbalance penalties to the gains and
+    // steiner tree gains depend on the target graph, therefore they always use binary heaps.
+    constexpr GainPolicy policy = GainCache::TYPE;
+    constexpr Gain degree_multiplier = policy == GainPolicy::soed ? 2 :
+      (policy == GainPolicy::steiner_tree || policy == GainPolicy::steiner_tree_for_graphs) ? 0 : 1;
+    if ( context.refinement.fm.pq_type != FMPriorityQueueType::bucket_queue ||
+         context.refinement.fm.algorithm != FMAlgorithm::kway_fm || degree_multiplier == 0 ) {
+      return 0;
+    }
+
+    const HyperedgeWeight max_weighted_degree = tbb::parallel_reduce(
+      tbb::blocked_range<HypernodeID>(ID(0), phg.initialNumNodes()), 0,
+      [&](const tbb::blocked_range<HypernodeID>& range, HyperedgeWeight init) {
+        HyperedgeWeight max_degree = init;
+        for ( HypernodeID hn = range.begin(); hn < range.end(); ++hn ) {
+          if ( phg.nodeIsEnabled(hn) ) {
+            HyperedgeWeight weighted_degree = 0;
+            for ( const HyperedgeID& he : phg.incidentEdges(hn) ) {
+              weighted_degree += phg.edgeWeight(he);
+            }
+            max_degree = std::max(max_degree, weighted_degree);
+          }
+        }
+        return max_degree;
+      }, [](const HyperedgeWeight lhs, const HyperedgeWeight rhs) {
+        return std::max(lhs, rhs);
+      });
+
+    const int64_t max_gain = static_cast<int64_t>(degree_multiplier) * max_weighted_degree;
+    return max_gain > 0 && static_cast<size_t>(max_gain) <= context.refinement.fm.bucket_queue_max_gain ?
+      static_cast<Gain>(max_gain) : 0;
   }
 
   template<typename GraphAndGainTypes>
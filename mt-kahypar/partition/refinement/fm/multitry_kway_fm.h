@@ -117,6 +117,10 @@ class MultiTryKWayFM final : public IRefiner {
 
   void resizeDataStructuresForCurrentK();
 
+  // ! Returns the maximum absolute gain for the bucket priority queues of the localized searches
+  // ! on the current level, or 0 if binary heaps should be used
+  Gain computeBucketQueueMaxGain(const PartitionedHypergraph& phg) const;
+
   bool enable_light_fm = false;
   const HypernodeID initial_num_nodes;
   const Context& context;
@@ -32,6 +32,7 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/definitions.h"
 #include "mt-kahypar/utils/cast.h"
+#include "mt-kahypar/utils/tracer.h"
 #include "mt-kahypar/partition/refinement/fm/fm_commons.h"
 
 namespace mt_kahypar {
@@ -110,6 +111,7 @@ class IFMStrategy {
     tbb::task_group tg;
 
     auto task = [&](const size_t task_id) {
+      utils::ScopedTrace trace("Localized FM Search", "fm");
       LocalFM& fm = ets_fm.local();
       while(sharedData.finishedTasks.load(std::memory_order_relaxed) < sharedData.finishedTasksLimit
             && concrete_strategy.dispatchedFindMoves(fm, phg, task_id, num_seeds, round)) { /* keep running*/ }
@@ -53,8 +53,8 @@ namespace mt_kahypar {
 class LocalGainCacheStrategy {
 public:
 
-  using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, PartitionID> >;
-  using VertexPriorityQueue = ds::MaxHeap<Gain, HypernodeID>;    // these need external handles
+  using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::BucketOrHeapQueue<Gain, PartitionID> >;
+  using VertexPriorityQueue = ds::BucketOrHeapQueue<Gain, HypernodeID>;    // these need external handles
 
   static constexpr bool uses_gain_cache = true;
   static constexpr bool maintain_gain_cache_between_rounds = true;
@@ -34,6 +34,7 @@
 #include "mt-kahypar/datastructures/hypergraph_common.h"
 #include "mt-kahypar/partition/refinement/gains/gain_definitions.h"
 #include "mt-kahypar/partition/refinement/gains/km1/km1_gain_cache.h"
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
 #include "mt-kahypar/partition/refinement/gains/cut/cut_gain_cache.h"
 #include "mt-kahypar/partition/refinement/gains/soed/soed_gain_cache.h"
 #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
@@ -84,6 +85,10 @@ class GainCachePtr {
         return function(cast<GraphSteinerTreeGainCache>(gain_cache));
       #endif
       #endif
+      case GainPolicy::sparse_km1:
+      #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+        return function(cast<SparseKm1GainCache>(gain_cache));
+      #endif
       case GainPolicy::none: break;
     }
     ERR("No gain policy set");
@@ -117,6 +122,10 @@ class GainCachePtr {
         case GainPolicy::steiner_tree:
           return function(cast<SteinerTreeGainCache>(gain_cache));
         #endif
+        #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+        case GainPolicy::sparse_km1:
+          return function(cast<SparseKm1GainCache>(gain_cache));
+        #endif
         default: break;
       }
     }
@@ -133,6 +142,7 @@ class GainCachePtr {
       #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
       case GainPolicy::steiner_tree: return constructGainCache<SteinerTreeGainCache>(context);
       #endif
+      ENABLE_LARGE_K(case GainPolicy::sparse_km1: return constructGainCache<SparseKm1GainCache>(context);)
       ENABLE_GRAPHS(case GainPolicy::cut_for_graphs: return constructGainCache<GraphCutGainCache>(context);)
       #ifdef KAHYPAR_ENABLE_STEINER_TREE_METRIC
       ENABLE_GRAPHS(case GainPolicy::steiner_tree_for_graphs: return constructGainCache<GraphSteinerTreeGainCache>(context);)
@@ -37,6 +37,7 @@
 #include "mt-kahypar/partition/refinement/gains/km1/km1_gain_computation.h"
 #include "mt-kahypar/partition/refinement/gains/km1/km1_attributed_gains.h"
 #include "mt-kahypar/partition/refinement/gains/km1/km1_flow_network_construction.h"
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
 #include "mt-kahypar/partition/refinement/gains/cut/cut_gain_cache.h"
 #include "mt-kahypar/partition/refinement/gains/cut/cut_rollback.h"
 #include "mt-kahypar/partition/refinement/gains/cut/cut_gain_computation.h"
@@ -79,6 +80,15 @@ struct Km1GainTypes : public kahypar::meta::PolicyBase {
   using FlowNetworkConstruction = Km1FlowNetworkConstruction;
 };
 
+struct SparseKm1GainTypes : public kahypar::meta::PolicyBase {
+  using GainComputation = Km1GainComputation;
+  using AttributedGains = Km1AttributedGains;
+  using GainCache = SparseKm1GainCache;
+  using DeltaGainCache = DeltaSparseKm1GainCache;
+  using Rollback = Km1Rollback;
+  using FlowNetworkConstruction = Km1FlowNetworkConstruction;
+};
+
 struct CutGainTypes : public kahypar::meta::PolicyBase {
   using GainComputation = CutGainComputation;
   using AttributedGains = CutAttributedGains;
@@ -151,6 +161,7 @@ struct GraphAndGainTypes : public kahypar::meta::PolicyBase {
 
 using GainTypes = kahypar::meta::Typelist<Km1GainTypes,
                                           CutGainTypes
+                                          ENABLE_LARGE_K(COMMA SparseKm1GainTypes)
                                           ENABLE_SOED(COMMA SoedGainTypes)
                                           ENABLE_STEINER_TREE(COMMA SteinerTreeGainTypes)
                                           ENABLE_GRAPHS(COMMA CutGainForGraphsTypes)
@@ -162,6 +173,11 @@ using GainTypes = kahypar::meta::Typelist<Km1GainTypes,
   ENABLE_SOED(COMMA GraphAndGainTypes<TYPE_TRAITS COMMA SoedGainTypes>)                   \
   ENABLE_STEINER_TREE(COMMA GraphAndGainTypes<TYPE_TRAITS COMMA SteinerTreeGainTypes>)
 
+// The sparse gain cache is only used for large k
+#define _LIST_LARGE_K_HYPERGRAPH_COMBINATIONS(TYPE_TRAITS)                             \
+  _LIST_HYPERGRAPH_COMBINATIONS(TYPE_TRAITS),                                             \
+  GraphAndGainTypes<TYPE_TRAITS, SparseKm1GainTypes>
+
 #define _LIST_GRAPH_COMBINATIONS(TYPE_TRAITS)                                             \
   GraphAndGainTypes<TYPE_TRAITS, CutGainForGraphsTypes>                                      \
   ENABLE_STEINER_TREE(COMMA GraphAndGainTypes<TYPE_TRAITS COMMA SteinerTreeForGraphsTypes>)
@@ -170,7 +186,7 @@ using GraphAndGainTypesList = kahypar::meta::Typelist<_LIST_HYPERGRAPH_COMBINATI
                                                       ENABLE_GRAPHS(COMMA _LIST_GRAPH_COMBINATIONS(StaticGraphTypeTraits))
                                                       ENABLE_HIGHEST_QUALITY(COMMA _LIST_HYPERGRAPH_COMBINATIONS(DynamicHypergraphTypeTraits))
                                                       ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(COMMA _LIST_GRAPH_COMBINATIONS(DynamicGraphTypeTraits))
-                                                      ENABLE_LARGE_K(COMMA _LIST_HYPERGRAPH_COMBINATIONS(LargeKHypergraphTypeTraits))>;
+                                                      ENABLE_LARGE_K(COMMA _LIST_LARGE_K_HYPERGRAPH_COMBINATIONS(LargeKHypergraphTypeTraits))>;
 
 
 #define _INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, TYPE_TRAITS)                  \
@@ -179,6 +195,10 @@ using GraphAndGainTypesList = kahypar::meta::Typelist<_LIST_HYPERGRAPH_COMBINATI
   ENABLE_SOED(template class C(GraphAndGainTypes<TYPE_TRAITS COMMA SoedGainTypes>);)                  \
   ENABLE_STEINER_TREE(template class C(GraphAndGainTypes<TYPE_TRAITS COMMA SteinerTreeGainTypes>);)
 
+#define _INSTANTIATE_CLASS_MACRO_FOR_LARGE_K_HYPERGRAPH_COMBINATIONS(C, TYPE_TRAITS)          \
+  _INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, TYPE_TRAITS)                          \
+  template class C(GraphAndGainTypes<TYPE_TRAITS COMMA SparseKm1GainTypes>);
+
 #define _INSTANTIATE_CLASS_MACRO_FOR_GRAPH_COMBINATIONS(C, TYPE_TRAITS)                           \
   template class C(GraphAndGainTypes<TYPE_TRAITS COMMA CutGainForGraphsTypes>);                           \
   ENABLE_STEINER_TREE(template class C(GraphAndGainTypes<TYPE_TRAITS COMMA SteinerTreeForGraphsTypes>);)
@@ -189,7 +209,7 @@ using GraphAndGainTypesList = kahypar::meta::Typelist<_LIST_HYPERGRAPH_COMBINATI
   ENABLE_GRAPHS(_INSTANTIATE_CLASS_MACRO_FOR_GRAPH_COMBINATIONS(C, StaticGraphTypeTraits))                        \
   ENABLE_HIGHEST_QUALITY(_INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, DynamicHypergraphTypeTraits))    \
   ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(_INSTANTIATE_CLASS_MACRO_FOR_GRAPH_COMBINATIONS(C, DynamicGraphTypeTraits))   \
-  ENABLE_LARGE_K(_INSTANTIATE_CLASS_MACRO_FOR_HYPERGRAPH_COMBINATIONS(C, LargeKHypergraphTypeTraits))
+  ENABLE_LARGE_K(_INSTANTIATE_CLASS_MACRO_FOR_LARGE_K_HYPERGRAPH_COMBINATIONS(C, LargeKHypergraphTypeTraits))
 
 
 // functionality for retrieving combined policy of partition type and gain
@@ -211,6 +231,13 @@ using GraphAndGainTypesList = kahypar::meta::Typelist<_LIST_HYPERGRAPH_COMBINATI
   }                                                                                           \
 }
 
+#define SWITCH_LARGE_K_HYPERGRAPH_GAIN_TYPES(TYPE_TRAITS, gain_policy) {                      \
+  if ( gain_policy == GainPolicy::sparse_km1 ) {                                              \
+    _RETURN_COMBINED_POLICY(TYPE_TRAITS, SparseKm1GainTypes)                                  \
+  }                                                                                           \
+  SWITCH_HYPERGRAPH_GAIN_TYPES(TYPE_TRAITS, gain_policy)                                      \
+}
+
 #define SWITCH_GRAPH_GAIN_TYPES(TYPE_TRAITS, gain_policy) {                                                   \
   switch ( gain_policy ) {                                                                                    \
     case GainPolicy::cut_for_graphs:                                                                          \
@@ -0,0 +1,377 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
+
+#include <functional>
+
+#include <tbb/parallel_for.h>
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/parallel/parallel_prefix_sum.h"
+
+namespace mt_kahypar {
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::allocateGainTable(const PartitionedHypergraph& partitioned_hg) {
+  const HypernodeID num_nodes = partitioned_hg.initialNumNodes();
+  _k = partitioned_hg.k();
+  if ( _penalty.size() < num_nodes ) {
+    _penalty = ds::Array< CAtomic<HyperedgeWeight> >(num_nodes);
+    _offsets = ds::Array<size_t>(num_nodes + 1);
+    _num_entries = ds::Array< CAtomic<uint32_t> >(num_nodes);
+    _num_overflow_entries = ds::Array< CAtomic<uint32_t> >(num_nodes);
+    _node_locks = ds::Array<SpinLock>(num_nodes);
+  }
+  _num_nodes = num_nodes;
+
+  // Compute the number of entries of each node
+  _offsets[0] = 0;
+  tbb::parallel_for(ID(0), num_nodes, [&](const HypernodeID u) {
+    size_t num_entries = 0;
+    if ( partitioned_hg.nodeIsEnabled(u) ) {
+      num_entries = 1;
+      for ( const HyperedgeID& he : partitioned_hg.incidentEdges(u) ) {
+        num_entries += std::min(static_cast<size_t>(
+          partitioned_hg.edgeSize(he) - 1), MAX_ENTRIES_PER_INCIDENT_NET);
+        if ( num_entries >= static_cast<size_t>(_k) ) break;
+      }
+    }
+    _offsets[u + 1] = std::min(num_entries, static_cast<size_t>(_k));
+  });
+  parallel_prefix_sum(_offsets.begin() + 1, _offsets.begin() + num_nodes + 1,
+    _offsets.begin() + 1, std::plus<size_t>(), UL(0));
+
+  const size_t total_entries = _offsets[num_nodes];
+  if ( _entries.size() < total_entries ) {
+    _entries = ds::Array< CAtomic<Entry> >(total_entries);
+  }
+  _overflow.clear();
+  _overflow_blocks.clear();
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::initializeGainCache(const PartitionedHypergraph& partitioned_hg) {
+  ASSERT(!_is_initialized, "Gain cache is already initialized");
+  allocateGainTable(partitioned_hg);
+
+  tbb::enumerable_thread_specific< vec<HyperedgeWeight> > ets_benefit(_k, 0);
+  tbb::enumerable_thread_specific< vec<PartitionID> > ets_adjacent_blocks;
+  tbb::parallel_for(tbb::blocked_range<HypernodeID>(HypernodeID(0), _num_nodes),
+    [&](tbb::blocked_range<HypernodeID>& r) {
+      vec<HyperedgeWeight>& benefit_aggregator = ets_benefit.local();
+      vec<PartitionID>& adjacent_blocks = ets_adjacent_blocks.local();
+      for (HypernodeID u = r.begin(); u < r.end(); ++u) {
+        initializeGainCacheEntryForNode(partitioned_hg, u, benefit_aggregator, adjacent_blocks);
+      }
+    });
+
+  _is_initialized = true;
+}
+
+bool SparseKm1GainCache::triggersDeltaGainUpdate(const SynchronizedEdgeUpdate& sync_update) {
+  return sync_update.pin_count_in_from_part_after == 0 ||
+         sync_update.pin_count_in_from_part_after == 1 ||
+         sync_update.pin_count_in_to_part_after == 1 ||
+         sync_update.pin_count_in_to_part_after == 2;
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
+                                         const SynchronizedEdgeUpdate& sync_update) {
+  ASSERT(_is_initialized, "Gain cache is not initialized");
+  const HyperedgeID he = sync_update.he;
+  const PartitionID from = sync_update.from;
+  const PartitionID to = sync_update.to;
+  const HyperedgeWeight edge_weight = sync_update.edge_weight;
+  const HypernodeID pin_count_in_from_part_after = sync_update.pin_count_in_from_part_after;
+  const HypernodeID pin_count_in_to_part_after = sync_update.pin_count_in_to_part_after;
+  if ( pin_count_in_from_part_after == 1 ) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      if (partitioned_hg.partID(u) == from) {
+        _penalty[u].fetch_sub(edge_weight, std::memory_order_relaxed);
+      }
+    }
+  } else if (pin_count_in_from_part_after == 0) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      updateBenefitTerm(u, from, -edge_weight);
+    }
+  }
+
+  if (pin_count_in_to_part_after == 1) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      updateBenefitTerm(u, to, edge_weight);
+    }
+  } else if (pin_count_in_to_part_after == 2) {
+    for (const HypernodeID& u : partitioned_hg.pins(he)) {
+      if (partitioned_hg.partID(u) == to) {
+        _penalty[u].fetch_add(edge_weight, std::memory_order_relaxed);
+      }
+    }
+  }
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::uncontractUpdateAfterRestore(const PartitionedHypergraph& partitioned_hg,
+                                                      const HypernodeID u,
+                                                      const HypernodeID v,
+                                                      const HyperedgeID he,
+                                                      const HypernodeID pin_count_in_part_after) {
+  if ( _is_initialized ) {
+    // If u was the only pin of hyperedge he in its block before then moving out vertex u
+    // of hyperedge he does not decrease the connectivity any more after the
+    // uncontraction => p(u) += w(he)
+    const PartitionID block = partitioned_hg.partID(u);
+    const HyperedgeWeight edge_weight = partitioned_hg.edgeWeight(he);
+    if ( pin_count_in_part_after == 2 ) {
+      // u might be replaced by an other vertex in the batch
+      // => search for other pin of the corresponding block and
+      // add edge weight.
+      for ( const HypernodeID& pin : partitioned_hg.pins(he) ) {
+        if ( pin != v && partitioned_hg.partID(pin) == block ) {
+          _penalty[pin].add_fetch(edge_weight, std::memory_order_relaxed);
+          break;
+        }
+      }
+    }
+
+    _penalty[v].add_fetch(edge_weight, std::memory_order_relaxed);
+    // For all blocks contained in the connectivity set of hyperedge he
+    // we increase the b(u, block) for vertex v by w(e)
+    for ( const PartitionID block : partitioned_hg.connectivitySet(he) ) {
+      updateBenefitTerm(v, block, edge_weight);
+    }
+  }
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::uncontractUpdateAfterReplacement(const PartitionedHypergraph& partitioned_hg,
+                                                          const HypernodeID u,
+                                                          const HypernodeID v,
+                                                          const HyperedgeID he) {
+  // In this case, u is replaced by v in hyperedge he
+  // => Pin counts of hyperedge he does not change
+  if ( _is_initialized ) {
+    const PartitionID block = partitioned_hg.partID(u);
+    const HyperedgeWeight edge_weight = partitioned_hg.edgeWeight(he);
+    // Since u is no longer incident to hyperedge he its contribution for decreasing
+    // the connectivity of he is shifted to vertex v
+    if ( partitioned_hg.pinCountInPart(he, block) == 1 ) {
+      _penalty[u].add_fetch(edge_weight, std::memory_order_relaxed);
+      _penalty[v].sub_fetch(edge_weight, std::memory_order_relaxed);
+    }
+
+    _penalty[u].sub_fetch(edge_weight, std::memory_order_relaxed);
+    _penalty[v].add_fetch(edge_weight, std::memory_order_relaxed);
+    // For all blocks contained in the connectivity set of hyperedge he
+    // we increase the move_to_benefit for vertex v by w(e) and decrease
+    // it for vertex u by w(e)
+    for ( const PartitionID block : partitioned_hg.connectivitySet(he) ) {
+      updateBenefitTerm(u, block, -edge_weight);
+      updateBenefitTerm(v, block, edge_weight);
+    }
+  }
+}
+
+void SparseKm1GainCache::restoreSinglePinHyperedge(const HypernodeID u,
+                                                   const PartitionID block_of_u,
+                                                   const HyperedgeWeight weight_of_he) {
+  if ( _is_initialized ) {
+    updateBenefitTerm(u, block_of_u, weight_of_he);
+  }
+}
+
+template<typename PartitionedHypergraph>
+bool SparseKm1GainCache::verifyTrackedAdjacentBlocksOfNodes(const PartitionedHypergraph& partitioned_hg) const {
+  bool success = true;
+  vec<bool> is_adjacent(_k, false);
+  for ( const HypernodeID& u : partitioned_hg.nodes() ) {
+    for ( const HyperedgeID& he : partitioned_hg.incidentEdges(u) ) {
+      for ( const PartitionID& block : partitioned_hg.connectivitySet(he) ) {
+        is_adjacent[block] = true;
+      }
+    }
+
+    for ( const PartitionID& block : adjacentBlocks(u) ) {
+      if ( !is_adjacent[block] ) {
+        LOG << "Block" << block << "is not adjacent to node" << u
+            << ", but is stored in the gain cache";
+        success = false;
+      }
+    }
+
+    for ( PartitionID block = 0; block < _k; ++block ) {
+      if ( is_adjacent[block] && benefitTerm(u, block) == 0 &&
+           recomputeBenefitTerm(partitioned_hg, u, block) > 0 ) {
+        LOG << "Block" << block << "is adjacent to node" << u
+            << ", but is not stored in the gain cache";
+        success = false;
+      }
+      is_adjacent[block] = false;
+    }
+  }
+  return success;
+}
+
+void SparseKm1GainCache::updateBenefitTerm(const HypernodeID u,
+                                           const PartitionID p,
+                                           const HyperedgeWeight delta) {
+  ASSERT(u < _num_nodes && p != kInvalidPartition && p < _k);
+  _node_locks[u].lock();
+  const size_t begin = _offsets[u];
+  const size_t num_entries = _num_entries[u].load(std::memory_order_relaxed);
+  for ( size_t pos = begin; pos < begin + num_entries; ++pos ) {
+    const Entry entry = _entries[pos].load(std::memory_order_relaxed);
+    if ( blockOf(entry) == p ) {
+      const HyperedgeWeight benefit = benefitOf(entry) + delta;
+      if ( benefit == 0 ) {
+        // Block is no longer adjacent to u => replace it with the last entry
+        const size_t last = begin + num_entries - 1;
+        _entries[pos].store(_entries[last].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        _entries[last].store(makeEntry(kInvalidPartition, 0), std::memory_order_relaxed);
+        _num_entries[u].store(num_entries - 1, std::memory_order_relaxed);
+      } else {
+        _entries[pos].store(makeEntry(p, benefit), std::memory_order_relaxed);
+      }
+      _node_locks[u].unlock();
+      return;
+    }
+  }
+
+  if ( unlikely(_num_overflow_entries[u].load(std::memory_order_relaxed) > 0) ) {
+    OverflowTable::accessor acc;
+    if ( _overflow.find(acc, benefit_key(u, p)) ) {
+      acc->second.benefit += delta;
+      if ( acc->second.benefit == 0 ) {
+        // Block is no longer adjacent to u => replace it with the last overflow block
+        const uint32_t pos = acc->second.pos;
+        _overflow.erase(acc);
+        OverflowBlocks::accessor blocks_acc;
+        const bool found = _overflow_blocks.find(blocks_acc, u);
+        ASSERT(found && pos < blocks_acc->second.size()); unused(found);
+        vec<PartitionID>& blocks = blocks_acc->second;
+        const PartitionID last = blocks.back();
+        blocks[pos] = last;
+        blocks.pop_back();
+        if ( last != p ) {
+          OverflowTable::accessor last_acc;
+          _overflow.find(last_acc, benefit_key(u, last));
+          last_acc->second.pos = pos;
+        }
+        if ( blocks.empty() ) {
+          _overflow_blocks.erase(blocks_acc);
+        }
+        _num_overflow_entries[u].sub_fetch(1, std::memory_order_relaxed);
+      }
+      _node_locks[u].unlock();
+      return;
+    }
+  }
+
+  // Block is not contained in the entries of node u
+  if ( begin + num_entries < _offsets[u + 1] ) {
+    _entries[begin + num_entries].store(makeEntry(p, delta), std::memory_order_relaxed);
+    _num_entries[u].store(num_entries + 1, std::memory_order_relaxed);
+  } else {
+    // All entries of node u are in use => store benefit term in external hash table
+    insertOverflowEntry(u, p, delta);
+    _num_overflow_entries[u].add_fetch(1, std::memory_order_relaxed);
+  }
+  _node_locks[u].unlock();
+}
+
+template<typename PartitionedHypergraph>
+void SparseKm1GainCache::initializeGainCacheEntryForNode(const PartitionedHypergraph& partitioned_hg,
+                                                         const HypernodeID u,
+                                                         vec<Gain>& benefit_aggregator,
+                                                         vec<PartitionID>& adjacent_blocks) {
+  Gain penalty = 0;
+  if ( partitioned_hg.nodeIsEnabled(u) ) {
+    const PartitionID from = partitioned_hg.partID(u);
+    for (const HyperedgeID& e : partitioned_hg.incidentEdges(u)) {
+      const HyperedgeWeight ew = partitioned_hg.edgeWeight(e);
+      if ( partitioned_hg.pinCountInPart(e, from) > 1 ) {
+        penalty += ew;
+      }
+      if ( ew != 0 ) {
+        for (const PartitionID& i : partitioned_hg.connectivitySet(e)) {
+          if ( benefit_aggregator[i] == 0 ) {
+            adjacent_blocks.push_back(i);
+          }
+          benefit_aggregator[i] += ew;
+        }
+      }
+    }
+  }
+
+  _penalty[u].store(penalty, std::memory_order_relaxed);
+  const size_t begin = _offsets[u];
+  const size_t end = _offsets[u + 1];
+  size_t pos = begin;
+  uint32_t num_overflow_entries = 0;
+  for ( const PartitionID& block : adjacent_blocks ) {
+    if ( benefit_aggregator[block] != 0 ) {
+      if ( pos < end ) {
+        _entries[pos++].store(makeEntry(block, benefit_aggregator[block]), std::memory_order_relaxed);
+      } else {
+        insertOverflowEntry(u, block, benefit_aggregator[block]);
+        ++num_overflow_entries;
+      }
+    }
+    benefit_aggregator[block] = 0;
+  }
+  _num_entries[u].store(pos - begin, std::memory_order_relaxed);
+  _num_overflow_entries[u].store(num_overflow_entries, std::memory_order_relaxed);
+  for ( ; pos < end; ++pos ) {
+    _entries[pos].store(makeEntry(kInvalidPartition, 0), std::memory_order_relaxed);
+  }
+  adjacent_blocks.clear();
+}
+
+namespace {
+#define SPARSE_KM1_INITIALIZE_GAIN_CACHE(X) void SparseKm1GainCache::initializeGainCache(const X&)
+#define SPARSE_KM1_DELTA_GAIN_UPDATE(X) void SparseKm1GainCache::deltaGainUpdate(const X&,                     \
+                                                                                const SynchronizedEdgeUpdate&)
+#define SPARSE_KM1_RESTORE_UPDATE(X) void SparseKm1GainCache::uncontractUpdateAfterRestore(const X&,          \
+                                                                                          const HypernodeID, \
+                                                                                          const HypernodeID, \
+                                                                                          const HyperedgeID, \
+                                                                                          const HypernodeID)
+#define SPARSE_KM1_REPLACEMENT_UPDATE(X) void SparseKm1GainCache::uncontractUpdateAfterReplacement(const X&,            \
+                                                                                                  const HypernodeID,   \
+                                                                                                  const HypernodeID,   \
+                                                                                                  const HyperedgeID)
+#define SPARSE_KM1_VERIFY_ADJACENT_BLOCKS(X) bool SparseKm1GainCache::verifyTrackedAdjacentBlocksOfNodes(const X&) const
+}
+
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_INITIALIZE_GAIN_CACHE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_DELTA_GAIN_UPDATE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_RESTORE_UPDATE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_REPLACEMENT_UPDATE)
+INSTANTIATE_FUNC_WITH_PARTITIONED_HG(SPARSE_KM1_VERIFY_ADJACENT_BLOCKS)
+
+}  // namespace mt_kahypar
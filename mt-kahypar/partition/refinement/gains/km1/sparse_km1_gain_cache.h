@@ -0,0 +1,633 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+#include <tbb/concurrent_hash_map.h>
+
+#include "kahypar-resources/meta/policy_registry.h"
+
+#include "mt-kahypar/partition/context_enum_classes.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+#include "mt-kahypar/datastructures/array.h"
+#include "mt-kahypar/datastructures/sparse_map.h"
+#include "mt-kahypar/parallel/atomic_wrapper.h"
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/range.h"
+#include "mt-kahypar/partition/context.h"
+
+namespace mt_kahypar {
+
+/**
+ * Sparse variant of the gain cache for the connectivity metric (see Km1GainCache for
+ * the definition of the benefit and penalty terms).
+ *
+ * The dense gain cache stores k + 1 entries per node, which is infeasible if k is large.
+ * However, the benefit term b(u, V_j) is zero for all blocks V_j that are not adjacent to u.
+ * This gain cache therefore only stores the benefit terms of the adjacent blocks of a node.
+ * Node u reserves min(k, 1 + \sum_{e \in I(u)} min(|e| - 1, c)) entries of the form (block, benefit),
+ * which is an upper bound for the number of adjacent blocks if all incident nets contain at most c + 1
+ * pins. Thus, the gain cache takes O(c * \sum_{u \in V} d(u)) space. Similar to the sparse pin count
+ * data structure, adjacent blocks that do not fit into the entries of a node are stored in an
+ * external hash table, which should happen rarely in practice.
+ *
+ * Entries of a node are modified while holding a node lock, whereas reads are lock-free. Since the
+ * block ID and benefit term are stored in one 64-bit word, a reader always observes a consistent entry.
+*/
+class SparseKm1GainCache {
+
+  static constexpr size_t MAX_ENTRIES_PER_INCIDENT_NET = 8; // = c
+
+  using Entry = uint64_t;
+
+  // ! Benefit term stored in the external hash table and the position of
+  // ! the corresponding block in the overflow block list of the node
+  struct OverflowEntry {
+    HyperedgeWeight benefit;
+    uint32_t pos;
+  };
+  using OverflowTable = tbb::concurrent_hash_map<size_t, OverflowEntry>;
+  using OverflowBlocks = tbb::concurrent_hash_map<HypernodeID, vec<PartitionID>>;
+
+  static_assert(sizeof(PartitionID) == 4 && sizeof(HyperedgeWeight) == 4,
+    "Block ID and benefit term must fit into a 64-bit word");
+
+ public:
+  // ! Iterates over all blocks with a positive benefit term of a node. We first enumerate
+  // ! the entries of the node and afterwards the blocks stored in the external hash table.
+  class AdjacentBlocksIterator {
+   public:
+    static constexpr uint32_t END_OF_OVERFLOW = std::numeric_limits<uint32_t>::max();
+
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = PartitionID;
+    using reference = PartitionID&;
+    using pointer = PartitionID*;
+    using difference_type = std::ptrdiff_t;
+
+    AdjacentBlocksIterator(const SparseKm1GainCache* gain_cache,
+                           const HypernodeID u,
+                           const CAtomic<Entry>* pos,
+                           const CAtomic<Entry>* end,
+                           const uint32_t overflow_pos) :
+      _gain_cache(gain_cache),
+      _u(u),
+      _pos(pos),
+      _end(end),
+      _overflow_pos(overflow_pos),
+      _block(kInvalidPartition) {
+      next_valid_entry();
+    }
+
+    PartitionID operator*() const {
+      return _block;
+    }
+
+    AdjacentBlocksIterator& operator++() {
+      advance();
+      return *this;
+    }
+
+    AdjacentBlocksIterator operator++(int ) {
+      const AdjacentBlocksIterator res = *this;
+      advance();
+      return res;
+    }
+
+    bool operator==(const AdjacentBlocksIterator& o) const {
+      return _pos == o._pos && _end == o._end && _overflow_pos == o._overflow_pos;
+    }
+
+    bool operator!=(const AdjacentBlocksIterator& o) const {
+      return !operator==(o);
+    }
+
+   private:
+    void advance() {
+      if ( _pos < _end ) {
+        ++_pos;
+      } else {
+        ++_overflow_pos;
+      }
+      next_valid_entry();
+    }
+
+    void next_valid_entry() {
+      // Entries can change due to concurrent writes.
+      // Therefore, we only return valid entries.
+      for ( ; _pos < _end; ++_pos ) {
+        const Entry entry = _pos->load(std::memory_order_relaxed);
+        if ( blockOf(entry) != kInvalidPartition && benefitOf(entry) > 0 ) {
+          _block = blockOf(entry);
+          return;
+        }
+      }
+
+      // A block is either stored in the entries of a node or in the external hash table.
+      // Blocks in the hash table are enumerated via the overflow block list of the node,
+      // which only exists if the node has overflowing entries (rare).
+      if ( _overflow_pos != END_OF_OVERFLOW ) {
+        OverflowBlocks::const_accessor acc;
+        if ( _gain_cache->_overflow_blocks.find(acc, _u) && _overflow_pos < acc->second.size() ) {
+          _block = acc->second[_overflow_pos];
+          return;
+        }
+        _overflow_pos = END_OF_OVERFLOW;
+      }
+    }
+
+    const SparseKm1GainCache* _gain_cache;
+    HypernodeID _u;
+    const CAtomic<Entry>* _pos;
+    const CAtomic<Entry>* _end;
+    uint32_t _overflow_pos;
+    PartitionID _block;
+  };
+
+  static constexpr GainPolicy TYPE = GainPolicy::sparse_km1;
+  static constexpr bool requires_notification_before_update = false;
+  static constexpr bool initializes_gain_cache_entry_after_batch_uncontractions = false;
+  static constexpr bool invalidates_entries = true;
+
+  SparseKm1GainCache() :
+    _is_initialized(false),
+    _k(kInvalidPartition),
+    _num_nodes(0),
+    _penalty(),
+    _offsets(),
+    _num_entries(),
+    _num_overflow_entries(),
+    _entries(),
+    _node_locks(),
+    _overflow(),
+    _overflow_blocks() { }
+
+  SparseKm1GainCache(const Context&) :
+    SparseKm1GainCache() { }
+
+  SparseKm1GainCache(const SparseKm1GainCache&) = delete;
+  SparseKm1GainCache & operator= (const SparseKm1GainCache &) = delete;
+
+  SparseKm1GainCache(SparseKm1GainCache&& other) = default;
+  SparseKm1GainCache & operator= (SparseKm1GainCache&& other) = default;
+
+  // ####################### Initialization #######################
+
+  bool isInitialized() const {
+    return _is_initialized;
+  }
+
+  void reset(const bool run_parallel = true) {
+    unused(run_parallel);
+    _is_initialized = false;
+  }
+
+  size_t size() const {
+    return _penalty.size() + _entries.size();
+  }
+
+  // ! Upper bound for the memory consumption (in bytes) of the gain cache
+  // ! of a hypergraph with the given number of nodes and total vertex degree
+  static size_t size_in_bytes(const HypernodeID num_nodes,
+                              const HypernodeID total_degree,
+                              const PartitionID k) {
+    const size_t num_entries = std::min(static_cast<size_t>(num_nodes) * k,
+      num_nodes + MAX_ENTRIES_PER_INCIDENT_NET * total_degree);
+    return num_nodes * ( sizeof(CAtomic<HyperedgeWeight>) + sizeof(size_t) +
+      2 * sizeof(CAtomic<uint32_t>) + sizeof(SpinLock) ) + num_entries * sizeof(CAtomic<Entry>);
+  }
+
+  // ! Initializes all gain cache entries. Since the number of entries of a node
+  // ! depends on its incident nets, this also recomputes the memory layout.
+  template<typename PartitionedHypergraph>
+  void initializeGainCache(const PartitionedHypergraph& partitioned_hg);
+
+  template<typename PartitionedHypergraph>
+  void initializeGainCacheEntryForNode(const PartitionedHypergraph&,
+                                       const HypernodeID&) {
+    // Do nothing
+  }
+
+  // ! Returns an iterator over the adjacent blocks of a node
+  IteratorRange<AdjacentBlocksIterator> adjacentBlocks(const HypernodeID u) const {
+    ASSERT(u < _num_nodes);
+    const CAtomic<Entry>* begin = _entries.data() + _offsets[u];
+    const CAtomic<Entry>* end = begin + numEntries(u);
+    const uint32_t first_overflow_pos =
+      _num_overflow_entries[u].load(std::memory_order_relaxed) > 0 ?
+        0 : AdjacentBlocksIterator::END_OF_OVERFLOW;
+    return IteratorRange<AdjacentBlocksIterator>(
+      AdjacentBlocksIterator(this, u, begin, end, first_overflow_pos),
+      AdjacentBlocksIterator(this, u, end, end, AdjacentBlocksIterator::END_OF_OVERFLOW));
+  }
+
+  // ####################### Gain Computation #######################
+
+  // ! Returns the penalty term of node u.
+  // ! More formally, p(u) := w({ e \in I(u) | pin_count(e, V_i) > 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight penaltyTerm(const HypernodeID u,
+                              const PartitionID /* only relevant for graphs */) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    return _penalty[u].load(std::memory_order_relaxed);
+  }
+
+  // ! Recomputes the penalty term entry in the gain cache
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void recomputeInvalidTerms(const PartitionedHypergraph& partitioned_hg,
+                             const HypernodeID u) {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    _penalty[u].store(recomputePenaltyTerm(
+      partitioned_hg, u), std::memory_order_relaxed);
+  }
+
+  // ! Returns the benefit term for moving node u to block to.
+  // ! More formally, b(u, V_j) := w({ e \in I(u) | pin_count(e, V_j) >= 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight benefitTerm(const HypernodeID u, const PartitionID to) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    ASSERT(to != kInvalidPartition && to < _k);
+    const size_t begin = _offsets[u];
+    const size_t end = begin + numEntries(u);
+    for ( size_t pos = begin; pos < end; ++pos ) {
+      const Entry entry = _entries[pos].load(std::memory_order_relaxed);
+      if ( blockOf(entry) == to ) {
+        return benefitOf(entry);
+      }
+    }
+    if ( unlikely(_num_overflow_entries[u].load(std::memory_order_relaxed) > 0) ) {
+      OverflowTable::const_accessor acc;
+      if ( _overflow.find(acc, benefit_key(u, to)) ) {
+        return acc->second.benefit;
+      }
+    }
+    return 0;
+  }
+
+  // ! Returns the gain of moving node u from its current block to a target block V_j.
+  // ! More formally, g(u, V_j) := b(u, V_j) - p(u).
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight gain(const HypernodeID u,
+                       const PartitionID, /* only relevant for graphs */
+                       const PartitionID to ) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    return benefitTerm(u, to) - penaltyTerm(u, kInvalidPartition);
+  }
+
+  // ####################### Delta Gain Update #######################
+
+  // ! This function returns true if the corresponding syncronized edge update triggers
+  // ! a gain cache update.
+  static bool triggersDeltaGainUpdate(const SynchronizedEdgeUpdate& sync_update);
+
+  // ! The partitioned (hyper)graph call this function when its updates its internal
+  // ! data structures before calling the delta gain update function. The partitioned
+  // ! (hyper)graph holds a lock for the corresponding (hyper)edge when calling this
+  // ! function. Thus, it is guaranteed that no other thread will modify the hyperedge.
+  template<typename PartitionedHypergraph>
+  void notifyBeforeDeltaGainUpdate(const PartitionedHypergraph&, const SynchronizedEdgeUpdate&) {
+    // Do nothing
+  }
+
+  // ! This functions implements the delta gain updates for the connecitivity metric.
+  // ! A block is inserted into the entries of a node when its benefit term becomes
+  // ! positive and removed when it drops to zero again.
+  template<typename PartitionedHypergraph>
+  void deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
+                       const SynchronizedEdgeUpdate& sync_update);
+
+  // ####################### Uncontraction #######################
+
+  // ! This function implements the gain cache update after an uncontraction that restores node v in
+  // ! hyperedge he. After the uncontraction operation, node u and v are contained in hyperedge he.
+  template<typename PartitionedHypergraph>
+  void uncontractUpdateAfterRestore(const PartitionedHypergraph& partitioned_hg,
+                                    const HypernodeID u,
+                                    const HypernodeID v,
+                                    const HyperedgeID he,
+                                    const HypernodeID pin_count_in_part_after);
+
+  // ! This function implements the gain cache update after an uncontraction that replaces u with v in
+  // ! hyperedge he. After the uncontraction only node v is contained in hyperedge he.
+  template<typename PartitionedHypergraph>
+  void uncontractUpdateAfterReplacement(const PartitionedHypergraph& partitioned_hg,
+                                        const HypernodeID u,
+                                        const HypernodeID v,
+                                        const HyperedgeID he);
+
+  // ! This function is called after restoring a single-pin hyperedge. The function assumes that
+  // ! u is the only pin of the corresponding hyperedge, while block_of_u is its corresponding block ID.
+  void restoreSinglePinHyperedge(const HypernodeID u,
+                                 const PartitionID block_of_u,
+                                 const HyperedgeWeight weight_of_he);
+
+  // ! This function is called after restoring a net that became identical to another due to a contraction.
+  template<typename PartitionedHypergraph>
+  void restoreIdenticalHyperedge(const PartitionedHypergraph&,
+                                 const HyperedgeID) {
+    // Do nothing
+  }
+
+  // ! Notifies the gain cache that all uncontractions of the current batch are completed.
+  void batchUncontractionsCompleted() {
+    // Do nothing
+  }
+
+  // ####################### Only for Testing #######################
+
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight recomputePenaltyTerm(const PartitionedHypergraph& partitioned_hg,
+                                       const HypernodeID u) const {
+    ASSERT(_is_initialized, "Gain cache is not initialized");
+    const PartitionID block_of_u = partitioned_hg.partID(u);
+    HyperedgeWeight penalty = 0;
+    for (HyperedgeID e : partitioned_hg.incidentEdges(u)) {
+      if ( partitioned_hg.pinCountInPart(e, block_of_u) > 1 ) {
+        penalty += partitioned_hg.edgeWeight(e);
+      }
+    }
+    return penalty;
+  }
+
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight recomputeBenefitTerm(const PartitionedHypergraph& partitioned_hg,
+                                       const HypernodeID u,
+                                       const PartitionID to) const {
+    HyperedgeWeight benefit = 0;
+    for (HyperedgeID e : partitioned_hg.incidentEdges(u)) {
+      if (partitioned_hg.pinCountInPart(e, to) >= 1) {
+        benefit += partitioned_hg.edgeWeight(e);
+      }
+    }
+    return benefit;
+  }
+
+  void changeNumberOfBlocks(const PartitionID new_k) {
+    // Only blocks that are adjacent to a node are stored in the gain cache.
+    // Blocks with an ID larger than new_k are therefore never contained.
+    ASSERT(new_k <= _k);
+    unused(new_k);
+  }
+
+  template<typename PartitionedHypergraph>
+  bool verifyTrackedAdjacentBlocksOfNodes(const PartitionedHypergraph& partitioned_hg) const;
+
+ private:
+  friend class DeltaSparseKm1GainCache;
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static Entry makeEntry(const PartitionID block, const HyperedgeWeight benefit) {
+    return ( static_cast<Entry>(static_cast<uint32_t>(block)) << 32 ) |
+      static_cast<Entry>(static_cast<uint32_t>(benefit));
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static PartitionID blockOf(const Entry entry) {
+    return static_cast<PartitionID>(static_cast<uint32_t>(entry >> 32));
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  static HyperedgeWeight benefitOf(const Entry entry) {
+    return static_cast<HyperedgeWeight>(static_cast<uint32_t>(entry));
+  }
+
+  // ! Unique key of the penalty term of node u (used by the delta gain cache)
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t penalty_key(const HypernodeID u) const {
+    return size_t(u) * ( _k + 1 );
+  }
+
+  // ! Unique key of the benefit term of node u and block p (used by the
+  // ! delta gain cache and the external hash table)
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t benefit_key(const HypernodeID u, const PartitionID p) const {
+    return size_t(u) * ( _k + 1 )  + p + 1;
+  }
+
+  // ! Stores the benefit term b(u, p) in the external hash table and appends
+  // ! p to the overflow block list of u (requires the node lock of u)
+  void insertOverflowEntry(const HypernodeID u, const PartitionID p, const HyperedgeWeight benefit) {
+    OverflowBlocks::accessor blocks_acc;
+    _overflow_blocks.insert(blocks_acc, u);
+    OverflowTable::accessor acc;
+    _overflow.insert(acc, benefit_key(u, p));
+    acc->second = OverflowEntry { benefit, static_cast<uint32_t>(blocks_acc->second.size()) };
+    blocks_acc->second.push_back(p);
+  }
+
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  size_t numEntries(const HypernodeID u) const {
+    // Due to concurrent writes, the number of entries can temporarily
+    // exceed the capacity of the node.
+    return std::min(static_cast<size_t>(_num_entries[u].load(std::memory_order_relaxed)),
+                    _offsets[u + 1] - _offsets[u]);
+  }
+
+  // ! Adds delta to the benefit term b(u, p). Inserts the block if it is not
+  // ! contained in the entries of u and removes it if its benefit term becomes zero.
+  void updateBenefitTerm(const HypernodeID u,
+                         const PartitionID p,
+                         const HyperedgeWeight delta);
+
+  // ! Computes the number of entries of each node and allocates the gain cache
+  template<typename PartitionedHypergraph>
+  void allocateGainTable(const PartitionedHypergraph& partitioned_hg);
+
+  // ! Initializes the benefit and penalty terms for a node u
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void initializeGainCacheEntryForNode(const PartitionedHypergraph& partitioned_hg,
+                                       const HypernodeID u,
+                                       vec<Gain>& benefit_aggregator,
+                                       vec<PartitionID>& adjacent_blocks);
+
+  // ! Indicate whether or not the gain cache is initialized
+  bool _is_initialized;
+
+  // ! Number of blocks
+  PartitionID _k;
+
+  // ! Number of nodes of the current hypergraph
+  HypernodeID _num_nodes;
+
+  // ! Stores the penalty term of each node
+  ds::Array< CAtomic<HyperedgeWeight> > _penalty;
+
+  // ! Entries of node u are stored in the range [_offsets[u], _offsets[u + 1])
+  ds::Array<size_t> _offsets;
+
+  // ! Number of used entries of each node
+  ds::Array< CAtomic<uint32_t> > _num_entries;
+
+  // ! Number of benefit terms of each node stored in the external hash table
+  ds::Array< CAtomic<uint32_t> > _num_overflow_entries;
+
+  // ! Stores the (block, benefit) pairs of all nodes
+  ds::Array< CAtomic<Entry> > _entries;
+
+  // ! Serializes modifications of the entries of a node
+  ds::Array<SpinLock> _node_locks;
+
+  // ! Benefit terms that do not fit into the entries of a node
+  OverflowTable _overflow;
+
+  // ! Blocks of each node stored in the external hash table. Modified while holding
+  // ! the node lock and used to enumerate the overflowing blocks without probing all k blocks.
+  OverflowBlocks _overflow_blocks;
+};
+
+/**
+ * Delta gain cache for the sparse connectivity gain cache. It stores the local changes
+ * of the penalty and benefit terms in a hash table (see DeltaKm1GainCache).
+ * The adjacent blocks are the ones of the shared gain cache. Blocks that become
+ * adjacent due to local moves are visible once the moves are applied globally.
+*/
+class DeltaSparseKm1GainCache {
+
+  using AdjacentBlocksIterator = typename SparseKm1GainCache::AdjacentBlocksIterator;
+
+ public:
+  static constexpr bool requires_connectivity_set = false;
+
+  DeltaSparseKm1GainCache(const SparseKm1GainCache& gain_cache) :
+    _gain_cache(gain_cache),
+    _gain_cache_delta() { }
+
+  // ####################### Initialize & Reset #######################
+
+  void initialize(const size_t size) {
+    _gain_cache_delta.initialize(size);
+  }
+
+  void clear() {
+    _gain_cache_delta.clear();
+  }
+
+  void dropMemory() {
+    _gain_cache_delta.freeInternalData();
+  }
+
+  size_t size_in_bytes() const {
+    return _gain_cache_delta.size_in_bytes();
+  }
+
+  // ####################### Gain Computation #######################
+
+  // ! Returns an iterator over the adjacent blocks of a node
+  IteratorRange<AdjacentBlocksIterator> adjacentBlocks(const HypernodeID hn) const {
+    return _gain_cache.adjacentBlocks(hn);
+  }
+
+  // ! Returns the penalty term of node u.
+  // ! More formally, p(u) := w({ e \in I(u) | pin_count(e, V_i) > 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight penaltyTerm(const HypernodeID u,
+                              const PartitionID from) const {
+    const HyperedgeWeight* penalty_delta =
+      _gain_cache_delta.get_if_contained(_gain_cache.penalty_key(u));
+    return _gain_cache.penaltyTerm(u, from) + ( penalty_delta ? *penalty_delta : 0 );
+  }
+
+  // ! Returns the benefit term for moving node u to block to.
+  // ! More formally, b(u, V_j) := w({ e \in I(u) | pin_count(e, V_j) >= 1 })
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight benefitTerm(const HypernodeID u, const PartitionID to) const {
+    ASSERT(to != kInvalidPartition && to < _gain_cache._k);
+    const HyperedgeWeight* benefit_delta =
+      _gain_cache_delta.get_if_contained(_gain_cache.benefit_key(u, to));
+    return _gain_cache.benefitTerm(u, to) + ( benefit_delta ? *benefit_delta : 0 );
+  }
+
+  // ! Returns the gain of moving node u from its current block to a target block V_j.
+  // ! More formally, g(u, V_j) := b(u, V_j) - p(u).
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  HyperedgeWeight gain(const HypernodeID u,
+                       const PartitionID from,
+                       const PartitionID to ) const {
+    return benefitTerm(u, to) - penaltyTerm(u, from);
+  }
+
+ // ####################### Delta Gain Update #######################
+
+  template<typename PartitionedHypergraph>
+  MT_KAHYPAR_ATTRIBUTE_ALWAYS_INLINE
+  void deltaGainUpdate(const PartitionedHypergraph& partitioned_hg,
+                       const SynchronizedEdgeUpdate& sync_update) {
+    const HyperedgeID he = sync_update.he;
+    const PartitionID from = sync_update.from;
+    const PartitionID to = sync_update.to;
+    const HyperedgeWeight edge_weight = sync_update.edge_weight;
+    const HypernodeID pin_count_in_from_part_after = sync_update.pin_count_in_from_part_after;
+    const HypernodeID pin_count_in_to_part_after = sync_update.pin_count_in_to_part_after;
+    if (pin_count_in_from_part_after == 1) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        if (partitioned_hg.partID(u) == from) {
+          _gain_cache_delta[_gain_cache.penalty_key(u)] -= edge_weight;
+        }
+      }
+    } else if (pin_count_in_from_part_after == 0) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        _gain_cache_delta[_gain_cache.benefit_key(u, from)] -= edge_weight;
+      }
+    }
+
+    if (pin_count_in_to_part_after == 1) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        _gain_cache_delta[_gain_cache.benefit_key(u, to)] += edge_weight;
+      }
+    } else if (pin_count_in_to_part_after == 2) {
+      for (HypernodeID u : partitioned_hg.pins(he)) {
+        if (partitioned_hg.partID(u) == to) {
+          _gain_cache_delta[_gain_cache.penalty_key(u)] += edge_weight;
+        }
+      }
+    }
+  }
+
+ // ####################### Miscellaneous #######################
+
+  void memoryConsumption(utils::MemoryTreeNode* parent) const {
+    ASSERT(parent);
+    utils::MemoryTreeNode* gain_cache_delta_node = parent->addChild("Delta Gain Cache");
+    gain_cache_delta_node->updateSize(size_in_bytes());
+  }
+
+ private:
+  const SparseKm1GainCache& _gain_cache;
+
+  // ! Stores the delta of each locally touched gain cache entry
+  // ! relative to the gain cache in '_phg'
+  ds::DynamicFlatMap<size_t, HyperedgeWeight> _gain_cache_delta;
+};
+
+}  // namespace mt_kahypar
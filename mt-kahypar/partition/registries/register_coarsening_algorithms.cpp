@@ -76,8 +76,8 @@ using NLevelCoarsenerDispatcher = kahypar::meta::StaticMultiDispatchFactory<NLev
 
 REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::multilevel_coarsener,
                               MultilevelCoarsenerDispatcher,
-                              kahypar::meta::PolicyRegistry<mt_kahypar_partition_type_t>::getInstance().getPolicy(
-                                context.partition.partition_type),
+                              kahypar::meta::PolicyRegistry<TypeTraitsID>::getInstance().getPolicy(
+                                typeTraitsID(context.partition.partition_type)),
                               kahypar::meta::PolicyRegistry<RatingFunction>::getInstance().getPolicy(
                                 context.coarsening.rating.rating_function),
                               kahypar::meta::PolicyRegistry<HeavyNodePenaltyPolicy>::getInstance().getPolicy(
@@ -88,8 +88,8 @@ REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::multilevel_coarsener,
 #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
 REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::nlevel_coarsener,
                               NLevelCoarsenerDispatcher,
-                              kahypar::meta::PolicyRegistry<mt_kahypar_partition_type_t>::getInstance().getPolicy(
-                                context.partition.partition_type),
+                              kahypar::meta::PolicyRegistry<TypeTraitsID>::getInstance().getPolicy(
+                                typeTraitsID(context.partition.partition_type)),
                               kahypar::meta::PolicyRegistry<RatingFunction>::getInstance().getPolicy(
                                 context.coarsening.rating.rating_function),
                               kahypar::meta::PolicyRegistry<HeavyNodePenaltyPolicy>::getInstance().getPolicy(
@@ -100,7 +100,7 @@ REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::nlevel_coarsener,
 
 REGISTER_DISPATCHED_COARSENER(CoarseningAlgorithm::deterministic_multilevel_coarsener,
                               DeterministicCoarsenerDispatcher,
-                              kahypar::meta::PolicyRegistry<mt_kahypar_partition_type_t>::getInstance().getPolicy(
-                                context.partition.partition_type));
+                              kahypar::meta::PolicyRegistry<TypeTraitsID>::getInstance().getPolicy(
+                                typeTraitsID(context.partition.partition_type)));
 
 }  // namespace mt_kahypar
@@ -163,7 +163,8 @@ namespace mt_kahypar {
             pool.register_memory_chunk("Refinement", "num_incident_edges_of_block",
                                       static_cast<size_t>(num_hypernodes) * context.partition.k,
                                       sizeof(CAtomic<HyperedgeID>));
-          } else {
+          } else if ( context.partition.preset_type != PresetType::large_k ) {
+            // The large k preset uses a sparse gain cache that allocates its own memory
             pool.register_memory_chunk("Refinement", "gain_cache",
                                       static_cast<size_t>(num_hypernodes) * ( context.partition.k + 1 ),
                                       sizeof(CAtomic<HyperedgeWeight>));
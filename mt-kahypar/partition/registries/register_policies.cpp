@@ -44,21 +44,21 @@ namespace mt_kahypar {
 //                            Hypergraph Type Traits
 // //////////////////////////////////////////////////////////////////////////////
 #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
-REGISTER_POLICY(mt_kahypar_partition_type_t, MULTILEVEL_GRAPH_PARTITIONING,
+REGISTER_POLICY(TypeTraitsID, typeTraitsID(MULTILEVEL_GRAPH_PARTITIONING),
                 StaticGraphTypeTraits);
 #endif
-REGISTER_POLICY(mt_kahypar_partition_type_t, MULTILEVEL_HYPERGRAPH_PARTITIONING,
+REGISTER_POLICY(TypeTraitsID, typeTraitsID(MULTILEVEL_HYPERGRAPH_PARTITIONING),
                 StaticHypergraphTypeTraits);
 #ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
-REGISTER_POLICY(mt_kahypar_partition_type_t, LARGE_K_PARTITIONING,
+REGISTER_POLICY(TypeTraitsID, typeTraitsID(LARGE_K_PARTITIONING),
                 LargeKHypergraphTypeTraits);
 #endif
 #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
 #ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
-REGISTER_POLICY(mt_kahypar_partition_type_t, N_LEVEL_GRAPH_PARTITIONING,
+REGISTER_POLICY(TypeTraitsID, typeTraitsID(N_LEVEL_GRAPH_PARTITIONING),
                 DynamicGraphTypeTraits);
 #endif
-REGISTER_POLICY(mt_kahypar_partition_type_t, N_LEVEL_HYPERGRAPH_PARTITIONING,
+REGISTER_POLICY(TypeTraitsID, typeTraitsID(N_LEVEL_HYPERGRAPH_PARTITIONING),
                 DynamicHypergraphTypeTraits);
 #endif
 
@@ -93,6 +93,9 @@ REGISTER_POLICY(AcceptancePolicy, AcceptancePolicy::best,
 // //////////////////////////////////////////////////////////////////////////////
 REGISTER_POLICY(GainPolicy, GainPolicy::km1, Km1GainTypes);
 REGISTER_POLICY(GainPolicy, GainPolicy::cut, CutGainTypes);
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+REGISTER_POLICY(GainPolicy, GainPolicy::sparse_km1, SparseKm1GainTypes);
+#endif
 #ifdef KAHYPAR_ENABLE_SOED_METRIC
 REGISTER_POLICY(GainPolicy, GainPolicy::soed, SoedGainTypes);
 #endif
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+namespace utils {
+
+/*!
+ * Minimal streaming writer for JSON documents. Separators between
+ * members and array elements are inserted automatically.
+ */
+class JSONWriter {
+
+ public:
+  explicit JSONWriter(std::ostream& out) :
+    _out(out),
+    _is_first(),
+    _expects_value(false) { }
+
+  JSONWriter(const JSONWriter&) = delete;
+  JSONWriter & operator= (const JSONWriter &) = delete;
+
+  void beginObject() {
+    separator();
+    _out << "{";
+    _is_first.push_back(true);
+  }
+
+  void endObject() {
+    ASSERT(!_is_first.empty());
+    _is_first.pop_back();
+    _out << "}";
+  }
+
+  void beginArray() {
+    separator();
+    _out << "[";
+    _is_first.push_back(true);
+  }
+
+  void endArray() {
+    ASSERT(!_is_first.empty());
+    _is_first.pop_back();
+    _out << "]";
+  }
+
+  // ! Writes the key of the next object member
+  JSONWriter& key(const std::string& key) {
+    ASSERT(!_expects_value);
+    separator();
+    writeString(key);
+    _out << ":";
+    _expects_value = true;
+    return *this;
+  }
+
+  void value(const std::string& value) {
+    separator();
+    writeString(value);
+  }
+
+  void value(const char* value) {
+    separator();
+    writeString(value);
+  }
+
+  void value(const bool value) {
+    separator();
+    _out << (value ? "true" : "false");
+  }
+
+  template<typename T>
+  std::enable_if_t<std::is_integral_v<T>> value(const T value) {
+    separator();
+    if constexpr ( sizeof(T) == 1 ) {
+      // Otherwise, the value is written as character
+      _out << static_cast<int>(value);
+    } else {
+      _out << value;
+    }
+  }
+
+  template<typename T>
+  std::enable_if_t<std::is_floating_point_v<T>> value(const T value) {
+    separator();
+    if ( std::isfinite(value) ) {
+      _out << value;
+    } else {
+      // JSON has no representation for NaN or infinity
+      _out << "null";
+    }
+  }
+
+  // ! Writes values that only provide a stream operator (e.g., enum classes) as string
+  template<typename T>
+  std::enable_if_t<!std::is_arithmetic_v<T>> value(const T& value) {
+    std::stringstream ss;
+    ss << value;
+    this->value(ss.str());
+  }
+
+  template<typename T>
+  void field(const std::string& key, const T& value) {
+    this->key(key);
+    this->value(value);
+  }
+
+ private:
+  void separator() {
+    if ( _expects_value ) {
+      // Value of an object member => no separator required
+      _expects_value = false;
+    } else if ( !_is_first.empty() ) {
+      if ( !_is_first.back() ) {
+        _out << ",";
+      }
+      _is_first.back() = false;
+    }
+  }
+
+  void writeString(const std::string& str) {
+    _out << "\"";
+    for ( const char c : str ) {
+      switch ( c ) {
+        case '"': _out << "\\\""; break;
+        case '\\': _out << "\\\\"; break;
+        case '\n': _out << "\\n"; break;
+        case '\r': _out << "\\r"; break;
+        case '\t': _out << "\\t"; break;
+        default:
+          if ( static_cast<unsigned char>(c) < 0x20 ) {
+            char buffer[7];
+            std::snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<unsigned char>(c));
+            _out << buffer;
+          } else {
+            _out << c;
+          }
+      }
+    }
+    _out << "\"";
+  }
+
+  std::ostream& _out;
+  // ! One entry for each open object or array. Stores whether
+  // ! the next element is the first one in the object or array
+  std::vector<bool> _is_first;
+  // ! True, if a key was written and its value is pending
+  bool _expects_value;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
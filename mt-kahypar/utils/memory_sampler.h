@@ -0,0 +1,230 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/parallel/stl/tracked_scalable_allocator.h"
+
+namespace mt_kahypar {
+namespace utils {
+
+struct PeakMemory {
+  // ! Peak resident set size of the process (in bytes)
+  size_t rss = 0;
+  // ! Peak number of bytes allocated via tracked allocators (see parallel::AllocationTracker)
+  size_t tracked = 0;
+
+  void max(const PeakMemory& other) {
+    rss = std::max(rss, other.rss);
+    tracked = std::max(tracked, other.tracked);
+  }
+};
+
+/*!
+ * Measures the high-water mark of the memory consumption within scopes
+ * (e.g., a phase of the multilevel algorithm). A background thread samples the
+ * resident set size of the process in regular intervals and folds the peak of
+ * the tracked allocations into all active scopes. Peaks that occur between two
+ * samples are only captured for tracked allocations.
+ */
+class MemorySampler {
+
+ public:
+  static constexpr size_t kInvalidScope = std::numeric_limits<size_t>::max();
+  static constexpr std::chrono::milliseconds SAMPLING_INTERVAL { 10 };
+
+  MemorySampler(const MemorySampler&) = delete;
+  MemorySampler & operator= (const MemorySampler &) = delete;
+
+  MemorySampler(MemorySampler&&) = delete;
+  MemorySampler & operator= (MemorySampler &&) = delete;
+
+  ~MemorySampler() {
+    disable();
+  }
+
+  static MemorySampler& instance() {
+    static MemorySampler instance;
+    return instance;
+  }
+
+  // ! Starts the background sampling thread and the tracking of allocations
+  void enable() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if ( !_is_enabled ) {
+      parallel::AllocationTracker::enable();
+      _stop = false;
+      _is_enabled = true;
+      _sampler = std::thread([&] { run(); });
+    }
+  }
+
+  // ! Stops the background sampling thread and the tracking of allocations
+  void disable() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if ( !_is_enabled ) {
+        return;
+      }
+      parallel::AllocationTracker::disable();
+      _stop = true;
+      _is_enabled = false;
+    }
+    _stop_cv.notify_all();
+    _sampler.join();
+  }
+
+  bool isEnabled() const {
+    return _is_enabled;
+  }
+
+  // ! Opens a new scope and returns its id
+  size_t beginScope() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    sample();
+    size_t id = kInvalidScope;
+    if ( !_free_scopes.empty() ) {
+      id = _free_scopes.back();
+      _free_scopes.pop_back();
+    } else {
+      id = _scopes.size();
+      _scopes.emplace_back();
+      _is_active.push_back(false);
+    }
+    _scopes[id] = PeakMemory { currentRSS(), parallel::AllocationTracker::current() };
+    _is_active[id] = true;
+    return id;
+  }
+
+  // ! Closes the scope and returns its peak memory consumption
+  PeakMemory endScope(const size_t id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ASSERT(id < _scopes.size() && _is_active[id]);
+    sample();
+    _is_active[id] = false;
+    _free_scopes.push_back(id);
+    return _scopes[id];
+  }
+
+  // ! Peak memory consumption of the process since the sampler was enabled
+  PeakMemory processPeak() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    sample();
+    PeakMemory peak = _process_peak;
+    peak.rss = std::max(peak.rss, peakRSS());
+    return peak;
+  }
+
+  // ! Current resident set size of the process in bytes (0, if not supported)
+  static size_t currentRSS() {
+    size_t rss = 0;
+    #if defined(__linux__)
+    if ( FILE* file = std::fopen("/proc/self/statm", "r") ) {
+      unsigned long size = 0;
+      unsigned long resident = 0;
+      if ( std::fscanf(file, "%lu %lu", &size, &resident) == 2 ) {
+        rss = static_cast<size_t>(resident) * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+      }
+      std::fclose(file);
+    }
+    #endif
+    return rss;
+  }
+
+  // ! Peak resident set size of the process in bytes as reported by the OS (0, if not supported)
+  static size_t peakRSS() {
+    size_t rss = 0;
+    #if defined(__linux__)
+    struct rusage usage;
+    if ( getrusage(RUSAGE_SELF, &usage) == 0 ) {
+      // ru_maxrss is in kilobytes on Linux
+      rss = static_cast<size_t>(usage.ru_maxrss) * 1024;
+    }
+    #endif
+    return rss;
+  }
+
+ private:
+  MemorySampler() :
+    _mutex(),
+    _stop_cv(),
+    _sampler(),
+    _is_enabled(false),
+    _stop(false),
+    _scopes(),
+    _is_active(),
+    _free_scopes(),
+    _process_peak() { }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while ( !_stop ) {
+      sample();
+      _stop_cv.wait_for(lock, SAMPLING_INTERVAL, [&] { return _stop; });
+    }
+  }
+
+  // ! Folds the current RSS and the peak of the tracked allocations since
+  // ! the last sample into all active scopes (requires _mutex)
+  void sample() {
+    const PeakMemory current { currentRSS(), parallel::AllocationTracker::resetPeak() };
+    _process_peak.max(current);
+    for ( size_t id = 0; id < _scopes.size(); ++id ) {
+      if ( _is_active[id] ) {
+        _scopes[id].max(current);
+      }
+    }
+  }
+
+  std::mutex _mutex;
+  std::condition_variable _stop_cv;
+  std::thread _sampler;
+  std::atomic<bool> _is_enabled;
+  bool _stop;
+  std::vector<PeakMemory> _scopes;
+  std::vector<bool> _is_active;
+  std::vector<size_t> _free_scopes;
+  PeakMemory _process_peak;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
@@ -144,6 +144,20 @@ namespace mt_kahypar::utils {
     }
   }
 
+  void MemoryTreeNode::serializeJSON(JSONWriter& json) const {
+    json.beginObject();
+    json.field("name", _name);
+    json.field("size_in_bytes", _size_in_bytes);
+    json.key("children").beginArray();
+    for (const auto& child : _children) {
+      if ( child.second->_size_in_bytes > 0 ) {
+        child.second->serializeJSON(json);
+      }
+    }
+    json.endArray();
+    json.endObject();
+  }
+
   std::ostream & operator<< (std::ostream& str, const MemoryTreeNode& root) {
     root.dfs(str, UL(0), 0);
     return str;
@@ -30,6 +30,8 @@
 #include <string>
 #include <memory>
 
+#include "mt-kahypar/utils/json_writer.h"
+
 namespace mt_kahypar::utils {
 
 enum class OutputType : uint8_t {
@@ -54,6 +56,14 @@ class MemoryTreeNode {
 
   void finalize();
 
+  // ! Size of this node and all its children (only valid after finalize())
+  size_t sizeInBytes() const {
+    return _size_in_bytes;
+  }
+
+  // ! Writes the memory tree as JSON object (sizes in bytes, omits empty nodes)
+  void serializeJSON(JSONWriter& json) const;
+
  private:
 
   void dfs(std::ostream& str, const size_t parent_size_in_bytes, int level) const ;
@@ -0,0 +1,269 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/perf_event.h>)
+#define MT_KAHYPAR_HAS_PERF_EVENTS
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#endif
+
+#include "mt-kahypar/macros.h"
+
+namespace mt_kahypar {
+namespace utils {
+
+enum class PerfCounterType : uint8_t {
+  cycles = 0,
+  instructions = 1,
+  llc_misses = 2,
+  dtlb_misses = 3
+};
+
+static constexpr size_t NUM_PERF_COUNTERS = 4;
+
+// ! Counter values of the whole process (summed over all threads)
+struct PerfCounterValues {
+  PerfCounterValues() :
+    values() {
+    values.fill(0);
+  }
+
+  uint64_t get(const PerfCounterType type) const {
+    return values[static_cast<size_t>(type)];
+  }
+
+  PerfCounterValues& operator+= (const PerfCounterValues& other) {
+    for ( size_t i = 0; i < NUM_PERF_COUNTERS; ++i ) {
+      values[i] += other.values[i];
+    }
+    return *this;
+  }
+
+  // ! Counters might not be monotone if they are scaled due to multiplexing
+  PerfCounterValues operator- (const PerfCounterValues& other) const {
+    PerfCounterValues result;
+    for ( size_t i = 0; i < NUM_PERF_COUNTERS; ++i ) {
+      result.values[i] = values[i] > other.values[i] ? values[i] - other.values[i] : 0;
+    }
+    return result;
+  }
+
+  double instructionsPerCycle() const {
+    const uint64_t cycles = get(PerfCounterType::cycles);
+    return cycles > 0 ? static_cast<double>(get(PerfCounterType::instructions)) / cycles : 0.0;
+  }
+
+  // ! Misses per thousand instructions
+  double missesPerKiloInstruction(const PerfCounterType type) const {
+    const uint64_t instructions = get(PerfCounterType::instructions);
+    return instructions > 0 ? 1000.0 * get(type) / instructions : 0.0;
+  }
+
+  std::array<uint64_t, NUM_PERF_COUNTERS> values;
+};
+
+/*!
+ * Samples hardware performance counters (cycles, instructions, LLC misses and
+ * dTLB misses) of the whole process via Linux perf events. When enabled, one
+ * counter per event is opened for each existing thread of the process. Threads
+ * created afterwards (e.g., TBB worker threads) inherit the counters of their
+ * parent thread. Reading a counter returns the sum over all inheriting threads.
+ * If perf events are not supported by the platform or not permitted (see
+ * /proc/sys/kernel/perf_event_paranoid), all operations are no-ops and
+ * all values are zero.
+ */
+class PerfCounters {
+
+  static constexpr bool debug = false;
+
+ public:
+  PerfCounters(const PerfCounters&) = delete;
+  PerfCounters & operator= (const PerfCounters &) = delete;
+
+  PerfCounters(PerfCounters&&) = delete;
+  PerfCounters & operator= (PerfCounters &&) = delete;
+
+  ~PerfCounters() {
+    closeCounters();
+  }
+
+  static PerfCounters& instance() {
+    static PerfCounters instance;
+    return instance;
+  }
+
+  // ! Returns true, if at least one counter could be opened
+  bool enable() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if ( !_is_enabled ) {
+      openCounters();
+      _is_enabled = !_fds.empty();
+    }
+    return _is_enabled;
+  }
+
+  void disable() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    closeCounters();
+    _is_enabled = false;
+  }
+
+  bool isEnabled() const {
+    return _is_enabled;
+  }
+
+  bool isAvailable(const PerfCounterType type) const {
+    return _is_available[static_cast<size_t>(type)];
+  }
+
+  PerfCounterValues read() {
+    PerfCounterValues result;
+    #ifdef MT_KAHYPAR_HAS_PERF_EVENTS
+    if ( _is_enabled ) {
+      std::lock_guard<std::mutex> lock(_mutex);
+      for ( const Counter& counter : _fds ) {
+        // value, time enabled, time running
+        uint64_t data[3] = { 0, 0, 0 };
+        if ( ::read(counter.fd, data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) ) {
+          uint64_t value = data[0];
+          if ( data[2] > 0 && data[2] < data[1] ) {
+            // Counter was multiplexed => extrapolate value
+            value = static_cast<uint64_t>(static_cast<double>(value) * data[1] / data[2]);
+          }
+          result.values[static_cast<size_t>(counter.type)] += value;
+        }
+      }
+    }
+    #endif
+    return result;
+  }
+
+ private:
+  struct Counter {
+    PerfCounterType type;
+    int fd;
+  };
+
+  PerfCounters() :
+    _mutex(),
+    _fds(),
+    _is_available(),
+    _is_enabled(false) {
+    _is_available.fill(false);
+  }
+
+  void openCounters() {
+    #ifdef MT_KAHYPAR_HAS_PERF_EVENTS
+    std::vector<pid_t> threads;
+    if ( DIR* dir = opendir("/proc/self/task") ) {
+      while ( dirent* entry = readdir(dir) ) {
+        if ( entry->d_name[0] != '.' ) {
+          threads.push_back(static_cast<pid_t>(std::stoi(entry->d_name)));
+        }
+      }
+      closedir(dir);
+    }
+
+    for ( size_t i = 0; i < NUM_PERF_COUNTERS; ++i ) {
+      const PerfCounterType type = static_cast<PerfCounterType>(i);
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      setEvent(type, attr);
+      attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+      attr.inherit = 1;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      for ( const pid_t tid : threads ) {
+        const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1, 0));
+        if ( fd >= 0 ) {
+          _fds.push_back(Counter { type, fd });
+          _is_available[i] = true;
+        } else {
+          DBG << "Failed to open perf counter" << i << "for thread" << tid << ":" << strerror(errno);
+        }
+      }
+    }
+    #endif
+  }
+
+  void closeCounters() {
+    #ifdef MT_KAHYPAR_HAS_PERF_EVENTS
+    for ( const Counter& counter : _fds ) {
+      close(counter.fd);
+    }
+    #endif
+    _fds.clear();
+    _is_available.fill(false);
+  }
+
+  #ifdef MT_KAHYPAR_HAS_PERF_EVENTS
+  static void setEvent(const PerfCounterType type, perf_event_attr& attr) {
+    switch ( type ) {
+      case PerfCounterType::cycles:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case PerfCounterType::instructions:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case PerfCounterType::llc_misses:
+        // Generic last-level cache miss event (also supported on AMD processors)
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case PerfCounterType::dtlb_misses:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_DTLB |
+          (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    }
+  }
+  #endif
+
+  std::mutex _mutex;
+  std::vector<Counter> _fds;
+  std::array<bool, NUM_PERF_COUNTERS> _is_available;
+  bool _is_enabled;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
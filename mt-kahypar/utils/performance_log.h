@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/json_writer.h"
+
+namespace mt_kahypar {
+namespace utils {
+
+/*!
+ * Records per-level statistics of the multilevel hierarchy and the change of
+ * the objective function in each phase of the partitioning algorithm.
+ * Level 0 always refers to the input hypergraph. Entries are tagged with the
+ * current V-cycle (0 = initial partitioning run).
+ */
+class PerformanceLog {
+
+ public:
+  struct LevelInfo {
+    size_t vcycle;
+    size_t level;
+    uint64_t num_nodes;
+    uint64_t num_edges;
+    uint64_t num_pins;
+    double time;
+    int64_t objective_before;
+    int64_t objective_after;
+  };
+
+  struct PhaseInfo {
+    size_t vcycle;
+    std::string phase;
+    int64_t objective_before;
+    int64_t objective_after;
+  };
+
+  explicit PerformanceLog() :
+    _log_mutex(),
+    _coarsening_levels(),
+    _refinement_levels(),
+    _phases(),
+    _vcycle(0),
+    _enable(true) { }
+
+  PerformanceLog(const PerformanceLog& other) :
+    _log_mutex(),
+    _coarsening_levels(other._coarsening_levels),
+    _refinement_levels(other._refinement_levels),
+    _phases(other._phases),
+    _vcycle(other._vcycle),
+    _enable(other._enable) { }
+
+  PerformanceLog & operator= (const PerformanceLog &) = delete;
+
+  PerformanceLog(PerformanceLog&& other) :
+    _log_mutex(),
+    _coarsening_levels(std::move(other._coarsening_levels)),
+    _refinement_levels(std::move(other._refinement_levels)),
+    _phases(std::move(other._phases)),
+    _vcycle(other._vcycle),
+    _enable(other._enable) { }
+
+  PerformanceLog & operator= (PerformanceLog &&) = delete;
+
+  void enable() {
+    std::lock_guard<std::mutex> lock(_log_mutex);
+    _enable = true;
+  }
+
+  void disable() {
+    std::lock_guard<std::mutex> lock(_log_mutex);
+    _enable = false;
+  }
+
+  bool isEnabled() const {
+    return _enable;
+  }
+
+  void setVCycle(const size_t vcycle) {
+    std::lock_guard<std::mutex> lock(_log_mutex);
+    _vcycle = vcycle;
+  }
+
+  // ! Adds a level of the multilevel hierarchy (time includes coarsening and contraction)
+  void addCoarseningLevel(const size_t level,
+                          const uint64_t num_nodes,
+                          const uint64_t num_edges,
+                          const uint64_t num_pins,
+                          const double time) {
+    std::lock_guard<std::mutex> lock(_log_mutex);
+    if ( _enable ) {
+      _coarsening_levels.push_back(LevelInfo {
+        _vcycle, level, num_nodes, num_edges, num_pins, time, 0, 0 });
+    }
+  }
+
+  // ! Adds a level of the uncoarsening phase (time includes projection and refinement)
+  void addRefinementLevel(const size_t level,
+                          const uint64_t num_nodes,
+                          const uint64_t num_edges,
+                          const uint64_t num_pins,
+                          const double time,
+                          const int64_t objective_before,
+                          const int64_t objective_after) {
+    std::lock_guard<std::mutex> lock(_log_mutex);
+    if ( _enable ) {
+      _refinement_levels.push_back(LevelInfo {
+        _vcycle, level, num_nodes, num_edges, num_pins, time, objective_before, objective_after });
+    }
+  }
+
+  void addPhase(const std::string& phase,
+                const int64_t objective_before,
+                const int64_t objective_after) {
+    std::lock_guard<std::mutex> lock(_log_mutex);
+    if ( _enable ) {
+      _phases.push_back(PhaseInfo { _vcycle, phase, objective_before, objective_after });
+    }
+  }
+
+  const std::vector<LevelInfo>& coarseningLevels() const {
+    return _coarsening_levels;
+  }
+
+  const std::vector<LevelInfo>& refinementLevels() const {
+    return _refinement_levels;
+  }
+
+  const std::vector<PhaseInfo>& phases() const {
+    return _phases;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(_log_mutex);
+    _coarsening_levels.clear();
+    _refinement_levels.clear();
+    _phases.clear();
+    _vcycle = 0;
+  }
+
+  // ! Writes the members coarsening_levels, refinement_levels and phases
+  // ! into the currently open JSON object
+  void serializeJSON(JSONWriter& json) const {
+    auto serialize_level = [&](const LevelInfo& level, const bool with_objective) {
+      json.beginObject();
+      json.field("vcycle", level.vcycle);
+      json.field("level", level.level);
+      json.field("num_nodes", level.num_nodes);
+      json.field("num_edges", level.num_edges);
+      json.field("num_pins", level.num_pins);
+      json.field("time", level.time);
+      if ( with_objective ) {
+        json.field("objective_before", level.objective_before);
+        json.field("objective_after", level.objective_after);
+        json.field("objective_delta", level.objective_after - level.objective_before);
+      }
+      json.endObject();
+    };
+
+    json.key("coarsening_levels").beginArray();
+    for ( const LevelInfo& level : _coarsening_levels ) {
+      serialize_level(level, false);
+    }
+    json.endArray();
+
+    json.key("refinement_levels").beginArray();
+    for ( const LevelInfo& level : _refinement_levels ) {
+      serialize_level(level, true);
+    }
+    json.endArray();
+
+    json.key("phases").beginArray();
+    for ( const PhaseInfo& phase : _phases ) {
+      json.beginObject();
+      json.field("vcycle", phase.vcycle);
+      json.field("phase", phase.phase);
+      json.field("objective_before", phase.objective_before);
+      json.field("objective_after", phase.objective_after);
+      json.field("objective_delta", phase.objective_after - phase.objective_before);
+      json.endObject();
+    }
+    json.endArray();
+  }
+
+ private:
+  std::mutex _log_mutex;
+  std::vector<LevelInfo> _coarsening_levels;
+  std::vector<LevelInfo> _refinement_levels;
+  std::vector<PhaseInfo> _phases;
+  size_t _vcycle;
+  bool _enable;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
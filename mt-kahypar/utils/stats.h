@@ -32,6 +32,7 @@
 #include <algorithm>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/json_writer.h"
 
 namespace mt_kahypar {
 namespace utils {
@@ -112,6 +113,17 @@ class Stats {
       _value_5 += delta;
     }
 
+    void serializeJSON(JSONWriter& json) const {
+      switch (_type) {
+        case Type::BOOLEAN: json.value(_value_1); break;
+        case Type::INT32: json.value(_value_2); break;
+        case Type::INT64: json.value(_value_3); break;
+        case Type::FLOAT: json.value(_value_4); break;
+        case Type::DOUBLE: json.value(_value_5); break;
+        default: json.value(std::string()); break;  // UNKNOWN TYPE
+      }
+    }
+
     friend std::ostream & operator<< (std::ostream& str, const Stat& stat);
 
    private:
@@ -184,6 +196,22 @@ class Stats {
     _stats.clear();
   }
 
+  // ! Writes all stats as JSON object (sorted by key)
+  void serializeJSON(JSONWriter& json) const {
+    std::vector<std::string> keys;
+    for (const auto& stat : _stats) {
+      keys.emplace_back(stat.first);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    json.beginObject();
+    for (const std::string& key : keys) {
+      json.key(key);
+      _stats.at(key).serializeJSON(json);
+    }
+    json.endObject();
+  }
+
   friend std::ostream & operator<< (std::ostream& str, const Stats& stats);
 
  private:
@@ -29,6 +29,7 @@
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <iomanip>
 #include <mutex>
 #include <string>
 #include <unordered_map>
@@ -36,6 +37,10 @@
 #include <tbb/enumerable_thread_specific.h>
 
 #include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/json_writer.h"
+#include "mt-kahypar/utils/memory_sampler.h"
+#include "mt-kahypar/utils/perf_counters.h"
+#include "mt-kahypar/utils/tracer.h"
 
 namespace mt_kahypar {
 namespace utils {
@@ -74,14 +79,20 @@ class Timer {
     ActiveTiming() :
       _key(""),
       _description(""),
-      _start() { }
+      _start(),
+      _counters(),
+      _memory_scope(MemorySampler::kInvalidScope) { }
 
     ActiveTiming(const std::string& key,
                  const std::string& description,
-                 const HighResClockTimepoint& start) :
+                 const HighResClockTimepoint& start,
+                 const PerfCounterValues& counters = PerfCounterValues(),
+                 const size_t memory_scope = MemorySampler::kInvalidScope) :
       _key(key),
       _description(description),
-      _start(start) { }
+      _start(start),
+      _counters(counters),
+      _memory_scope(memory_scope) { }
 
     std::string key() const {
       return _key;
@@ -95,10 +106,22 @@ class Timer {
       return _start;
     }
 
+    const PerfCounterValues& counters() const {
+      return _counters;
+    }
+
+    size_t memory_scope() const {
+      return _memory_scope;
+    }
+
    private:
     std::string _key;
     std::string _description;
     HighResClockTimepoint _start;
+    // ! Performance counters at the start of the timing
+    PerfCounterValues _counters;
+    // ! Scope of the memory sampler that measures the peak memory of the timing
+    size_t _memory_scope;
   };
 
   class Timing {
@@ -111,7 +134,11 @@ class Timer {
       _description(description),
       _parent(parent),
       _order(order),
-      _timing(0.0) { }
+      _timing(0.0),
+      _has_counters(false),
+      _counters(),
+      _has_peak_memory(false),
+      _peak_memory() { }
 
     std::string key() const {
       return _key;
@@ -141,12 +168,44 @@ class Timer {
       _timing += timing;
     }
 
+    bool has_counters() const {
+      return _has_counters;
+    }
+
+    const PerfCounterValues& counters() const {
+      return _counters;
+    }
+
+    void add_counters(const PerfCounterValues& counters) {
+      _has_counters = true;
+      _counters += counters;
+    }
+
+    bool has_peak_memory() const {
+      return _has_peak_memory;
+    }
+
+    const PeakMemory& peak_memory() const {
+      return _peak_memory;
+    }
+
+    void add_peak_memory(const PeakMemory& peak_memory) {
+      _has_peak_memory = true;
+      _peak_memory.max(peak_memory);
+    }
+
    private:
     std::string _key;
     std::string _description;
     std::string _parent;
     int _order;
     double _timing;
+    bool _has_counters;
+    // ! Performance counters aggregated over all threads
+    PerfCounterValues _counters;
+    bool _has_peak_memory;
+    // ! Maximum peak memory over all occurrences of the timing
+    PeakMemory _peak_memory;
   };
 
   using ActiveTimingStack = std::vector<ActiveTiming>;
@@ -212,6 +271,11 @@ class Timer {
   void clear() {
     std::lock_guard<std::mutex> lock(_timing_mutex);
     _timings.clear();
+    for (const ActiveTiming& timing : _active_timings) {
+      if (timing.memory_scope() != MemorySampler::kInvalidScope) {
+        MemorySampler::instance().endScope(timing.memory_scope());
+      }
+    }
     _active_timings.clear();
     _index = 0;
   }
@@ -220,19 +284,34 @@ class Timer {
                    const std::string& description,
                    bool is_parallel_context = false,
                    bool force = false) {
+    // Spans are also traced if the timer is disabled (e.g., in initial partitioning)
+    Tracer::instance().begin(description, "timer");
     if (_is_enabled || force) {
-      std::lock_guard<std::mutex> lock(_timing_mutex);
       if (force || is_parallel_context) {
+        std::lock_guard<std::mutex> lock(_timing_mutex);
         _local_active_timings.local().emplace_back(key, description, std::chrono::high_resolution_clock::now());
       } else {
-        _active_timings.emplace_back(key, description, std::chrono::high_resolution_clock::now());
+        // Performance counters and memory are process-wide. Thus, we only sample
+        // them for timings in a sequential context (they would overlap otherwise).
+        const PerfCounterValues counters = PerfCounters::instance().read();
+        const size_t memory_scope = MemorySampler::instance().isEnabled() ?
+          MemorySampler::instance().beginScope() : MemorySampler::kInvalidScope;
+        std::lock_guard<std::mutex> lock(_timing_mutex);
+        _active_timings.emplace_back(key, description,
+          std::chrono::high_resolution_clock::now(), counters, memory_scope);
       }
     }
   }
 
   void stop_timer(const std::string& key, bool force = false) {
     unused(key);
+    Tracer::instance().end("timer");
     if (_is_enabled || force) {
+      // Timings on the thread local stack are in a parallel context (see start_timer)
+      const bool sample_counters = PerfCounters::instance().isEnabled() &&
+        _local_active_timings.local().empty();
+      const PerfCounterValues end_counters = sample_counters ?
+        PerfCounters::instance().read() : PerfCounterValues();
       std::lock_guard<std::mutex> lock(_timing_mutex);
       HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
       ASSERT(!force || !_local_active_timings.local().empty());
@@ -273,6 +352,13 @@ class Timer {
       }
       double time = std::chrono::duration<double>(end - current_timing.start()).count();
       _timings.at(timing_key).add_timing(time);
+      if ( sample_counters ) {
+        _timings.at(timing_key).add_counters(end_counters - current_timing.counters());
+      }
+      if ( current_timing.memory_scope() != MemorySampler::kInvalidScope ) {
+        _timings.at(timing_key).add_peak_memory(
+          MemorySampler::instance().endScope(current_timing.memory_scope()));
+      }
     }
   }
 
@@ -313,8 +399,69 @@ class Timer {
     }
   }
 
+  // ! Writes all timings as JSON array of timing trees (ignores the maximum output depth)
+  void serializeJSON(JSONWriter& json) const {
+    std::vector<Timing> timings;
+    for (const auto& timing : _timings) {
+      timings.emplace_back(timing.second);
+    }
+    std::sort(timings.begin(), timings.end(),
+              [&](const Timing& lhs, const Timing& rhs) {
+          return lhs.order() < rhs.order();
+        });
+
+    std::function<void(const Timing&)> dfs = [&](const Timing& current) {
+      json.beginObject();
+      json.field("key", current.key());
+      json.field("description", current.description());
+      json.field("time", current.timing());
+      if (current.has_counters()) {
+        const PerfCounterValues& counters = current.counters();
+        json.key("perf_counters").beginObject();
+        json.field("cycles", counters.get(PerfCounterType::cycles));
+        json.field("instructions", counters.get(PerfCounterType::instructions));
+        json.field("llc_misses", counters.get(PerfCounterType::llc_misses));
+        json.field("dtlb_misses", counters.get(PerfCounterType::dtlb_misses));
+        json.endObject();
+      }
+      if (current.has_peak_memory()) {
+        json.key("peak_memory").beginObject();
+        json.field("rss_bytes", current.peak_memory().rss);
+        json.field("tracked_bytes", current.peak_memory().tracked);
+        json.endObject();
+      }
+      json.key("children").beginArray();
+      for (const Timing& timing : timings) {
+        if (timing.parent() == current.key()) {
+          dfs(timing);
+        }
+      }
+      json.endArray();
+      json.endObject();
+    };
+
+    json.beginArray();
+    for (const Timing& timing : timings) {
+      if (timing.is_root()) {
+        dfs(timing);
+      }
+    }
+    json.endArray();
+  }
+
   friend std::ostream & operator<< (std::ostream& str, const Timer& timer);
 
+  // ! Sum of all top-level timings
+  double totalTime() const {
+    double total_time = 0.0;
+    for (const auto& x : _timings) {
+      if (x.second.is_root()) {
+        total_time += x.second.timing();
+      }
+    }
+    return total_time;
+  }
+
   double get(std::string key) const {
     for (const auto& x : _timings) {
       // unfortunately it has to be linear search because the parent (which we can't lookup at this stage) is part of the map key
@@ -325,6 +472,18 @@ class Timer {
     return 0.0;
   }
 
+  // ! Maximum peak memory over all timings with the given key (false, if it was not measured)
+  bool peakMemory(const std::string& key, PeakMemory& peak_memory) const {
+    bool found = false;
+    for (const auto& x : _timings) {
+      if (x.first.key == key && x.second.has_peak_memory()) {
+        peak_memory.max(x.second.peak_memory());
+        found = true;
+      }
+    }
+    return found;
+  }
+
  private:
   std::mutex _timing_mutex;
   std::unordered_map<Key, Timing, KeyHasher, KeyEqual> _timings;
@@ -367,7 +526,29 @@ inline std::ostream & operator<< (std::ostream& str, const Timer& timer) {
                  if (length < Timer::MAX_LINE_LENGTH) {
                    str << std::string(Timer::MAX_LINE_LENGTH - length, ' ');
                  }
-                 str << " = " << timing.timing() << " s\n";
+                 str << " = " << timing.timing() << " s";
+                 if (timing.has_counters()) {
+                   const PerfCounterValues& counters = timing.counters();
+                   const std::ios_base::fmtflags flags = str.flags();
+                   const std::streamsize precision = str.precision();
+                   str << std::fixed << std::setprecision(2)
+                       << "  [IPC = " << counters.instructionsPerCycle()
+                       << ", LLC MPKI = " << counters.missesPerKiloInstruction(PerfCounterType::llc_misses)
+                       << ", dTLB MPKI = " << counters.missesPerKiloInstruction(PerfCounterType::dtlb_misses)
+                       << "]";
+                   str.flags(flags);
+                   str.precision(precision);
+                 }
+                 if (timing.has_peak_memory()) {
+                   const std::ios_base::fmtflags flags = str.flags();
+                   const std::streamsize precision = str.precision();
+                   str << std::fixed << std::setprecision(2)
+                       << "  [Peak RSS = " << timing.peak_memory().rss / (1024.0 * 1024.0) << " MB"
+                       << ", Peak Tracked = " << timing.peak_memory().tracked / (1024.0 * 1024.0) << " MB]";
+                   str.flags(flags);
+                   str.precision(precision);
+                 }
+                 str << "\n";
                };
 
   std::function<void(std::ostream&, const Timer::Timing&, int)> dfs =
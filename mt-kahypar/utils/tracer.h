@@ -0,0 +1,224 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/json_writer.h"
+
+namespace mt_kahypar {
+namespace utils {
+
+/*!
+ * Records begin and end events of spans (e.g., timings or FM and flow searches)
+ * for each thread and writes them as a Chrome trace-event file, which can be
+ * inspected with Perfetto (ui.perfetto.dev) or chrome://tracing.
+ * Each thread appends events to its own buffer. Thus, recording an event requires
+ * no synchronization. If tracing is disabled, each call only checks a flag.
+ */
+class Tracer {
+
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  enum class EventType : char {
+    begin_span = 'B',
+    end_span = 'E'
+  };
+
+  struct Event {
+    EventType type;
+    // ! Timestamp in microseconds relative to the construction of the tracer
+    double timestamp;
+    std::string name;
+    // ! Categories are string literals
+    const char* category;
+  };
+
+  struct ThreadBuffer {
+    explicit ThreadBuffer(const size_t id) :
+      thread_id(id),
+      events() { }
+
+    size_t thread_id;
+    std::vector<Event> events;
+  };
+
+ private:
+  explicit Tracer() :
+    _is_enabled(false),
+    _start(Clock::now()),
+    _next_thread_id(0),
+    _buffers([&] { return ThreadBuffer(_next_thread_id++); }) { }
+
+ public:
+  Tracer(const Tracer&) = delete;
+  Tracer & operator= (const Tracer &) = delete;
+
+  Tracer(Tracer&&) = delete;
+  Tracer & operator= (Tracer &&) = delete;
+
+  static Tracer& instance() {
+    static Tracer instance;
+    return instance;
+  }
+
+  bool isEnabled() const {
+    return _is_enabled.load(std::memory_order_relaxed);
+  }
+
+  void enable() {
+    _is_enabled.store(true, std::memory_order_relaxed);
+  }
+
+  void disable() {
+    _is_enabled.store(false, std::memory_order_relaxed);
+  }
+
+  void begin(const std::string& name, const char* category) {
+    if ( isEnabled() ) {
+      _buffers.local().events.push_back(Event { EventType::begin_span, now(), name, category });
+    }
+  }
+
+  void end(const char* category) {
+    if ( isEnabled() ) {
+      _buffers.local().events.push_back(Event { EventType::end_span, now(), "", category });
+    }
+  }
+
+  // ! Must not be called while other threads record events
+  void clear() {
+    for ( ThreadBuffer& buffer : _buffers ) {
+      buffer.events.clear();
+    }
+  }
+
+  size_t numEvents() const {
+    size_t num_events = 0;
+    for ( const ThreadBuffer& buffer : _buffers ) {
+      num_events += buffer.events.size();
+    }
+    return num_events;
+  }
+
+  const tbb::enumerable_thread_specific<ThreadBuffer>& threadBuffers() const {
+    return _buffers;
+  }
+
+  // ! Writes all recorded events in the Chrome trace-event format.
+  // ! Must not be called while other threads record events.
+  void serializeJSON(std::ostream& out) const {
+    JSONWriter json(out);
+    json.beginObject();
+    json.key("traceEvents").beginArray();
+    for ( const ThreadBuffer& buffer : _buffers ) {
+      json.beginObject();
+      json.field("name", "thread_name");
+      json.field("ph", "M");
+      json.field("pid", 1);
+      json.field("tid", buffer.thread_id);
+      json.key("args").beginObject();
+      json.field("name", "Thread " + std::to_string(buffer.thread_id));
+      json.endObject();
+      json.endObject();
+
+      for ( const Event& event : buffer.events ) {
+        json.beginObject();
+        if ( event.type == EventType::begin_span ) {
+          json.field("name", event.name);
+        }
+        json.field("cat", event.category);
+        json.field("ph", std::string(1, static_cast<char>(event.type)));
+        json.field("ts", event.timestamp);
+        json.field("pid", 1);
+        json.field("tid", buffer.thread_id);
+        json.endObject();
+      }
+    }
+    json.endArray();
+    json.field("displayTimeUnit", "ms");
+    json.endObject();
+  }
+
+  void writeTrace(const std::string& filename) const {
+    std::ofstream out(filename);
+    if ( !out ) {
+      throw InvalidInputException("Could not open trace file: " + filename);
+    }
+    serializeJSON(out);
+    out << std::endl;
+  }
+
+ private:
+  double now() const {
+    return std::chrono::duration<double, std::micro>(Clock::now() - _start).count();
+  }
+
+  std::atomic<bool> _is_enabled;
+  const Clock::time_point _start;
+  std::atomic<size_t> _next_thread_id;
+  tbb::enumerable_thread_specific<ThreadBuffer> _buffers;
+};
+
+// ! Records a span for the lifetime of the object
+class ScopedTrace {
+
+ public:
+  ScopedTrace(const char* name, const char* category) :
+    _is_enabled(Tracer::instance().isEnabled()),
+    _category(category) {
+    if ( _is_enabled ) {
+      Tracer::instance().begin(name, _category);
+    }
+  }
+
+  ScopedTrace(const ScopedTrace&) = delete;
+  ScopedTrace & operator= (const ScopedTrace &) = delete;
+
+  ~ScopedTrace() {
+    if ( _is_enabled ) {
+      Tracer::instance().end(_category);
+    }
+  }
+
+ private:
+  // ! Tracing might be enabled or disabled while the span is active
+  const bool _is_enabled;
+  const char* _category;
+};
+
+}  // namespace utils
+}  // namespace mt_kahypar
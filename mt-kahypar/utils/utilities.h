@@ -33,6 +33,7 @@
 #include "mt-kahypar/macros.h"
 #include "mt-kahypar/utils/stats.h"
 #include "mt-kahypar/utils/initial_partitioning_stats.h"
+#include "mt-kahypar/utils/performance_log.h"
 #include "mt-kahypar/utils/timer.h"
 
 namespace mt_kahypar {
@@ -45,11 +46,13 @@ class Utilities {
     UtilityObjects() :
       stats(),
       ip_stats(),
-      timer() { }
+      timer(),
+      performance_log() { }
 
     Stats stats;
     InitialPartitioningStats ip_stats;
     Timer timer;
+    PerformanceLog performance_log;
   };
 
  public:
@@ -86,6 +89,11 @@ class Utilities {
     return _utilities[id].timer;
   }
 
+  PerformanceLog& getPerformanceLog(const size_t id) {
+    ASSERT(id < _utilities.size());
+    return _utilities[id].performance_log;
+  }
+
  private:
   explicit Utilities() :
     _utility_mutex(),
@@ -212,7 +212,8 @@ PYBIND11_MODULE(mtkahypar, m) {
   using mt_kahypar::FileFormat;
   py::enum_<FileFormat>(m, "FileFormat", py::module_local())
     .value("HMETIS", FileFormat::hMetis)
-    .value("METIS", FileFormat::Metis);
+    .value("METIS", FileFormat::Metis)
+    .value("BINARY", FileFormat::Binary);
 
   using mt_kahypar::PresetType;
   py::enum_<PresetType>(m, "PresetType", py::module_local())
@@ -304,6 +305,20 @@ PYBIND11_MODULE(mtkahypar, m) {
       }, [](Context& context, const size_t num_vcycles) {
         context.partition.num_vcycles = num_vcycles;
       }, "Sets the number of V-cycles")
+    .def_property("time_limit",
+      [](const Context& context) {
+        return context.partition.time_limit;
+      }, [](Context& context, const int time_limit) {
+        context.partition.time_limit = time_limit;
+      }, "Sets a time limit in seconds (0 = no time limit). If partitioning exceeds it, "
+         "all remaining refinement steps and V-cycles are skipped")
+    .def_property("max_memory",
+      [](const Context& context) {
+        return context.partition.max_memory;
+      }, [](Context& context, const size_t max_memory) {
+        context.partition.max_memory = max_memory;
+      }, "Sets a memory budget in MB (0 = no memory budget). Partitioning chooses cheaper alternatives "
+         "to meet the budget and fails if the budget cannot be met")
     .def_property("logging",
       [](const Context& context) {
         return context.partition.verbose_output;
@@ -52,6 +52,8 @@ class MainTest(unittest.TestCase):
     context.epsilon = 0.05
     context.objective = mtkahypar.Objective.CUT
     context.num_vcycles = 5
+    context.time_limit = 10
+    context.max_memory = 1024
     context.logging = True
     context.max_block_weights = [100, 200, 300, 400]
 
@@ -59,6 +61,8 @@ class MainTest(unittest.TestCase):
     self.assertEqual(context.epsilon, 0.05)
     self.assertEqual(context.objective, mtkahypar.Objective.CUT)
     self.assertEqual(context.num_vcycles, 5)
+    self.assertEqual(context.time_limit, 10)
+    self.assertEqual(context.max_memory, 1024)
     self.assertEqual(context.logging, True)
     self.assertEqual(context.max_block_weights[0], 100)
     self.assertEqual(context.max_block_weights[1], 200)
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <numeric>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/datastructures/compressed_incidence_array.h"
+#include "mt-kahypar/datastructures/hypergraph_common.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+namespace ds {
+
+class ACompressedIncidenceArray : public Test {
+
+ public:
+  ACompressedIncidenceArray() :
+    offsets({ 0, 3, 3, 7, 8 }),
+    data({ 5, 1, 3, 1000000, 0, 127, 128, 42 }),
+    compressed() {
+    // The lists are too small to save memory => force compression
+    EXPECT_TRUE(compressed.compress(data.data(), data.size(), offsets.size() - 1, [&](const size_t i) {
+      return std::make_pair(offsets[i], offsets[i + 1]);
+    }, true));
+  }
+
+  void verifyList(const size_t i, const std::vector<HypernodeID>& expected) {
+    std::vector<HypernodeID> actual;
+    auto it = compressed.iterator(i, offsets[i + 1] - offsets[i]);
+    for ( ; it != CompressedIncidenceArray<HypernodeID>::end(); ++it ) {
+      actual.push_back(*it);
+    }
+    ASSERT_EQ(expected, actual);
+  }
+
+  std::vector<size_t> offsets;
+  std::vector<HypernodeID> data;
+  CompressedIncidenceArray<HypernodeID> compressed;
+};
+
+TEST_F(ACompressedIncidenceArray, SortsEachListInPlace) {
+  ASSERT_EQ(std::vector<HypernodeID>({ 1, 3, 5, 0, 127, 128, 1000000, 42 }), data);
+}
+
+TEST_F(ACompressedIncidenceArray, IteratesOverCompressedLists) {
+  ASSERT_EQ(UL(4), compressed.numLists());
+  verifyList(0, { 1, 3, 5 });
+  verifyList(1, { });
+  verifyList(2, { 0, 127, 128, 1000000 });
+  verifyList(3, { 42 });
+}
+
+TEST_F(ACompressedIncidenceArray, IteratesOverPrefixOfCompressedList) {
+  std::vector<HypernodeID> actual;
+  for ( auto it = compressed.iterator(2, 2); it != compressed.end(); ++it ) {
+    actual.push_back(*it);
+  }
+  ASSERT_EQ(std::vector<HypernodeID>({ 0, 127 }), actual);
+}
+
+TEST_F(ACompressedIncidenceArray, RequiresLessMemoryThanUncompressedLists) {
+  // Deltas 1,2,2 | - | 0,127,1,999872 | 42 => 1 + 1 + 1 + 1 + 1 + 1 + 3 + 1 bytes
+  ASSERT_EQ(sizeof(size_t) * offsets.size() + 10, compressed.size_in_bytes());
+}
+
+TEST_F(ACompressedIncidenceArray, DecompressesLists) {
+  std::vector<HypernodeID> decompressed(data.size(), 0);
+  compressed.decompress(decompressed.data(), offsets.size() - 1, [&](const size_t i) {
+    return std::make_pair(offsets[i], offsets[i + 1]);
+  });
+  ASSERT_EQ(data, decompressed);
+}
+
+TEST_F(ACompressedIncidenceArray, SkipsCompressionIfItDoesNotSaveMemory) {
+  CompressedIncidenceArray<HypernodeID> other;
+  ASSERT_FALSE(other.compress(data.data(), data.size(), offsets.size() - 1, [&](const size_t i) {
+    return std::make_pair(offsets[i], offsets[i + 1]);
+  }));
+  ASSERT_EQ(UL(0), other.numLists());
+  ASSERT_EQ(UL(0), other.size_in_bytes());
+}
+
+TEST_F(ACompressedIncidenceArray, CompressesLongListsWithSmallDifferences) {
+  // Two lists with 1000 consecutive IDs => one byte per entry instead of four
+  // (except for the first entry of the first list, which requires two bytes)
+  std::vector<HypernodeID> entries(2000);
+  std::iota(entries.begin(), entries.end(), 0);
+  std::reverse(entries.begin(), entries.end());
+  CompressedIncidenceArray<HypernodeID> other;
+  ASSERT_TRUE(other.compress(entries.data(), entries.size(), 2, [&](const size_t i) {
+    return std::make_pair(1000 * i, 1000 * (i + 1));
+  }));
+  ASSERT_EQ(sizeof(size_t) * 3 + 2001, other.size_in_bytes());
+  ASSERT_EQ(1000, *other.iterator(0, 1000));
+  ASSERT_EQ(0, *other.iterator(1, 1000));
+}
+
+TEST_F(ACompressedIncidenceArray, CompressesBothPartsOfAListSeparately) {
+  std::vector<HypernodeID> entries = { 7, 2, 9, 5, 1 };
+  CompressedIncidenceArray<HypernodeID> other;
+  auto range = [&](const size_t) { return std::make_pair(UL(0), entries.size()); };
+  auto split = [&](const size_t) { return UL(3); };
+  ASSERT_TRUE(other.compress(entries.data(), entries.size(), 1, range, split, true));
+  ASSERT_EQ(std::vector<HypernodeID>({ 2, 7, 9, 1, 5 }), entries);
+
+  std::vector<HypernodeID> first_part;
+  for ( auto it = other.iterator(0, 3); it != other.end(); ++it ) {
+    first_part.push_back(*it);
+  }
+  ASSERT_EQ(std::vector<HypernodeID>({ 2, 7, 9 }), first_part);
+
+  std::vector<HypernodeID> decompressed(entries.size(), 0);
+  other.decompress(decompressed.data(), 1, range, split);
+  ASSERT_EQ(entries, decompressed);
+}
+
+TEST_F(ACompressedIncidenceArray, CopiesCompressedLists) {
+  CompressedIncidenceArray<HypernodeID> copy = compressed.copy();
+  compressed.freeInternalData();
+  std::swap(compressed, copy);
+  verifyList(0, { 1, 3, 5 });
+  verifyList(2, { 0, 127, 128, 1000000 });
+  verifyList(3, { 42 });
+}
+
+}  // namespace ds
+}  // namespace mt_kahypar
@@ -49,7 +49,7 @@ void verifyArcIterator(const TestGraph& graph,
       if ( arcs[pos] == arc.head ) {
         ASSERT_FALSE(vis[pos]);
         ASSERT_EQ(arcs[pos], arc.head);
-        ASSERT_EQ(weights[pos], arc.weight);
+        ASSERT_EQ(static_cast<CompactArcWeight>(weights[pos]), arc.weight);
         vis[pos] = true;
         ++size;
       }
@@ -95,12 +95,14 @@ TEST_F(AGraph, VerifyNodeVolumeForUniformEdgeWeight) {
 
 TEST_F(AGraph, VerifyNodeVolumeForNonUniformEdgeWeight) {
   TestGraph graph(hypergraph, LouvainEdgeWeight::non_uniform);
+  // arc weights might be stored in single precision
+  const ArcWeight one_third = static_cast<CompactArcWeight>( 1.0 / 3.0 );
   ASSERT_EQ(0.75, graph.nodeVolume(0));
   ASSERT_EQ(0.25, graph.nodeVolume(1));
-  ASSERT_EQ(0.25 + ( 1.0 / 3.0 ), graph.nodeVolume(3));
-  ASSERT_EQ(1.0 / 3.0, graph.nodeVolume(5));
+  ASSERT_EQ(0.25 + one_third, graph.nodeVolume(3));
+  ASSERT_EQ(one_third, graph.nodeVolume(5));
   ASSERT_EQ(1.0, graph.nodeVolume(8));
-  ASSERT_EQ(1.0, graph.nodeVolume(10));
+  ASSERT_EQ(3 * one_third, graph.nodeVolume(10));
 }
 
 TEST_F(AGraph, WithCorrectVertexDegrees) {
@@ -358,4 +360,26 @@ TEST_F(AGraph, HasSameTotalVolumeAfterTwoContractions) {
   ASSERT_EQ(6,  coarse_coarse_graph.nodeVolume(2));
 }
 
+TEST_F(AGraph, CanBeReplacedByItsContraction) {
+  TestGraph graph(hypergraph, LouvainEdgeWeight::uniform);
+  const ArcWeight total_volume = graph.totalVolume();
+  Clustering communities = clustering( { 3, 3, 3, 2, 2, 4, 4, 3, 3, 2, 4 } );
+  graph = graph.contract(communities, true);
+  ASSERT_TRUE(graph.canBeUsed());
+  ASSERT_EQ(total_volume, graph.totalVolume());
+  ASSERT_EQ(3, graph.numNodes());
+  ASSERT_EQ(6, graph.numArcs());
+  ASSERT_EQ(7,  graph.nodeVolume(0));
+  ASSERT_EQ(11, graph.nodeVolume(1));
+  ASSERT_EQ(6,  graph.nodeVolume(2));
+
+  communities = clustering( { 0, 0, 1 } );
+  graph = graph.contract(communities, true);
+  ASSERT_EQ(total_volume, graph.totalVolume());
+  ASSERT_EQ(2, graph.numNodes());
+  ASSERT_EQ(2, graph.numArcs());
+  ASSERT_EQ(18, graph.nodeVolume(0));
+  ASSERT_EQ(6,  graph.nodeVolume(1));
+}
+
 } // namespace mt_kahypar::ds
\ No newline at end of file
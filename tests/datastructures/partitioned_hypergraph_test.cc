@@ -799,5 +799,29 @@ TYPED_TEST(APartitionedHypergraph, ComputesBorderNodesCorrectIfNodePartsAreSetOn
   ASSERT_TRUE(this->partitioned_hypergraph.isBorderNode(6));
 }
 
+TYPED_TEST(APartitionedHypergraph, InitializesLargeHyperedgeRestoredInSharedHypergraph) {
+  using PartitionedHypergraph = typename TestFixture::PartitionedHypergraph;
+  this->hypergraph.removeLargeEdge(1);
+  PartitionedHypergraph first(3, this->hypergraph, parallel_tag_t());
+  PartitionedHypergraph second(2, this->hypergraph, parallel_tag_t());
+  for ( const HypernodeID& hn : { 0, 1, 2, 3, 4, 5, 6 } ) {
+    first.setNodePart(hn, hn < 3 ? 0 : ( hn < 5 ? 1 : 2 ));
+    second.setNodePart(hn, hn < 4 ? 0 : 1);
+  }
+
+  // Both partitions share the hypergraph, in which the hyperedge is restored only once
+  this->hypergraph.restoreLargeEdge(1);
+  first.initializeRestoredLargeEdge(1);
+  second.initializeRestoredLargeEdge(1);
+
+  ASSERT_EQ(2, first.pinCountInPart(1, 0));
+  ASSERT_EQ(2, first.pinCountInPart(1, 1));
+  ASSERT_EQ(0, first.pinCountInPart(1, 2));
+  ASSERT_EQ(2, first.connectivity(1));
+  ASSERT_EQ(3, second.pinCountInPart(1, 0));
+  ASSERT_EQ(1, second.pinCountInPart(1, 1));
+  ASSERT_EQ(2, second.connectivity(1));
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -26,6 +26,7 @@
 
 
 #include <functional>
+#include <limits>
 #include <random>
 
 #include "gmock/gmock.h"
@@ -270,5 +271,135 @@ namespace BinaryHeap {
 
 }
 
+namespace BucketPQ {
+  using EBucketQueue = ExclusiveHandleHeap<BucketOrHeapQueue<int, int>>;
+
+  TEST(APriorityQueue, ReturnsMax) {
+    EBucketQueue h(400);
+    h.useBucketQueue(-100, 100);
+    h.insert(3, 4);
+    h.insert(2, 5);
+    h.insert(1, 1);
+    ASSERT_EQ(h.top(), 2);
+    ASSERT_EQ(h.topKey(), 5);
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 3);
+    ASSERT_EQ(h.topKey(), 4);
+  }
+
+  TEST(APriorityQueue, IncreaseKeyWorks) {
+    EBucketQueue h(400);
+    h.useBucketQueue(-100, 100);
+    h.insert(3, 4);
+    h.insert(2, 5);
+    h.insert(1, 1);
+    h.increaseKey(1, 50);
+    ASSERT_EQ(h.top(), 1);
+    ASSERT_EQ(h.topKey(), 50);
+    ASSERT_EQ(h.keyOf(1), 50);
+  }
+
+  TEST(APriorityQueue, DecreaseKeyWorks) {
+    EBucketQueue h(400);
+    h.useBucketQueue(-100, 100);
+    h.insert(3, 42);
+    h.insert(2, 54);
+    h.insert(1, 100);
+    h.decreaseKey(1, -2);
+    ASSERT_EQ(h.top(), 2);
+    ASSERT_EQ(h.topKey(), 54);
+    ASSERT_EQ(h.keyOf(1), -2);
+  }
+
+  TEST(APriorityQueue, RemoveLeavesRestIntact) {
+    EBucketQueue h(400);
+    h.useBucketQueue(-100, 100);
+    h.insert(5, 10);
+    h.insert(2, 11);
+    h.insert(1, 12);
+    h.insert(4, 9);
+    h.insert(0, 8);
+    h.insert(6, 14);
+    h.insert(7, 13);
+
+    ASSERT_TRUE(h.contains(2));
+    h.remove(2);
+    ASSERT_FALSE(h.contains(2));
+
+    std::vector<int> expected_id_order = {6, 7, 1, 5, 4, 0};
+    ASSERT_EQ(expected_id_order.size(), h.size());
+    size_t i = 0;
+    while (!h.empty()) {
+      ASSERT_EQ(h.top(), expected_id_order[i++]);
+      h.deleteTop();
+    }
+    ASSERT_TRUE(h.empty());
+  }
+
+  TEST(APriorityQueue, ReturnsExactKeysOutsideOfKeyRange) {
+    EBucketQueue h(400);
+    h.useBucketQueue(-10, 10);
+    h.insert(0, 5);
+    h.insert(1, 500);
+    h.insert(2, std::numeric_limits<int>::min());
+    ASSERT_EQ(h.top(), 1);
+    ASSERT_EQ(h.topKey(), 500);
+    h.deleteTop();
+    h.deleteTop();
+    ASSERT_EQ(h.top(), 2);
+    ASSERT_EQ(h.topKey(), std::numeric_limits<int>::min());
+  }
+
+  TEST(APriorityQueue, SwitchesBetweenBucketQueueAndHeap) {
+    EBucketQueue h(400);
+    h.useBucketQueue(-10, 10);
+    ASSERT_TRUE(h.usesBucketQueue());
+    h.insert(0, 5);
+    h.insert(1, 7);
+    h.clear();
+    ASSERT_TRUE(h.empty());
+    ASSERT_FALSE(h.contains(0));
+
+    h.useHeap();
+    ASSERT_FALSE(h.usesBucketQueue());
+    h.insert(0, 5000);
+    h.insert(1, 7);
+    ASSERT_EQ(h.top(), 0);
+    ASSERT_EQ(h.topKey(), 5000);
+  }
+
+  TEST(APriorityQueue, HeapSort) {
+    size_t n = 50000;
+    EBucketQueue h(n);
+    h.useBucketQueue(-1000, 1000);
+    std::vector<std::pair<int, int>> kv_pairs;
+    std::mt19937 rng(420);
+    std::uniform_int_distribution dist(-1000, 1000);
+    for (size_t i = 0; i < n; ++i) {
+      kv_pairs.emplace_back(dist(rng), i);
+    }
+    std::shuffle(kv_pairs.begin(), kv_pairs.end(), rng);
+
+    for (auto& x : kv_pairs) {
+      h.insert(x.second, x.first);
+    }
+    // Move some elements to other buckets
+    for (size_t i = 0; i < n; i += 7) {
+      kv_pairs[i].first = dist(rng);
+      h.adjustKey(kv_pairs[i].second, kv_pairs[i].first);
+    }
+
+    std::sort(kv_pairs.begin(), kv_pairs.end(), std::greater<std::pair<int, int>>());
+    size_t i = 0;
+    while (!h.empty()) {
+      ASSERT_EQ(h.topKey(), kv_pairs[i].first);
+      ASSERT_EQ(h.keyOf(h.top()), kv_pairs[i].first);
+      i++;
+      h.deleteTop();
+    }
+    ASSERT_EQ(i, n);
+  }
+}
+
 }  // namespace ds
 }  // namespace mt_kahypar
@@ -24,6 +24,13 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <random>
+#include <sstream>
+
 #include "gmock/gmock.h"
 
 #include "tests/datastructures/hypergraph_fixtures.h"
@@ -520,6 +527,259 @@ TEST_F(AStaticHypergraph, ContractCommunitiesIfCommunityInformationAreAvailable)
 
 }
 
+TEST_F(AStaticHypergraph, MergesIdenticalNetsDuringContraction) {
+  StaticHypergraph hg = StaticHypergraphFactory::construct(6, 7,
+    { {0, 1, 2}, {2, 1, 0}, {3, 4}, {1, 0, 2}, {4, 3}, {0, 5}, {5, 0} });
+  for ( const HyperedgeID& he : hg.edges() ) {
+    hg.setEdgeWeight(he, he + 1);
+  }
+  parallel::scalable_vector<HypernodeID> c_mapping = {0, 1, 2, 3, 4, 5};
+  StaticHypergraph c_hypergraph = hg.contract(c_mapping);
+
+  ASSERT_EQ(3, c_hypergraph.initialNumEdges());
+  ASSERT_EQ(7, c_hypergraph.initialNumPins());
+  ASSERT_EQ(7, c_hypergraph.edgeWeight(0));
+  ASSERT_EQ(8, c_hypergraph.edgeWeight(1));
+  ASSERT_EQ(13, c_hypergraph.edgeWeight(2));
+  verifyPins(c_hypergraph, { 0, 1, 2 },
+    { {0, 1, 2}, {3, 4}, {0, 5} });
+}
+
+TEST_F(AStaticHypergraph, MergesIdenticalNetsOfALargeHypergraphDuringContraction) {
+  // Enough hyperedges such that the fingerprints are sorted in parallel
+  const HypernodeID num_nodes = 1000;
+  const HyperedgeID num_edges = 200000;
+  const HypernodeID block_size = 40;
+  std::mt19937 prng(42);
+  vec<vec<HypernodeID>> edge_vector;
+  std::map<std::vector<HypernodeID>, HyperedgeWeight> expected_weights;
+  for ( HyperedgeID he = 0; he < num_edges; ++he ) {
+    // Pins are sampled from a small block of vertices which produces many identical nets
+    const HypernodeID offset = (he % (num_nodes / block_size)) * block_size;
+    const size_t size = 2 + prng() % 2;
+    vec<HypernodeID> pins;
+    while ( pins.size() < size ) {
+      const HypernodeID pin = offset + prng() % block_size;
+      if ( std::find(pins.begin(), pins.end(), pin) == pins.end() ) {
+        pins.push_back(pin);
+      }
+    }
+    std::vector<HypernodeID> contracted_pins;
+    for ( const HypernodeID& pin : pins ) {
+      contracted_pins.push_back(pin / 2);
+    }
+    std::sort(contracted_pins.begin(), contracted_pins.end());
+    contracted_pins.erase(std::unique(contracted_pins.begin(), contracted_pins.end()), contracted_pins.end());
+    if ( contracted_pins.size() > 1 ) {
+      ++expected_weights[contracted_pins];
+    }
+    edge_vector.emplace_back(std::move(pins));
+  }
+  StaticHypergraph hg = StaticHypergraphFactory::construct(num_nodes, num_edges, edge_vector);
+
+  parallel::scalable_vector<HypernodeID> c_mapping(num_nodes);
+  for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+    c_mapping[hn] = hn / 2;
+  }
+  StaticHypergraph c_hypergraph = hg.contract(c_mapping);
+
+  std::map<std::vector<HypernodeID>, HyperedgeWeight> actual_weights;
+  for ( const HyperedgeID& he : c_hypergraph.edges() ) {
+    std::vector<HypernodeID> pins;
+    for ( const HypernodeID& pin : c_hypergraph.pins(he) ) {
+      pins.push_back(pin);
+    }
+    std::sort(pins.begin(), pins.end());
+    ASSERT_EQ(0, actual_weights.count(pins));
+    actual_weights[pins] = c_hypergraph.edgeWeight(he);
+  }
+  ASSERT_EQ(expected_weights, actual_weights);
+}
+
+#ifdef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+TEST_F(AStaticHypergraph, DoesNotCompressIfCompressionDoesNotSaveMemory) {
+  // The offsets of the compressed lists require more memory than the small test hypergraph
+  hypergraph.compress();
+  ASSERT_FALSE(hypergraph.isCompressed());
+  verifyIncidentNets(3, { 1, 2 });
+  verifyPins({ 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+}
+
+TEST_F(AStaticHypergraph, VerifiesIncidentNetsIfCompressed) {
+  hypergraph.compress(true);
+  ASSERT_TRUE(hypergraph.isCompressed());
+  verifyIncidentNets(0, { 0, 1 });
+  verifyIncidentNets(1, { 1 });
+  verifyIncidentNets(2, { 0, 3 });
+  verifyIncidentNets(3, { 1, 2 });
+  verifyIncidentNets(4, { 1, 2 });
+  verifyIncidentNets(5, { 3 });
+  verifyIncidentNets(6, { 2, 3 });
+}
+
+TEST_F(AStaticHypergraph, VerifiesPinsOfHyperedgesIfCompressed) {
+  hypergraph.compress(true);
+  verifyPins({ 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+}
+
+TEST_F(AStaticHypergraph, EnumeratesPinsInIncreasingOrderIfCompressed) {
+  hypergraph.compress(true);
+  for ( const HyperedgeID& he : hypergraph.edges() ) {
+    std::vector<HypernodeID> pins(hypergraph.pins(he).begin(), hypergraph.pins(he).end());
+    ASSERT_EQ(hypergraph.edgeSize(he), pins.size());
+    ASSERT_TRUE(std::is_sorted(pins.begin(), pins.end()));
+  }
+}
+
+TEST_F(AStaticHypergraph, RestoresIncidenceArrayAfterDecompression) {
+  hypergraph.compress(true);
+  hypergraph.decompress();
+  ASSERT_FALSE(hypergraph.isCompressed());
+  verifyIncidentNets(0, { 0, 1 });
+  verifyIncidentNets(6, { 2, 3 });
+  verifyPins({ 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+}
+
+TEST_F(AStaticHypergraph, RestoresRemovedHyperedgeAfterDecompression) {
+  hypergraph.removeLargeEdge(1);
+  hypergraph.compress(true);
+  verifyIncidentNets(0, { 0 });
+  verifyIncidentNets(1, { });
+  verifyIncidentNets(3, { 2 });
+  hypergraph.decompress();
+  hypergraph.restoreLargeEdge(1);
+  verifyIncidentNets(0, { 0, 1 });
+  verifyIncidentNets(1, { 1 });
+  verifyIncidentNets(3, { 1, 2 });
+  verifyIncidentNets(4, { 1, 2 });
+}
+
+TEST_F(AStaticHypergraph, ComparesPinsOfHyperedgesIfCompressedHypergraphIsCopied) {
+  hypergraph.compress(true);
+  StaticHypergraph copy_hg = hypergraph.copy(parallel_tag_t());
+  ASSERT_TRUE(copy_hg.isCompressed());
+  verifyPins(copy_hg, { 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+  verifyIncidentNets(copy_hg, 3, { 1, 2 });
+}
+
+TEST_F(AStaticHypergraph, ContractsCommunitiesIfCompressed) {
+  hypergraph.compress(true);
+  parallel::scalable_vector<HypernodeID> c_mapping = {1, 4, 1, 5, 5, 6, 5};
+  StaticHypergraph c_hypergraph = hypergraph.contract(c_mapping);
+
+  ASSERT_FALSE(c_hypergraph.isCompressed());
+  ASSERT_EQ(4, c_hypergraph.initialNumNodes());
+  ASSERT_EQ(2, c_hypergraph.initialNumEdges());
+  ASSERT_EQ(6, c_hypergraph.initialNumPins());
+  verifyIncidentNets(c_hypergraph, 0, { 0, 1 });
+  verifyIncidentNets(c_hypergraph, 1, { 0 });
+  verifyIncidentNets(c_hypergraph, 2, { 0, 1 });
+  verifyIncidentNets(c_hypergraph, 3, { 1 });
+  verifyPins(c_hypergraph, { 0, 1 }, { {0, 1, 2}, {0, 2, 3} });
+}
+#endif
+
+
+// ! Writes the hypergraph in the binary format, applies the modification to the
+// ! file content and constructs a hypergraph from the modified file
+template<typename F>
+StaticHypergraph constructFromModifiedBinary(const StaticHypergraph& hypergraph, F modify) {
+  std::stringstream out;
+  StaticHypergraphFactory::writeBinary(hypergraph, out);
+  const std::string content = out.str();
+  auto buffer = std::make_shared<std::vector<uint64_t>>(content.size() / sizeof(uint64_t) + 1);
+  char* data = reinterpret_cast<char*>(buffer->data());
+  std::memcpy(data, content.data(), content.size());
+  modify(reinterpret_cast<binary::Header*>(data));
+  binary::MappedFile file;
+  file.header = reinterpret_cast<const binary::Header*>(data);
+  file.data = data;
+  file.length = content.size();
+  file.owner = buffer;
+  return StaticHypergraphFactory::constructFromBinary(file);
+}
+
+// ! Returns the element i of a section of the binary file
+template<typename T>
+T& elementOf(binary::Header* header, const size_t section, const size_t i, const size_t element_size) {
+  return *reinterpret_cast<T*>(reinterpret_cast<char*>(header) +
+    header->sections[section].offset + i * element_size);
+}
+
+TEST_F(AStaticHypergraph, ConstructsHypergraphFromBinaryFormat) {
+  StaticHypergraph hg = constructFromModifiedBinary(hypergraph, [](binary::Header*) { });
+  ASSERT_EQ(hypergraph.initialNumNodes(), hg.initialNumNodes());
+  ASSERT_EQ(hypergraph.initialNumEdges(), hg.initialNumEdges());
+  ASSERT_EQ(hypergraph.initialNumPins(), hg.initialNumPins());
+  verifyPins(hg, { 0, 1, 2, 3 },
+    { {0, 2}, {0, 1, 3, 4}, {3, 4, 6}, {2, 5, 6} });
+}
+
+TEST_F(AStaticHypergraph, RejectsBinaryFormatWithSectionOutsideOfFile) {
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    header->sections[2].num_elements += 1000;
+  }), InvalidInputException);
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    header->sections[3].offset += 1000 * binary::SECTION_ALIGNMENT;
+  }), InvalidInputException);
+}
+
+TEST_F(AStaticHypergraph, RejectsBinaryFormatWithOverflowingSectionSize) {
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    // offset + num_elements * element_size wraps around to a small value
+    header->sections[2].num_elements = std::numeric_limits<uint64_t>::max() / sizeof(HypernodeID) + 1;
+  }), InvalidInputException);
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    header->sections[1].offset = std::numeric_limits<uint64_t>::max() - binary::SECTION_ALIGNMENT + 1;
+  }), InvalidInputException);
+}
+
+TEST_F(AStaticHypergraph, RejectsBinaryFormatWithInconsistentNumberOfNodesOrEdges) {
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    header->num_nodes = std::numeric_limits<uint64_t>::max();
+  }), InvalidInputException);
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    header->num_edges += 2;
+  }), InvalidInputException);
+}
+
+TEST_F(AStaticHypergraph, RejectsBinaryFormatWithInconsistentNumberOfPins) {
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    header->num_pins -= 1;
+  }), InvalidInputException);
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    header->total_degree += 1;
+  }), InvalidInputException);
+}
+
+TEST_F(AStaticHypergraph, RejectsBinaryFormatWithInvalidOffsets) {
+  // The first member of a hyperedge is the index of its first pin
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    // Hyperedge 1 overlaps with hyperedge 0
+    elementOf<size_t>(header, 1, 1, header->edge_struct_size) = 1;
+  }), InvalidInputException);
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    // Hyperedge 3 ends behind the incidence array
+    elementOf<size_t>(header, 1, 3, header->edge_struct_size) = header->num_pins;
+  }), InvalidInputException);
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    // The incident nets of vertex 2 start before the ones of vertex 1
+    elementOf<size_t>(header, 0, 2, header->node_struct_size) = 0;
+  }), InvalidInputException);
+}
+
+TEST_F(AStaticHypergraph, RejectsBinaryFormatWithInvalidPinsOrIncidentNets) {
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    elementOf<HypernodeID>(header, 2, 0, sizeof(HypernodeID)) = header->num_nodes;
+  }), InvalidInputException);
+  ASSERT_THROW(constructFromModifiedBinary(hypergraph, [](binary::Header* header) {
+    elementOf<HyperedgeID>(header, 3, 0, sizeof(HyperedgeID)) = header->num_edges;
+  }), InvalidInputException);
+}
 
 }
 } // namespace mt_kahypar
\ No newline at end of file
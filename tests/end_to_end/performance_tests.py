@@ -0,0 +1,258 @@
+#!/usr/bin/python3
+#
+# Performance regression tests: runs each preset on a fixed set of instances with several
+# thread counts, records the running time of each phase, the peak memory usage (RSS) and the
+# objective and compares them against a checked-in baseline. Differences outside of the
+# tolerance bands are reported in a machine-readable JSON diff.
+#
+# Usage (from the root directory of the repository):
+#   ./tests/end_to_end/performance_tests.py                    # compare against the baseline
+#   ./tests/end_to_end/performance_tests.py --update-baseline  # record a new baseline
+#
+# The baseline is only meaningful for the machine on which it was recorded. Thus, no baseline
+# is checked in and the comparison is skipped (and reported as such) for each configuration
+# without a baseline until one has been recorded on the reference machine.
+import argparse
+import json
+import os
+import os.path
+import platform
+import statistics
+import subprocess
+import sys
+import tempfile
+import multiprocessing
+
+mt_kahypar_dir = os.path.abspath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..")) + "/"
+config_dir = mt_kahypar_dir + "config/"
+default_config_file = mt_kahypar_dir + "tests/end_to_end/performance_tests.json"
+default_baseline_file = mt_kahypar_dir + "tests/end_to_end/performance_baseline.json"
+num_available_cpus = multiprocessing.cpu_count()
+
+def bold(msg):
+  return "\033[1m" + msg + "\033[0m"
+
+def print_error(msg):
+  print("\033[1;91m[ERROR]\033[0m " + bold(msg))
+
+def print_warning(msg):
+  print("\033[1;93m[WARNING]\033[0m " + bold(msg))
+
+def print_success(msg):
+  print("\033[1;92m[SUCCESS]\033[0m " + bold(msg))
+
+def print_skipped(msg):
+  print("\033[1;96m[SKIPPED]\033[0m " + bold(msg))
+
+def run_id(preset, instance, k, threads):
+  return preset + "/" + os.path.basename(instance) + "/k" + str(k) + "/t" + str(threads)
+
+def machine_info():
+  cpu_model = platform.processor()
+  if os.path.exists("/proc/cpuinfo"):
+    with open("/proc/cpuinfo") as cpuinfo:
+      for line in cpuinfo:
+        if line.startswith("model name"):
+          cpu_model = line.split(":", 1)[1].strip()
+          break
+  return { "hostname": platform.node(),
+           "cpu_model": cpu_model,
+           "num_cpus": num_available_cpus }
+
+def git_revision():
+  try:
+    return subprocess.check_output(["git", "-C", mt_kahypar_dir, "rev-parse", "HEAD"],
+                                   universal_newlines=True, stderr=subprocess.DEVNULL).strip()
+  except (OSError, subprocess.CalledProcessError):
+    return ""
+
+def command(executable, preset_file, instance, k, epsilon, seed, threads, report_file):
+  return [ executable,
+           "-h" + instance,
+           "-p" + preset_file,
+           "-k" + str(k),
+           "-e" + str(epsilon),
+           "-t" + str(threads),
+           "-okm1",
+           "-mdirect",
+           "--seed=" + str(seed),
+           "--verbose=false",
+           "--performance-report=" + report_file ]
+
+def flatten_timings(timings, max_depth, prefix = "", depth = 0):
+  # Maps the path of each timing (e.g., "partition/coarsening") to its running time
+  phases = { }
+  for timing in timings:
+    key = prefix + timing["key"]
+    phases[key] = phases.get(key, 0.0) + timing["time"]
+    if depth + 1 < max_depth:
+      for child_key, child_time in flatten_timings(timing["children"], max_depth, key + "/", depth + 1).items():
+        phases[child_key] = phases.get(child_key, 0.0) + child_time
+  return phases
+
+def run_partitioner(cmd, report_file):
+  # We wait for the process with wait4(...) to obtain the resource usage of this process only
+  with tempfile.TemporaryFile(mode="w+") as output:
+    proc = subprocess.Popen(cmd, stdout=output, stderr=subprocess.STDOUT, universal_newlines=True)
+    _, status, rusage = os.wait4(proc.pid, 0)
+    proc.returncode = os.waitstatus_to_exitcode(status)
+    if proc.returncode != 0:
+      output.seek(0)
+      print_error("Partitioner terminates with non-zero exit code (Exit Code = " + str(proc.returncode) + ")")
+      print(output.read())
+      sys.exit(-1)
+  with open(report_file) as report:
+    result = json.load(report)
+  # ru_maxrss is in kilobytes on Linux
+  result["peak_rss_kb"] = rusage.ru_maxrss
+  return result
+
+def measure(executable, config, preset, instance, k, threads):
+  repetitions = config["repetitions"]
+  total_times = []
+  phase_times = { }
+  peak_rss = []
+  objectives = []
+  with tempfile.TemporaryDirectory() as tmp_dir:
+    report_file = os.path.join(tmp_dir, "report.json")
+    for _ in range(repetitions):
+      cmd = command(executable, config_dir + config["presets"][preset], mt_kahypar_dir + instance,
+                    k, config["epsilon"], config["seed"], threads, report_file)
+      report = run_partitioner(cmd, report_file)
+      total_times.append(report["total_partition_time"])
+      for phase, time in flatten_timings(report["timings"], config["phase_depth"]).items():
+        phase_times.setdefault(phase, []).append(time)
+      peak_rss.append(report["peak_rss_kb"])
+      objectives.append(report["metrics"]["quality"])
+  # We report the median of all repetitions to be robust against outliers
+  return { "total_time": statistics.median(total_times),
+           "phases": { phase: statistics.median(times) for phase, times in phase_times.items() },
+           "peak_rss_kb": statistics.median(peak_rss),
+           "objective": statistics.median(objectives) }
+
+def compare_metric(name, baseline, current, relative_tolerance, absolute_tolerance):
+  diff = current - baseline
+  relative_change = diff / baseline if baseline != 0 else 0.0
+  status = "unchanged"
+  # A difference is only significant if it exceeds both tolerances
+  if abs(diff) > absolute_tolerance and abs(relative_change) > relative_tolerance:
+    status = "regression" if diff > 0 else "improvement"
+  return { "metric": name,
+           "baseline": baseline,
+           "current": current,
+           "relative_change": relative_change,
+           "status": status }
+
+def compare(baseline, current, tolerance):
+  metrics = [ compare_metric("total_time", baseline["total_time"], current["total_time"],
+                             tolerance["relative_time"], tolerance["absolute_time"]),
+              compare_metric("peak_rss_kb", baseline["peak_rss_kb"], current["peak_rss_kb"],
+                             tolerance["relative_peak_rss"], tolerance["absolute_peak_rss_kb"]),
+              compare_metric("objective", baseline["objective"], current["objective"],
+                             tolerance["relative_objective"], 0) ]
+  for phase, time in current["phases"].items():
+    if phase in baseline["phases"]:
+      metrics.append(compare_metric("phase:" + phase, baseline["phases"][phase], time,
+                                    tolerance["relative_time"], tolerance["absolute_time"]))
+  if any(metric["status"] == "regression" for metric in metrics):
+    status = "regression"
+  elif any(metric["status"] == "improvement" for metric in metrics):
+    status = "improvement"
+  else:
+    status = "unchanged"
+  return status, metrics
+
+def main():
+  parser = argparse.ArgumentParser(description="Mt-KaHyPar performance regression tests")
+  parser.add_argument("--build-dir", default=mt_kahypar_dir + "build", help="CMake build directory")
+  parser.add_argument("--config", default=default_config_file, help="Instances, presets and tolerance bands")
+  parser.add_argument("--baseline", default=default_baseline_file, help="Baseline file")
+  parser.add_argument("--output", default="performance_diff.json", help="Output file of the JSON diff")
+  parser.add_argument("--update-baseline", action="store_true", help="Writes the measured results to the baseline file")
+  parser.add_argument("--filter", default="", help="Only runs configurations whose id contains this string")
+  args = parser.parse_args()
+
+  executable = os.path.join(args.build_dir, "mt-kahypar/application/MtKaHyPar")
+  if not os.path.exists(executable):
+    print_error("Executable " + executable + " does not exist (build the MtKaHyPar target first)")
+    sys.exit(-1)
+
+  with open(args.config) as config_file:
+    config = json.load(config_file)
+  baseline = { "machine": { }, "runs": { } }
+  if os.path.exists(args.baseline):
+    with open(args.baseline) as baseline_file:
+      baseline = json.load(baseline_file)
+
+  if not args.update_baseline and not baseline["runs"]:
+    # Without a baseline, no regression can be detected
+    print_skipped("Performance regression tests: no baseline recorded in " + args.baseline +
+                  " (record one on the reference machine with --update-baseline)")
+    sys.exit(0)
+
+  machine = machine_info()
+  if baseline["runs"] and baseline["machine"].get("cpu_model") != machine["cpu_model"]:
+    print_warning("Baseline was recorded on a different machine (" +
+                  str(baseline["machine"].get("cpu_model")) + ")")
+
+  results = { }
+  diff = { "baseline": args.baseline,
+           "baseline_revision": baseline.get("revision", ""),
+           "revision": git_revision(),
+           "machine": machine,
+           "tolerance": config["tolerance"],
+           "runs": [] }
+  for preset in config["presets"]:
+    for instance in config["instances"]:
+      for k in config["k"]:
+        for threads in config["threads"]:
+          id = run_id(preset, instance, k, threads)
+          if args.filter not in id:
+            continue
+          if threads > num_available_cpus:
+            print_warning("Skip " + id + " (only " + str(num_available_cpus) + " cpus available)")
+            continue
+          print(bold(id))
+          result = measure(executable, config, preset, instance, k, threads)
+          results[id] = result
+          summary = "Total Time = " + str(result["total_time"]) + \
+                    " Peak RSS = " + str(result["peak_rss_kb"]) + " KB" + \
+                    " Objective = " + str(result["objective"])
+          if id in baseline["runs"]:
+            status, metrics = compare(baseline["runs"][id], result, config["tolerance"])
+            diff["runs"].append({ "id": id, "status": status, "metrics": metrics })
+            for metric in metrics:
+              if metric["status"] == "regression":
+                print_error(metric["metric"] + ": " + str(metric["baseline"]) + " -> " + str(metric["current"]) +
+                            " (" + "{:+.1%}".format(metric["relative_change"]) + ")")
+            if status == "regression":
+              print_error(summary)
+            else:
+              print_success(summary)
+          else:
+            diff["runs"].append({ "id": id, "status": "missing_baseline", "metrics": [] })
+            print_skipped(summary + " (no baseline)")
+
+  statuses = [ run["status"] for run in diff["runs"] ]
+  diff["summary"] = { status: statuses.count(status) for status in
+                      [ "regression", "improvement", "unchanged", "missing_baseline" ] }
+  with open(args.output, "w") as output_file:
+    json.dump(diff, output_file, indent=2)
+  print("Diff written to " + args.output + ": " + json.dumps(diff["summary"]))
+
+  if args.update_baseline:
+    baseline["machine"] = machine
+    baseline["revision"] = diff["revision"]
+    baseline["runs"].update(results)
+    with open(args.baseline, "w") as baseline_file:
+      json.dump(baseline, baseline_file, indent=2, sort_keys=True)
+      baseline_file.write("\n")
+    print("Baseline written to " + args.baseline)
+  elif diff["summary"]["regression"] > 0:
+    sys.exit(1)
+  elif diff["summary"]["missing_baseline"] > 0:
+    print_skipped("Comparison of " + str(diff["summary"]["missing_baseline"]) + " configurations without a " +
+                  "baseline (record them on the reference machine with --update-baseline)")
+
+if __name__ == "__main__":
+  main()
@@ -91,6 +91,78 @@ namespace mt_kahypar {
     mt_kahypar_free_hypergraph(hypergraph);
   }
 
+  TEST(MtKaHyPar, ConstructStaticHypergraphFromCSR) {
+    const mt_kahypar_hypernode_id_t num_vertices = 7;
+    const mt_kahypar_hyperedge_id_t num_hyperedges = 4;
+
+    std::unique_ptr<size_t[]> hyperedge_indices = std::make_unique<size_t[]>(5);
+    hyperedge_indices[0] = 0; hyperedge_indices[1] = 2; hyperedge_indices[2] = 6;
+    hyperedge_indices[3] = 9; hyperedge_indices[4] = 12;
+
+    std::unique_ptr<mt_kahypar_hypernode_id_t[]> hyperedges = std::make_unique<mt_kahypar_hypernode_id_t[]>(12);
+    hyperedges[0] = 0;  hyperedges[1] = 2;                                        // Hyperedge 0
+    hyperedges[2] = 0;  hyperedges[3] = 1; hyperedges[4] = 3;  hyperedges[5] = 4; // Hyperedge 1
+    hyperedges[6] = 3;  hyperedges[7] = 4; hyperedges[8] = 6;                     // Hyperedge 2
+    hyperedges[9] = 2; hyperedges[10] = 5; hyperedges[11] = 6;                    // Hyperedge 3
+
+    std::unique_ptr<mt_kahypar_hyperedge_weight_t[]> hyperedge_weights =
+      std::make_unique<mt_kahypar_hyperedge_weight_t[]>(4);
+    hyperedge_weights[0] = 1; hyperedge_weights[1] = 2;
+    hyperedge_weights[2] = 3; hyperedge_weights[3] = 4;
+
+    mt_kahypar_construction_stats_t stats;
+    mt_kahypar_hypergraph_t hypergraph = mt_kahypar_create_hypergraph_from_csr(
+      DEFAULT, num_vertices, num_hyperedges, hyperedge_indices.get(),
+      hyperedges.get(), 12, hyperedge_weights.get(), nullptr, true, &stats);
+    ASSERT_EQ(hypergraph.type, STATIC_HYPERGRAPH);
+    hyperedge_indices.reset();
+
+    ASSERT_EQ(7, mt_kahypar_num_hypernodes(hypergraph));
+    ASSERT_EQ(4, mt_kahypar_num_hyperedges(hypergraph));
+    ASSERT_EQ(12, mt_kahypar_num_pins(hypergraph));
+    ASSERT_EQ(7, mt_kahypar_hypergraph_weight(hypergraph));
+    ASSERT_GE(stats.construction_time, 0.0);
+
+    mt_kahypar_context_t* context = mt_kahypar_context_new();
+    mt_kahypar_load_preset(context, DEFAULT);
+    mt_kahypar_set_partitioning_parameters(context, 2, 0.03, KM1);
+    mt_kahypar_set_context_parameter(context, VERBOSE, "0");
+    mt_kahypar_partitioned_hypergraph_t partitioned_hg = mt_kahypar_partition(hypergraph, context);
+    ASSERT_GE(mt_kahypar_km1(partitioned_hg), 0);
+
+    mt_kahypar_free_partitioned_hypergraph(partitioned_hg);
+    mt_kahypar_free_context(context);
+    mt_kahypar_free_hypergraph(hypergraph);
+  }
+
+  TEST(MtKaHyPar, RejectsInvalidAdjacencyArrayWhenConstructingFromCSR) {
+    const mt_kahypar_hypernode_id_t num_vertices = 7;
+    const mt_kahypar_hyperedge_id_t num_hyperedges = 4;
+    size_t hyperedge_indices[5] = { 0, 2, 6, 9, 12 };
+    mt_kahypar_hypernode_id_t hyperedges[12] = { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 };
+
+    // Hyperedge indices end behind the hyperedges array
+    mt_kahypar_hypergraph_t hypergraph = mt_kahypar_create_hypergraph_from_csr(
+      DEFAULT, num_vertices, num_hyperedges, hyperedge_indices, hyperedges, 11,
+      nullptr, nullptr, false, nullptr);
+    ASSERT_EQ(hypergraph.type, NULLPTR_HYPERGRAPH);
+
+    // Hyperedge indices are decreasing
+    hyperedge_indices[2] = 1;
+    hypergraph = mt_kahypar_create_hypergraph_from_csr(
+      DEFAULT, num_vertices, num_hyperedges, hyperedge_indices, hyperedges, 12,
+      nullptr, nullptr, false, nullptr);
+    ASSERT_EQ(hypergraph.type, NULLPTR_HYPERGRAPH);
+    hyperedge_indices[2] = 6;
+
+    // Pin is not a valid vertex ID
+    hyperedges[4] = num_vertices;
+    hypergraph = mt_kahypar_create_hypergraph_from_csr(
+      DEFAULT, num_vertices, num_hyperedges, hyperedge_indices, hyperedges, 12,
+      nullptr, nullptr, true, nullptr);
+    ASSERT_EQ(hypergraph.type, NULLPTR_HYPERGRAPH);
+  }
+
   TEST(MtKaHyPar, ConstructUnweightedDynamicHypergraph) {
     const mt_kahypar_hypernode_id_t num_vertices = 7;
     const mt_kahypar_hyperedge_id_t num_hyperedges = 4;
@@ -431,6 +503,48 @@ namespace mt_kahypar {
       partition(hypergraph, &partitioned_hg, context, num_blocks, epsilon, nullptr);
     }
 
+    void PartitionForMultipleK(const char* filename,
+                               const mt_kahypar_file_format_type_t format,
+                               const mt_kahypar_preset_type_t preset,
+                               const std::vector<mt_kahypar_partition_id_t>& ks,
+                               const double epsilon,
+                               const mt_kahypar_objective_t objective,
+                               const bool verbose = false) {
+      SetUpContext(preset, ks[0], epsilon, objective, verbose);
+      Load(filename, preset, format);
+      std::vector<mt_kahypar_partitioned_hypergraph_t> partitioned_hgs(ks.size());
+      const Context& c = *reinterpret_cast<const Context*>(context);
+      const size_t num_vcycles = c.partition.num_vcycles;
+      mt_kahypar_partition_for_multiple_k(hypergraph, context, ks.data(), ks.size(), partitioned_hgs.data());
+      // The context of the caller is not modified
+      ASSERT_EQ(ks[0], c.partition.k);
+      ASSERT_EQ(num_vcycles, c.partition.num_vcycles);
+
+      const mt_kahypar_hypernode_id_t num_nodes = mt_kahypar_num_hypernodes(hypergraph);
+      const mt_kahypar_hypernode_weight_t total_weight = mt_kahypar_hypergraph_weight(hypergraph);
+      for ( size_t i = 0; i < ks.size(); ++i ) {
+        ASSERT_NE(NULLPTR_PARTITION, partitioned_hgs[i].type);
+        std::unique_ptr<mt_kahypar_partition_id_t[]> partition =
+          std::make_unique<mt_kahypar_partition_id_t[]>(num_nodes);
+        mt_kahypar_get_partition(partitioned_hgs[i], partition.get());
+        std::vector<mt_kahypar_hypernode_weight_t> block_weights(ks[i], 0);
+        for ( mt_kahypar_hypernode_id_t hn = 0; hn < num_nodes; ++hn ) {
+          ASSERT_GE(partition[hn], 0);
+          ASSERT_LT(partition[hn], ks[i]);
+          ++block_weights[partition[hn]];
+        }
+        const double max_block_weight = (1.0 + epsilon) *
+          std::ceil(static_cast<double>(total_weight) / ks[i]);
+        for ( const mt_kahypar_hypernode_weight_t& weight : block_weights ) {
+          ASSERT_LE(weight, max_block_weight);
+        }
+        if ( debug ) {
+          LOG << "k =" << ks[i] << "km1 =" << mt_kahypar_km1(partitioned_hgs[i]);
+        }
+        mt_kahypar_free_partitioned_hypergraph(partitioned_hgs[i]);
+      }
+    }
+
     void Map(const char* filename,
             const mt_kahypar_file_format_type_t format,
             const mt_kahypar_preset_type_t preset,
@@ -687,6 +801,22 @@ namespace mt_kahypar {
     Partition(GRAPH_FILE, METIS, HIGHEST_QUALITY, 4, 0.03, CUT, false);
   }
 
+  TEST_F(APartitioner, PartitionsAHypergraphForMultipleKWithDefaultPreset) {
+    PartitionForMultipleK(HYPERGRAPH_FILE, HMETIS, DEFAULT, { 2, 8, 4 }, 0.03, KM1, false);
+  }
+
+  TEST_F(APartitioner, PartitionsAGraphForMultipleKWithDefaultPreset) {
+    PartitionForMultipleK(GRAPH_FILE, METIS, DEFAULT, { 2, 8, 4 }, 0.03, CUT, false);
+  }
+
+  TEST_F(APartitioner, PartitionsAHypergraphForMultipleKWithQualityPreset) {
+    PartitionForMultipleK(HYPERGRAPH_FILE, HMETIS, QUALITY, { 2, 4 }, 0.03, KM1, false);
+  }
+
+  TEST_F(APartitioner, PartitionsAHypergraphForMultipleKWithHighestQualityPreset) {
+    PartitionForMultipleK(HYPERGRAPH_FILE, HMETIS, HIGHEST_QUALITY, { 4, 2 }, 0.03, KM1, false);
+  }
+
   TEST_F(APartitioner, CanPartitionTwoHypergraphsSimultanously) {
     tbb::parallel_invoke([&]() {
       PartitionAnotherHypergraph(HYPERGRAPH_FILE, HMETIS, DETERMINISTIC, 4, 0.03, KM1, false);
@@ -759,6 +889,49 @@ namespace mt_kahypar {
     ImprovePartition(DEFAULT, 3, false);
   }
 
+  TEST_F(APartitioner, ReturnsPerformanceReport) {
+    Partition(HYPERGRAPH_FILE, HMETIS, DEFAULT, 4, 0.03, KM1, false);
+
+    char* report = mt_kahypar_performance_report(partitioned_hg, context);
+    ASSERT_NE(nullptr, report);
+    const std::string json(report);
+    mt_kahypar_free_performance_report(report);
+
+    ASSERT_EQ('{', json.front());
+    ASSERT_EQ('}', json.back());
+    for ( const std::string& key : { "metrics", "timings", "stats", "coarsening_levels",
+                                     "refinement_levels", "phases", "memory", "context" } ) {
+      ASSERT_NE(std::string::npos, json.find("\"" + key + "\":")) << key;
+    }
+    ASSERT_EQ(std::string::npos, json.find("\"coarsening_levels\":[]"));
+    ASSERT_EQ(std::string::npos, json.find("\"refinement_levels\":[]"));
+  }
+
+  TEST_F(APartitioner, ReturnsPeakMemoryOfEachPhase) {
+    mt_kahypar_load_preset(context, DEFAULT);
+    mt_kahypar_set_partitioning_parameters(context, 4, 0.03, KM1);
+    mt_kahypar_set_context_parameter(context, VERBOSE, "0");
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, MEASURE_PEAK_MEMORY, "1"));
+    hypergraph = mt_kahypar_read_hypergraph_from_file(HYPERGRAPH_FILE, DEFAULT, HMETIS);
+    partitioned_hg = mt_kahypar_partition(hypergraph, context);
+    ASSERT_NE(NULLPTR_PARTITION, partitioned_hg.type);
+
+    size_t process_rss = 0;
+    size_t process_tracked = 0;
+    ASSERT_EQ(0, mt_kahypar_peak_memory(context, nullptr, &process_rss, &process_tracked));
+    for ( const char* phase : { "coarsening", "initial_partitioning", "refinement" } ) {
+      size_t peak_rss = 0;
+      size_t peak_tracked = 0;
+      ASSERT_EQ(0, mt_kahypar_peak_memory(context, phase, &peak_rss, &peak_tracked)) << phase;
+      ASSERT_LT(0UL, peak_rss) << phase;
+      ASSERT_LT(0UL, peak_tracked) << phase;
+      ASSERT_LE(peak_tracked, process_tracked) << phase;
+    }
+    size_t peak_rss = 0;
+    size_t peak_tracked = 0;
+    ASSERT_EQ(1, mt_kahypar_peak_memory(context, "unknown_phase", &peak_rss, &peak_tracked));
+  }
+
   TEST_F(APartitioner, PartitionsHypergraphWithIndividualBlockWeights) {
     // Setup Individual Block Weights
     std::unique_ptr<mt_kahypar_hypernode_weight_t[]> block_weights =
@@ -844,6 +1017,10 @@ namespace mt_kahypar {
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, OBJECTIVE, "km1"));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, NUM_VCYCLES, "3"));
     ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, VERBOSE, "1"));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, TIME_LIMIT, "10"));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, MEASURE_PEAK_MEMORY, "1"));
+    ASSERT_EQ(0, mt_kahypar_set_context_parameter(context, MAX_MEMORY, "1024"));
+    ASSERT_EQ(2, mt_kahypar_set_context_parameter(context, MAX_MEMORY, "-1"));
 
 
     Context& c = *reinterpret_cast<Context*>(context);
@@ -852,6 +1029,9 @@ namespace mt_kahypar {
     ASSERT_EQ(Objective::km1, c.partition.objective);
     ASSERT_EQ(3, c.partition.num_vcycles);
     ASSERT_TRUE(c.partition.verbose_output);
+    ASSERT_EQ(10, c.partition.time_limit);
+    ASSERT_TRUE(c.partition.measure_peak_memory);
+    ASSERT_EQ(UL(1024), c.partition.max_memory);
 
     mt_kahypar_free_context(context);
   }
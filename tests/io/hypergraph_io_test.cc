@@ -24,10 +24,13 @@
  * SOFTWARE.
  ******************************************************************************/
 
+#include <fstream>
+
 #include "gmock/gmock.h"
 
 #include "tests/definitions.h"
 #include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
 #include "mt-kahypar/partition/context_enum_classes.h"
 
 using ::testing::Test;
@@ -293,6 +296,52 @@ TYPED_TEST(AGraphReader, ReadsAMetisGraphWithNodeWeights) {
   }
 }
 
+TYPED_TEST(AGraphReader, ReadsAMetisGraphWithMissingTrailingLines) {
+  this->readHypergraph("../tests/instances/graph_missing_trailing_lines.graph", FileFormat::Metis);
+
+  // Verify Neighbors
+  this->verifyNeighbors(
+    { { 1, 2, 4 },
+      { 0, 2, 3 },
+      { 0, 1, 3, 4 },
+      { 1, 2, 5, 6 },
+      { 0, 2, 5 },
+      { 3, 4, 6 },
+      { 3, 5 },
+      { }, { }, { } } );
+
+  // Verify Node Weights
+  for ( HypernodeID hn = 0; hn < 10; ++hn ) {
+    ASSERT_EQ(1, this->hypergraph.nodeWeight(hn));
+  }
+}
+
+TYPED_TEST(AGraphReader, ReadsAMetisGraphWithNodeWeightsAndMissingTrailingLines) {
+  this->readHypergraph("../tests/instances/graph_with_node_weights_missing_trailing_lines.graph", FileFormat::Metis);
+
+  // Verify Neighbors
+  this->verifyNeighbors(
+    { { 1, 2, 4 },
+      { 0, 2, 3 },
+      { 0, 1, 3, 4 },
+      { 1, 2, 5, 6 },
+      { 0, 2, 5 },
+      { 3, 4, 6 },
+      { 3, 5 },
+      { }, { } } );
+
+  // Verify Node Weights
+  ASSERT_EQ(4, this->hypergraph.nodeWeight(0));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(1));
+  ASSERT_EQ(5, this->hypergraph.nodeWeight(2));
+  ASSERT_EQ(3, this->hypergraph.nodeWeight(3));
+  ASSERT_EQ(1, this->hypergraph.nodeWeight(4));
+  ASSERT_EQ(6, this->hypergraph.nodeWeight(5));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(6));
+  ASSERT_EQ(1, this->hypergraph.nodeWeight(7));
+  ASSERT_EQ(1, this->hypergraph.nodeWeight(8));
+}
+
 TYPED_TEST(AGraphReader, ReadsAMetisGraphWithEdgeWeights) {
   this->readHypergraph("../tests/instances/graph_with_edge_weights.graph", FileFormat::Metis);
 
@@ -343,5 +392,142 @@ TYPED_TEST(AGraphReader, ReadsAMetisGraphWithNodeAndEdgeWeights) {
   ASSERT_EQ(1, this->hypergraph.nodeWeight(7));
 }
 
+TYPED_TEST(AHypergraphReader, ReadsABinaryHypergraphWithNodeAndEdgeWeights) {
+  const std::string binary_file = "hypergraph_with_node_and_edge_weights.bin";
+  {
+    ds::StaticHypergraph hypergraph = readInputFile<ds::StaticHypergraph>(
+      "../tests/instances/hypergraph_with_node_and_edge_weights.hgr", FileFormat::hMetis, true);
+    writeBinaryFile(hypergraph, binary_file);
+  }
+  ASSERT_EQ(InstanceType::hypergraph, instanceTypeOfInputFile(binary_file, FileFormat::Binary));
+  this->readHypergraph(binary_file, FileFormat::Binary);
+  std::remove(binary_file.c_str());
+
+  // Verify Incident Nets
+  this->verifyIncidentNets(
+    { { 0, 1 }, { 1 }, { 0, 3 }, { 1, 2 },
+      {1, 2}, { 3 }, { 2, 3 } });
+
+  // Verify Pins
+  this->verifyPins({ { 0, 2 }, { 0, 1, 3, 4 },
+    { 3, 4, 6 }, { 2, 5, 6 } });
+
+  // Verify Node Weights
+  ASSERT_EQ(5, this->hypergraph.nodeWeight(0));
+  ASSERT_EQ(8, this->hypergraph.nodeWeight(1));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(2));
+  ASSERT_EQ(3, this->hypergraph.nodeWeight(3));
+  ASSERT_EQ(4, this->hypergraph.nodeWeight(4));
+  ASSERT_EQ(9, this->hypergraph.nodeWeight(5));
+  ASSERT_EQ(8, this->hypergraph.nodeWeight(6));
+  ASSERT_EQ(39, this->hypergraph.totalWeight());
+
+  // Verify Edge Weights
+  ASSERT_EQ(4, this->hypergraph.edgeWeight(0));
+  ASSERT_EQ(2, this->hypergraph.edgeWeight(1));
+  ASSERT_EQ(3, this->hypergraph.edgeWeight(2));
+  ASSERT_EQ(8, this->hypergraph.edgeWeight(3));
+}
+
+TYPED_TEST(AGraphReader, ReadsABinaryGraphWithNodeAndEdgeWeights) {
+  const std::string binary_file = "graph_with_node_and_edge_weights.bin";
+  {
+    ds::StaticGraph graph = readInputFile<ds::StaticGraph>(
+      "../tests/instances/graph_with_node_and_edge_weights.graph", FileFormat::Metis, true);
+    writeBinaryFile(graph, binary_file);
+  }
+  ASSERT_EQ(InstanceType::graph, instanceTypeOfInputFile(binary_file, FileFormat::Binary));
+  this->readHypergraph(binary_file, FileFormat::Binary);
+  std::remove(binary_file.c_str());
+
+  // Verify Neighbors and Edge Weights
+  this->verifyNeighborsAndEdgeWeights(
+    { { { 1, 1 }, { 2, 2 }, { 4, 1 } },
+      { { 0, 1 }, { 2, 2 }, { 3, 1 } },
+      { { 0, 2 }, { 1, 2 }, { 3, 2 }, { 4, 3 } },
+      { { 1, 1 }, { 2, 2 }, { 5, 2 }, { 6, 5 } },
+      { { 0, 1 }, { 2, 3 }, { 5, 2 } },
+      { { 3, 2 }, { 4, 2 }, { 6, 6 } },
+      { { 3, 5 }, { 5, 6 } },
+      { } } );
+
+  // Verify Node Weights
+  ASSERT_EQ(4, this->hypergraph.nodeWeight(0));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(1));
+  ASSERT_EQ(5, this->hypergraph.nodeWeight(2));
+  ASSERT_EQ(3, this->hypergraph.nodeWeight(3));
+  ASSERT_EQ(1, this->hypergraph.nodeWeight(4));
+  ASSERT_EQ(6, this->hypergraph.nodeWeight(5));
+  ASSERT_EQ(2, this->hypergraph.nodeWeight(6));
+  ASSERT_EQ(1, this->hypergraph.nodeWeight(7));
+}
+
+TEST(AHypergraphFileReader, ReadsHyperedgesInCSRFormat) {
+  HyperedgeID num_hyperedges = 0;
+  HypernodeID num_hypernodes = 0;
+  HyperedgeID num_removed_single_pin_hyperedges = 0;
+  HyperedgeCSR hyperedges;
+  vec<HyperedgeWeight> hyperedges_weight;
+  vec<HypernodeWeight> hypernodes_weight;
+  readHypergraphFile("../tests/instances/unweighted_hypergraph.hgr", num_hyperedges,
+    num_hypernodes, num_removed_single_pin_hyperedges, hyperedges,
+    hyperedges_weight, hypernodes_weight);
+
+  ASSERT_EQ(4, num_hyperedges);
+  ASSERT_EQ(7, num_hypernodes);
+  ASSERT_EQ(vec<size_t>({ 0, 2, 6, 9, 12 }), hyperedges.offsets);
+  const std::vector<HypernodeID> expected_pins = { 0, 2, 0, 1, 3, 4, 3, 4, 6, 2, 5, 6 };
+  ASSERT_EQ(expected_pins.size(), hyperedges.pins.size());
+  for ( size_t i = 0; i < expected_pins.size(); ++i ) {
+    ASSERT_EQ(expected_pins[i], hyperedges.pins[i]) << V(i);
+  }
+
+  const HyperedgeVector edge_vector = toHyperedgeVector(hyperedges);
+  ASSERT_EQ(4, edge_vector.size());
+  ASSERT_EQ(Hyperedge({ 0, 1, 3, 4 }), edge_vector[1]);
+}
+
+TEST(AnInputSizeReader, ReadsSizeOfHypergraphFile) {
+  const InputSize size = readInputSize("../tests/instances/unweighted_hypergraph.hgr", false);
+  ASSERT_EQ(UL(7), size.num_hypernodes);
+  ASSERT_EQ(UL(4), size.num_hyperedges);
+  ASSERT_GE(size.num_pins, UL(12));
+}
+
+TEST(AnInputSizeReader, ReadsSizeOfGraphFile) {
+  const InputSize size = readInputSize("../tests/instances/graph_with_node_and_edge_weights.graph", true);
+  ASSERT_EQ(UL(8), size.num_hypernodes);
+  ASSERT_EQ(UL(22), size.num_hyperedges);
+  ASSERT_EQ(UL(22), size.num_pins);
+}
+
+TEST(AnInputSizeReader, DetectsInputsThatFitInto32BitIDs) {
+  ASSERT_FALSE(requires64BitIDs("../tests/instances/unweighted_hypergraph.hgr", FileFormat::hMetis));
+  ASSERT_FALSE(requires64BitIDs("../tests/instances/graph_with_node_and_edge_weights.graph", FileFormat::Metis));
+
+  const std::string binary_file = "input_size_test.bin";
+  writeBinaryFile(readInputFile<ds::StaticHypergraph>(
+    "../tests/instances/unweighted_hypergraph.hgr", FileFormat::hMetis, true), binary_file);
+  ASSERT_EQ(sizeof(HypernodeID) > sizeof(uint32_t), requires64BitIDs(binary_file, FileFormat::Binary));
+  std::remove(binary_file.c_str());
+}
+
+TEST(AnInputSizeReader, DetectsInputsThatRequire64BitIDs) {
+  const std::string filename = "input_size_test.hgr";
+  {
+    // Only the header is read
+    std::ofstream out(filename);
+    out << "% comment\n1 4294967295\n1 2\n";
+  }
+  const InputSize size = readInputSize(filename, false);
+  ASSERT_EQ(UL(4294967295), size.num_hypernodes);
+  ASSERT_TRUE(requires64BitIDs(filename, FileFormat::hMetis));
+  std::remove(filename.c_str());
+}
+
+TEST(ABinaryFileReader, RejectsTextFiles) {
+  ASSERT_THROW(mmapBinaryFile("../tests/instances/unweighted_hypergraph.hgr"), InvalidInputException);
+}
+
 }  // namespace io
 }  // namespace mt_kahypar
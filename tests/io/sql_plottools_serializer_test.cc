@@ -35,6 +35,9 @@
 #include "tests/definitions.h"
 #include "mt-kahypar/io/sql_plottools_serializer.h"
 #include "mt-kahypar/io/csv_output.h"
+#include "mt-kahypar/io/json_output.h"
+#include "mt-kahypar/utils/json_writer.h"
+#include "mt-kahypar/utils/utilities.h"
 
 using ::testing::Test;
 
@@ -57,12 +60,12 @@ std::unordered_map<std::string, std::string> target_struct_prefix =
     {"DeterministicRefinement", "sync_lp_"}, {"FlowParameters", "flow_"}, {"MappingParameters", "mapping_"} };
 
 std::set<std::string> excluded_members =
-  { "verbose_output", "show_detailed_timings", "show_detailed_clustering_timings", "timings_output_depth", "show_memory_consumption", "show_advanced_cut_analysis", "enable_progress_bar", "sp_process_output",
+  { "verbose_output", "show_detailed_timings", "show_detailed_clustering_timings", "measure_perf_counters", "measure_peak_memory", "timings_output_depth", "show_memory_consumption", "show_advanced_cut_analysis", "enable_progress_bar", "sp_process_output",
     "measure_detailed_uncontraction_timings", "write_partition_file", "graph_partition_output_folder", "graph_partition_filename", "graph_community_filename", "community_detection",
     "community_redistribution", "coarsening_rating", "label_propagation", "lp_execute_sequential", "deterministic_refinement",
     "snapshot_interval", "initial_partitioning_refinement", "initial_partitioning_enabled_ip_algos", "original_num_threads",
     "stable_construction_of_incident_edges", "fm", "global_fm", "flows", "csv_output", "preset_file", "preset_type", "instance_type", "degree_of_parallelism",
-    "mapping_target_graph_file" };
+    "mapping_target_graph_file", "hierarchy_cache_file", "performance_report_file", "trace_file" };
 
 bool is_target_struct(const std::string& line) {
   for ( const std::string& target_struct : target_structs ) {
@@ -222,5 +225,103 @@ TEST(CSVTest, HeaderAndRowContainSameNumberOfColumns) {
   ASSERT_EQ(std::count(body.begin(), body.end(), ','), std::count(header.begin(), header.end(), ','));
 }
 
+// ! Checks that all brackets outside of strings are balanced
+bool is_well_formed_json(const std::string& json) {
+  std::vector<char> brackets;
+  bool in_string = false;
+  for ( size_t i = 0; i < json.size(); ++i ) {
+    const char c = json[i];
+    if ( in_string ) {
+      if ( c == '\\' ) {
+        ++i;
+      } else if ( c == '"' ) {
+        in_string = false;
+      }
+    } else if ( c == '"' ) {
+      in_string = true;
+    } else if ( c == '{' || c == '[' ) {
+      brackets.push_back(c);
+    } else if ( c == '}' || c == ']' ) {
+      if ( brackets.empty() || brackets.back() != ( c == '}' ? '{' : '[' ) ) {
+        return false;
+      }
+      brackets.pop_back();
+    }
+  }
+  return brackets.empty() && !in_string;
+}
+
+TEST(JSONTest, WritesNestedObjectsAndArrays) {
+  std::stringstream ss;
+  utils::JSONWriter json(ss);
+  json.beginObject();
+  json.field("name", std::string("a\"b\\c\n"));
+  json.field("flag", true);
+  json.field("small", static_cast<uint8_t>(7));
+  json.field("nan", std::numeric_limits<double>::quiet_NaN());
+  json.key("values").beginArray();
+  json.value(1);
+  json.beginObject();
+  json.field("objective", Objective::km1);
+  json.endObject();
+  json.endArray();
+  json.key("empty").beginObject();
+  json.endObject();
+  json.endObject();
+  ASSERT_EQ("{\"name\":\"a\\\"b\\\\c\\n\",\"flag\":true,\"small\":7,\"nan\":null,"
+            "\"values\":[1,{\"objective\":\"km1\"}],\"empty\":{}}", ss.str());
+}
+
+TEST(JSONTest, WritesHierarchicalTimings) {
+  utils::Timer timer;
+  timer.start_timer("coarsening", "Coarsening");
+  timer.start_timer("clustering", "Clustering");
+  timer.stop_timer("clustering");
+  timer.stop_timer("coarsening");
+  timer.start_timer("refinement", "Refinement");
+  timer.stop_timer("refinement");
+
+  std::stringstream ss;
+  utils::JSONWriter json(ss);
+  timer.serializeJSON(json);
+  const std::string result = ss.str();
+  ASSERT_TRUE(is_well_formed_json(result));
+  const size_t coarsening_pos = result.find("{\"key\":\"coarsening\"");
+  const size_t clustering_pos = result.find("{\"key\":\"clustering\"");
+  const size_t refinement_pos = result.find("{\"key\":\"refinement\"");
+  ASSERT_NE(std::string::npos, coarsening_pos);
+  ASSERT_NE(std::string::npos, clustering_pos);
+  ASSERT_NE(std::string::npos, refinement_pos);
+  // Clustering is a child of coarsening
+  ASSERT_LT(coarsening_pos, clustering_pos);
+  ASSERT_LT(clustering_pos, refinement_pos);
+}
+
+TEST(JSONTest, SerializesAllSectionsOfPerformanceReport) {
+  tests::Hypergraph dummy_hypergraph;
+  tests::PartitionedHypergraph dummy_partitioned_hypergraph(2, dummy_hypergraph);
+  Context dummy_context;
+  dummy_context.partition.graph_filename = "dummy.hgr";
+  dummy_context.partition.k = 2;
+  dummy_context.partition.perfect_balance_part_weights.assign(2, 0);
+  dummy_context.partition.max_part_weights.assign(2, 0);
+  utils::Utilities& utils = utils::Utilities::instance();
+  utils.getStats(dummy_context.utility_id).add_stat("initial_km1", static_cast<int64_t>(42));
+  utils.getPerformanceLog(dummy_context.utility_id).addCoarseningLevel(1, 10, 5, 20, 0.1);
+  utils.getPerformanceLog(dummy_context.utility_id).addRefinementLevel(1, 10, 5, 20, 0.1, 12, 10);
+  utils.getPerformanceLog(dummy_context.utility_id).addPhase("refinement", 12, 8);
+
+  std::string result = json::serialize(dummy_partitioned_hypergraph,
+    dummy_context, std::chrono::duration<double>(0.2));
+  ASSERT_TRUE(is_well_formed_json(result));
+  for ( const std::string& key : { "metrics", "timings", "stats", "coarsening_levels",
+                                   "refinement_levels", "phases", "memory", "context" } ) {
+    ASSERT_NE(std::string::npos, result.find("\"" + key + "\":")) << key;
+  }
+  ASSERT_NE(std::string::npos, result.find("\"graph\":\"dummy.hgr\""));
+  ASSERT_NE(std::string::npos, result.find("\"initial_km1\":42"));
+  ASSERT_NE(std::string::npos, result.find("\"objective_delta\":-4"));
+}
+
 }  // namespace io
 }  // namespace mt_kahypar
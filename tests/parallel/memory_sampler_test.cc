@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include "mt-kahypar/parallel/stl/scalable_queue.h"
+#include "mt-kahypar/parallel/stl/scalable_vector.h"
+#include "mt-kahypar/utils/memory_sampler.h"
+#include "mt-kahypar/utils/timer.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+using parallel::AllocationTracker;
+using utils::MemorySampler;
+using utils::PeakMemory;
+
+static constexpr size_t MB = 1024 * 1024;
+
+TEST(AllocationTrackerTest, TracksAllocationsOfScalableVectors) {
+  AllocationTracker::enable();
+  const size_t before = AllocationTracker::current();
+  {
+    vec<char> data(8 * MB);
+    ASSERT_LE(before + 8 * MB, AllocationTracker::current());
+  }
+  ASSERT_EQ(before, AllocationTracker::current());
+  AllocationTracker::disable();
+}
+
+TEST(AllocationTrackerTest, TracksAllocationsOfScalableQueues) {
+  AllocationTracker::enable();
+  const size_t before = AllocationTracker::current();
+  {
+    parallel::scalable_queue<size_t> queue;
+    for ( size_t i = 0; i < MB; ++i ) {
+      queue.push(i);
+    }
+    ASSERT_LE(before + MB * sizeof(size_t), AllocationTracker::current());
+  }
+  ASSERT_EQ(before, AllocationTracker::current());
+  AllocationTracker::disable();
+}
+
+TEST(AllocationTrackerTest, DoesNotTrackAllocationsIfDisabled) {
+  ASSERT_FALSE(AllocationTracker::isEnabled());
+  const size_t before = AllocationTracker::current();
+  {
+    vec<char> data(8 * MB);
+    ASSERT_EQ(before, AllocationTracker::current());
+  }
+  ASSERT_EQ(before, AllocationTracker::current());
+}
+
+TEST(AllocationTrackerTest, IgnoresFreesOfAllocationsMadeBeforeTrackingIsEnabled) {
+  ASSERT_FALSE(AllocationTracker::isEnabled());
+  vec<char> untracked(8 * MB);
+  AllocationTracker::enable();
+  vec<char> tracked(MB);
+  const size_t before = AllocationTracker::current();
+  ASSERT_LE(MB, before);
+  untracked = vec<char>();
+  ASSERT_EQ(before, AllocationTracker::current());
+  tracked = vec<char>();
+  ASSERT_EQ(before - MB, AllocationTracker::current());
+  AllocationTracker::disable();
+}
+
+TEST(AllocationTrackerTest, ResetsPeakToCurrentValue) {
+  AllocationTracker::enable();
+  {
+    vec<char> data(8 * MB);
+  }
+  ASSERT_LE(AllocationTracker::current() + 8 * MB, AllocationTracker::resetPeak());
+  ASSERT_EQ(AllocationTracker::current(), AllocationTracker::peak());
+  AllocationTracker::disable();
+}
+
+TEST(MemorySamplerTest, MeasuresPeakOfTrackedAllocationsWithinScope) {
+  MemorySampler& sampler = MemorySampler::instance();
+  sampler.enable();
+  const size_t before = AllocationTracker::current();
+  const size_t scope = sampler.beginScope();
+  {
+    vec<char> data(16 * MB);
+  }
+  const PeakMemory peak = sampler.endScope(scope);
+  sampler.disable();
+  ASSERT_LE(before + 16 * MB, peak.tracked);
+  ASSERT_LT(UL(0), peak.rss);
+}
+
+TEST(MemorySamplerTest, MeasuresPeakOfNestedScopes) {
+  MemorySampler& sampler = MemorySampler::instance();
+  sampler.enable();
+  const size_t outer = sampler.beginScope();
+  {
+    vec<char> data(16 * MB);
+  }
+  const size_t inner = sampler.beginScope();
+  {
+    vec<char> data(4 * MB);
+  }
+  const PeakMemory inner_peak = sampler.endScope(inner);
+  const PeakMemory outer_peak = sampler.endScope(outer);
+  ASSERT_LE(AllocationTracker::current() + 4 * MB, inner_peak.tracked);
+  ASSERT_GT(AllocationTracker::current() + 16 * MB, inner_peak.tracked);
+  ASSERT_LE(AllocationTracker::current() + 16 * MB, outer_peak.tracked);
+  sampler.disable();
+}
+
+TEST(MemorySamplerTest, AddsPeakMemoryToSequentialTimings) {
+  MemorySampler& sampler = MemorySampler::instance();
+  sampler.enable();
+  utils::Timer timer;
+  timer.start_timer("phase", "Phase");
+  {
+    vec<char> data(8 * MB);
+  }
+  timer.stop_timer("phase");
+  sampler.disable();
+
+  PeakMemory peak;
+  ASSERT_TRUE(timer.peakMemory("phase", peak));
+  ASSERT_LE(8 * MB, peak.tracked);
+  ASSERT_FALSE(timer.peakMemory("unknown_phase", peak));
+  std::stringstream ss;
+  ss << timer;
+  ASSERT_NE(std::string::npos, ss.str().find("Peak RSS"));
+}
+
+TEST(MemorySamplerTest, DoesNotMeasureTimingsIfDisabled) {
+  utils::Timer timer;
+  timer.start_timer("phase", "Phase");
+  timer.stop_timer("phase");
+  PeakMemory peak;
+  ASSERT_FALSE(timer.peakMemory("phase", peak));
+  std::stringstream ss;
+  ss << timer;
+  ASSERT_EQ(std::string::npos, ss.str().find("Peak RSS"));
+}
+
+}  // namespace mt_kahypar
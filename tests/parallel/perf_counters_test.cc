@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/utils/perf_counters.h"
+#include "mt-kahypar/utils/timer.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+using utils::PerfCounterType;
+using utils::PerfCounterValues;
+
+TEST(PerfCounterValuesTest, ComputesDifference) {
+  PerfCounterValues lhs;
+  PerfCounterValues rhs;
+  lhs.values = { 10, 20, 5, 7 };
+  rhs.values = { 4, 30, 5, 2 };
+  const PerfCounterValues diff = lhs - rhs;
+  ASSERT_EQ(UL(6), diff.get(PerfCounterType::cycles));
+  // Values of multiplexed counters are not monotone
+  ASSERT_EQ(UL(0), diff.get(PerfCounterType::instructions));
+  ASSERT_EQ(UL(0), diff.get(PerfCounterType::llc_misses));
+  ASSERT_EQ(UL(5), diff.get(PerfCounterType::dtlb_misses));
+}
+
+TEST(PerfCounterValuesTest, ComputesDerivedMetrics) {
+  PerfCounterValues values;
+  values.values = { 1000, 2000, 10, 4 };
+  ASSERT_DOUBLE_EQ(2.0, values.instructionsPerCycle());
+  ASSERT_DOUBLE_EQ(5.0, values.missesPerKiloInstruction(PerfCounterType::llc_misses));
+  ASSERT_DOUBLE_EQ(2.0, values.missesPerKiloInstruction(PerfCounterType::dtlb_misses));
+  ASSERT_DOUBLE_EQ(0.0, PerfCounterValues().instructionsPerCycle());
+}
+
+TEST(PerfCountersTest, CountsInstructionsOfAllThreads) {
+  utils::PerfCounters& perf_counters = utils::PerfCounters::instance();
+  if ( !perf_counters.enable() || !perf_counters.isAvailable(PerfCounterType::instructions) ) {
+    perf_counters.disable();
+    GTEST_SKIP() << "Perf events are not available";
+  }
+
+  std::atomic<size_t> sum(0);
+  const PerfCounterValues before = perf_counters.read();
+  tbb::parallel_for(0, 1000000, [&](const int i) {
+    sum.fetch_add(i, std::memory_order_relaxed);
+  });
+  const PerfCounterValues after = perf_counters.read();
+  perf_counters.disable();
+  ASSERT_LT(UL(1000000), (after - before).get(PerfCounterType::instructions));
+}
+
+TEST(PerfCountersTest, AddsCountersToSequentialTimings) {
+  utils::PerfCounters& perf_counters = utils::PerfCounters::instance();
+  if ( !perf_counters.enable() ) {
+    GTEST_SKIP() << "Perf events are not available";
+  }
+
+  utils::Timer timer;
+  timer.start_timer("phase", "Phase");
+  size_t sum = 0;
+  for ( size_t i = 0; i < 100000; ++i ) {
+    sum += i * i;
+  }
+  timer.stop_timer("phase");
+  perf_counters.disable();
+  ASSERT_LT(UL(0), sum);
+
+  std::stringstream ss;
+  ss << timer;
+  ASSERT_NE(std::string::npos, ss.str().find("IPC"));
+}
+
+TEST(PerfCountersTest, IsNoOpIfDisabled) {
+  utils::PerfCounters& perf_counters = utils::PerfCounters::instance();
+  perf_counters.disable();
+  ASSERT_EQ(UL(0), perf_counters.read().get(PerfCounterType::cycles));
+
+  utils::Timer timer;
+  timer.start_timer("phase", "Phase");
+  timer.stop_timer("phase");
+  std::stringstream ss;
+  ss << timer;
+  ASSERT_EQ(std::string::npos, ss.str().find("IPC"));
+}
+
+}  // namespace mt_kahypar
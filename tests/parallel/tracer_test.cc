@@ -0,0 +1,123 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include <sstream>
+
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/utils/tracer.h"
+#include "mt-kahypar/utils/timer.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+class ATracer : public Test {
+
+ public:
+  ATracer() :
+    tracer(utils::Tracer::instance()) {
+    tracer.clear();
+    tracer.enable();
+  }
+
+  ~ATracer() {
+    tracer.disable();
+    tracer.clear();
+  }
+
+  void verifyBalancedSpans() {
+    for ( const utils::Tracer::ThreadBuffer& buffer : tracer.threadBuffers() ) {
+      int depth = 0;
+      double last_timestamp = 0.0;
+      for ( const utils::Tracer::Event& event : buffer.events ) {
+        depth += event.type == utils::Tracer::EventType::begin_span ? 1 : -1;
+        ASSERT_GE(depth, 0);
+        ASSERT_LE(last_timestamp, event.timestamp);
+        last_timestamp = event.timestamp;
+      }
+      ASSERT_EQ(0, depth);
+    }
+  }
+
+  utils::Tracer& tracer;
+};
+
+TEST_F(ATracer, DoesNotRecordEventsIfDisabled) {
+  tracer.disable();
+  {
+    utils::ScopedTrace trace("Span", "test");
+  }
+  ASSERT_EQ(UL(0), tracer.numEvents());
+}
+
+TEST_F(ATracer, RecordsBeginAndEndEventOfSpan) {
+  {
+    utils::ScopedTrace trace("Span", "test");
+  }
+  ASSERT_EQ(UL(2), tracer.numEvents());
+  verifyBalancedSpans();
+}
+
+TEST_F(ATracer, RecordsNestedSpansOfParallelTasks) {
+  tbb::parallel_for(0, 1000, [&](const int) {
+    utils::ScopedTrace outer("Outer", "test");
+    tbb::parallel_for(0, 10, [&](const int) {
+      utils::ScopedTrace inner("Inner", "test");
+    });
+  });
+  ASSERT_EQ(UL(2 * (1000 + 10 * 1000)), tracer.numEvents());
+  verifyBalancedSpans();
+}
+
+TEST_F(ATracer, RecordsTimingsIfTimerIsDisabled) {
+  utils::Timer timer;
+  timer.disable();
+  timer.start_timer("outer", "Outer");
+  timer.start_timer("inner", "Inner");
+  timer.stop_timer("inner");
+  timer.stop_timer("outer");
+  ASSERT_EQ(UL(4), tracer.numEvents());
+  verifyBalancedSpans();
+}
+
+TEST_F(ATracer, WritesChromeTraceEventFormat) {
+  {
+    utils::ScopedTrace trace("Span \"A\"", "test");
+  }
+  std::stringstream ss;
+  tracer.serializeJSON(ss);
+  const std::string trace = ss.str();
+  ASSERT_EQ(UL(0), trace.find("{\"traceEvents\":["));
+  ASSERT_NE(std::string::npos, trace.find("\"name\":\"Span \\\"A\\\"\",\"cat\":\"test\",\"ph\":\"B\""));
+  ASSERT_NE(std::string::npos, trace.find("\"cat\":\"test\",\"ph\":\"E\""));
+  ASSERT_NE(std::string::npos, trace.find("\"ph\":\"M\""));
+  ASSERT_NE(std::string::npos, trace.find("\"displayTimeUnit\":\"ms\"}"));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,246 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "gmock/gmock.h"
+
+#include "tests/datastructures/hypergraph_fixtures.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/hierarchy_cache.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+}
+
+class AHierarchyCache : public ds::HypergraphFixture<Hypergraph> {
+
+ using Base = ds::HypergraphFixture<Hypergraph>;
+
+ public:
+  AHierarchyCache() :
+    Base(),
+    context(),
+    filename(::testing::TempDir() + "hierarchy_cache_test.bin") {
+    context.partition.k = 2;
+    context.partition.mode = Mode::direct;
+    context.partition.partition_type = MULTILEVEL_HYPERGRAPH_PARTITIONING;
+    context.partition.verbose_output = false;
+    context.partition.hierarchy_cache_file = filename;
+    context.coarsening.contraction_limit = 2;
+    context.type = ContextType::main;
+    std::remove(filename.c_str());
+    hypergraph.setCommunityIDs(ds::Clustering { 0, 0, 0, 1, 1, 1, 1 });
+  }
+
+  ~AHierarchyCache() {
+    std::remove(filename.c_str());
+  }
+
+  // ! Contracts the hypergraph twice: 7 -> 4 -> 2 nodes
+  void coarsen(UncoarseningData<TypeTraits>& uncoarsening_data) {
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    uncoarsening_data.performMultilevelContraction({ 0, 0, 1, 2, 2, 3, 3 }, true, start);
+    uncoarsening_data.performMultilevelContraction({ 0, 0, 1, 1 }, true, start);
+    uncoarsening_data.finalizeCoarsening();
+  }
+
+  void store(Hypergraph& hg) {
+    HierarchyCache<TypeTraits> cache(context);
+    ASSERT_TRUE(cache.isApplicable(hg));
+    ASSERT_FALSE(cache.load(hg));
+    UncoarseningData<TypeTraits> uncoarsening_data(false, hg, context);
+    coarsen(uncoarsening_data);
+    cache.store(hg, uncoarsening_data);
+  }
+
+  void verifyEqual(const Hypergraph& expected, const Hypergraph& actual) {
+    ASSERT_EQ(expected.initialNumNodes(), actual.initialNumNodes());
+    ASSERT_EQ(expected.initialNumEdges(), actual.initialNumEdges());
+    ASSERT_EQ(expected.initialNumPins(), actual.initialNumPins());
+    ASSERT_EQ(expected.totalWeight(), actual.totalWeight());
+    for ( const HypernodeID& hn : expected.nodes() ) {
+      ASSERT_EQ(expected.nodeWeight(hn), actual.nodeWeight(hn));
+      ASSERT_EQ(expected.communityID(hn), actual.communityID(hn));
+    }
+    for ( const HyperedgeID& he : expected.edges() ) {
+      ASSERT_TRUE(actual.edgeIsEnabled(he));
+      ASSERT_EQ(expected.edgeWeight(he), actual.edgeWeight(he));
+      verifyPins(actual, { he }, { std::set<HypernodeID>(
+        expected.pins(he).begin(), expected.pins(he).end()) });
+    }
+  }
+
+  std::string readFile() const {
+    std::ifstream in(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+
+  void writeFile(const std::string& content) const {
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), content.size());
+  }
+
+  // ! Overwrites the value at the given byte offset of the cache file
+  template<typename T>
+  void patch(const size_t offset, const T value) const {
+    std::string content = readFile();
+    ASSERT_LE(offset + sizeof(T), content.size());
+    std::memcpy(content.data() + offset, &value, sizeof(T));
+    writeFile(content);
+  }
+
+  // ! Byte offsets of the fields of the cache file header
+  static constexpr size_t KEY_LENGTH_OFFSET = 24;
+  static constexpr size_t NUM_LEVELS_OFFSET = 40;
+  static constexpr size_t HEADER_SIZE = 48;
+  static constexpr size_t LEVEL_HEADER_SIZE = 32;
+
+  using Base::hypergraph;
+  Context context;
+  std::string filename;
+};
+
+TEST_F(AHierarchyCache, IsNotApplicableWithoutCacheFile) {
+  context.partition.hierarchy_cache_file = "";
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.isApplicable(hypergraph));
+}
+
+TEST_F(AHierarchyCache, IsNotApplicableForNLevelPartitioning) {
+  context.partition.partition_type = N_LEVEL_HYPERGRAPH_PARTITIONING;
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.isApplicable(hypergraph));
+}
+
+TEST_F(AHierarchyCache, DoesNotLoadNonExistingCacheFile) {
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.load(hypergraph));
+  ASSERT_FALSE(cache.isLoaded());
+}
+
+TEST_F(AHierarchyCache, LoadsStoredHierarchy) {
+  store(hypergraph);
+
+  Hypergraph copy = hypergraph.copy();
+  copy.setCommunityIDs(ds::Clustering(copy.initialNumNodes(), 0));
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_TRUE(cache.load(copy));
+  cache.applyCommunities(copy);
+  for ( const HypernodeID& hn : hypergraph.nodes() ) {
+    ASSERT_EQ(hypergraph.communityID(hn), copy.communityID(hn));
+  }
+
+  UncoarseningData<TypeTraits> expected(false, hypergraph, context);
+  coarsen(expected);
+  UncoarseningData<TypeTraits> actual(false, copy, context);
+  cache.moveHierarchy(actual);
+  ASSERT_TRUE(actual.is_finalized);
+  ASSERT_EQ(expected.hierarchy.size(), actual.hierarchy.size());
+  for ( size_t i = 0; i < expected.hierarchy.size(); ++i ) {
+    ASSERT_EQ(expected.hierarchy[i].communities(), actual.hierarchy[i].communities());
+    verifyEqual(expected.hierarchy[i].contractedHypergraph(),
+                actual.hierarchy[i].contractedHypergraph());
+  }
+  ASSERT_EQ(2, actual.coarsestPartitionedHypergraph().initialNumNodes());
+}
+
+TEST_F(AHierarchyCache, RejectsCacheOfDifferentInput) {
+  store(hypergraph);
+
+  Hypergraph other = Hypergraph::Factory::construct(
+    7 , 4, { {0, 2}, {0, 1, 3, 4}, {3, 4, 5}, {2, 5, 6} }, nullptr, nullptr, true);
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.load(other));
+}
+
+TEST_F(AHierarchyCache, RejectsCacheComputedWithDifferentCoarseningParameters) {
+  store(hypergraph);
+
+  context.coarsening.contraction_limit = 4;
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.load(hypergraph));
+}
+
+TEST_F(AHierarchyCache, IgnoresSeed) {
+  store(hypergraph);
+
+  context.partition.seed = 42;
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_TRUE(cache.load(hypergraph));
+}
+
+TEST_F(AHierarchyCache, RejectsTruncatedCache) {
+  store(hypergraph);
+
+  const std::string content = readFile();
+  writeFile(content.substr(0, content.size() / 2));
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.load(hypergraph));
+  ASSERT_FALSE(cache.isLoaded());
+}
+
+TEST_F(AHierarchyCache, RejectsCacheWithInvalidKeyLength) {
+  store(hypergraph);
+
+  patch(KEY_LENGTH_OFFSET, std::numeric_limits<uint64_t>::max());
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.load(hypergraph));
+}
+
+TEST_F(AHierarchyCache, RejectsCacheWithInvalidNumberOfLevels) {
+  store(hypergraph);
+
+  patch(NUM_LEVELS_OFFSET, std::numeric_limits<uint64_t>::max());
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.load(hypergraph));
+}
+
+TEST_F(AHierarchyCache, RejectsCacheWithMappingToNonExistingCoarseNode) {
+  store(hypergraph);
+
+  uint64_t key_length = 0;
+  std::memcpy(&key_length, readFile().data() + KEY_LENGTH_OFFSET, sizeof(uint64_t));
+  size_t offset = ds::binary::alignSection(HEADER_SIZE);
+  offset = ds::binary::alignSection(offset + key_length);
+  offset = ds::binary::alignSection(offset + hypergraph.initialNumNodes() * sizeof(PartitionID));
+  offset = ds::binary::alignSection(offset + LEVEL_HEADER_SIZE);
+  patch(offset, ID(100));
+  HierarchyCache<TypeTraits> cache(context);
+  ASSERT_FALSE(cache.load(hypergraph));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,279 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <filesystem>
+
+#include "gmock/gmock.h"
+
+#include "tests/datastructures/hypergraph_fixtures.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/memory_budget.h"
+#include "mt-kahypar/partition/coarsening/coarsening_commons.h"
+#include "mt-kahypar/partition/refinement/gains/km1/sparse_km1_gain_cache.h"
+#include "mt-kahypar/parallel/stl/tracked_scalable_allocator.h"
+#include "mt-kahypar/utils/exception.h"
+#include "mt-kahypar/utils/memory_tree.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+}
+
+class AMemoryBudget : public ds::HypergraphFixture<Hypergraph> {
+
+ using Base = ds::HypergraphFixture<Hypergraph>;
+
+ public:
+  AMemoryBudget() :
+    Base(),
+    context() {
+    context.partition.k = 2;
+    context.partition.epsilon = 0.03;
+    context.partition.mode = Mode::direct;
+    context.partition.partition_type = MULTILEVEL_HYPERGRAPH_PARTITIONING;
+    context.partition.verbose_output = false;
+    context.coarsening.contraction_limit = 2;
+    context.initial_partitioning.runs = 20;
+    context.refinement.flows.algorithm = FlowAlgorithm::flow_cutter;
+    context.refinement.flows.alpha = 16;
+    context.shared_memory.num_threads = 64;
+    context.type = ContextType::main;
+  }
+
+  // ! Hypergraph with n nodes where each hyperedge contains four consecutive nodes
+  static Hypergraph largeHypergraph(const HypernodeID num_nodes) {
+    vec<vec<HypernodeID>> edges;
+    for ( HypernodeID u = 0; u + 3 < num_nodes; ++u ) {
+      edges.push_back({ u, u + 1, u + 2, u + 3 });
+    }
+    return Hypergraph::Factory::construct(num_nodes, edges.size(), edges);
+  }
+
+  // ! Contracts the hypergraph twice: 7 -> 4 -> 2 nodes
+  void coarsen(UncoarseningData<TypeTraits>& uncoarsening_data) {
+    const HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+    uncoarsening_data.performMultilevelContraction({ 0, 0, 1, 2, 2, 3, 3 }, true, start);
+    uncoarsening_data.performMultilevelContraction({ 0, 0, 1, 1 }, true, start);
+    uncoarsening_data.finalizeCoarsening();
+  }
+
+  using Base::hypergraph;
+  Context context;
+};
+
+TEST_F(AMemoryBudget, DoesNotChangeContextWithoutMemoryBudget) {
+  context.partition.max_memory = 0;
+  memory_budget::plan(hypergraph, context);
+  ASSERT_FALSE(context.coarsening.spill_fine_levels);
+  ASSERT_EQ(UL(20), context.initial_partitioning.runs);
+  ASSERT_EQ(FlowAlgorithm::flow_cutter, context.refinement.flows.algorithm);
+}
+
+TEST_F(AMemoryBudget, DoesNotChangeContextIfBudgetIsSufficient) {
+  context.partition.max_memory = 1024 * 1024;
+  memory_budget::plan(hypergraph, context);
+  ASSERT_FALSE(context.coarsening.spill_fine_levels);
+  ASSERT_EQ(UL(20), context.initial_partitioning.runs);
+  ASSERT_EQ(FlowAlgorithm::flow_cutter, context.refinement.flows.algorithm);
+}
+
+TEST_F(AMemoryBudget, EstimatesLessMemoryForCheaperAlternatives) {
+  Hypergraph hg = largeHypergraph(100000);
+  context.coarsening.contraction_limit = 160;
+  const memory_budget::Estimate initial = memory_budget::estimate(hg, context);
+
+  context.coarsening.spill_fine_levels = true;
+  const memory_budget::Estimate spilled = memory_budget::estimate(hg, context);
+  ASSERT_LT(spilled.hierarchy, initial.hierarchy);
+
+  context.initial_partitioning.runs = 1;
+  const memory_budget::Estimate fewer_runs = memory_budget::estimate(hg, context);
+  ASSERT_LT(fewer_runs.initial_partitioning, spilled.initial_partitioning);
+
+  context.refinement.flows.algorithm = FlowAlgorithm::do_nothing;
+  const memory_budget::Estimate without_flows = memory_budget::estimate(hg, context);
+  ASSERT_EQ(UL(0), without_flows.flows);
+  ASSERT_LT(without_flows.peak(), initial.peak());
+}
+
+TEST_F(AMemoryBudget, ChoosesCheaperAlternativesUnderMemoryPressure) {
+  Hypergraph hg = largeHypergraph(100000);
+  context.coarsening.contraction_limit = 160;
+  const memory_budget::Estimate initial = memory_budget::estimate(hg, context);
+  // Budget is slightly smaller than the estimated memory requirements
+  context.partition.max_memory = ( initial.peak() - 1 ) / ( 1024 * 1024 );
+  ASSERT_GT(context.partition.max_memory, UL(0));
+  memory_budget::plan(hg, context);
+  ASSERT_TRUE(context.coarsening.spill_fine_levels);
+  ASSERT_LE(memory_budget::estimate(hg, context).peak(), context.partition.max_memory * 1024 * 1024);
+}
+
+TEST_F(AMemoryBudget, AccountsForCopiesOfTheInputHypergraph) {
+  Hypergraph hg = largeHypergraph(100000);
+  context.coarsening.contraction_limit = 160;
+  const memory_budget::Estimate without_copies = memory_budget::estimate(hg, context);
+  ASSERT_EQ(UL(0), without_copies.input_copies);
+
+  context.preprocessing.relabeling = RelabelingType::bfs;
+  const memory_budget::Estimate relabeled = memory_budget::estimate(hg, context);
+  ASSERT_GT(relabeled.input_copies, UL(0));
+  ASSERT_EQ(without_copies.peak() + relabeled.input_copies, relabeled.peak());
+
+  context.preprocessing.use_identical_vertex_reduction = true;
+  const memory_budget::Estimate reduced = memory_budget::estimate(hg, context);
+  ASSERT_EQ(2 * relabeled.input_copies, reduced.input_copies);
+}
+
+TEST_F(AMemoryBudget, AccountsForInputHypergraphConstructedBeforeAllocationTracking) {
+  // Same as the library interface: the input is constructed before the partitioner enables
+  // the allocation tracking (see --measure-peak-memory)
+  ASSERT_FALSE(parallel::AllocationTracker::isEnabled());
+  Hypergraph hg = largeHypergraph(100000);
+  context.coarsening.contraction_limit = 160;
+  context.preprocessing.relabeling = RelabelingType::bfs;
+  const memory_budget::Estimate untracked = memory_budget::estimate(hg, context);
+
+  parallel::AllocationTracker::enable();
+  const memory_budget::Estimate tracked = memory_budget::estimate(hg, context);
+  parallel::AllocationTracker::disable();
+  utils::MemoryTreeNode hypergraph_memory("Hypergraph");
+  hg.memoryConsumption(&hypergraph_memory);
+  hypergraph_memory.finalize();
+  ASSERT_GE(tracked.used, hypergraph_memory.sizeInBytes());
+  ASSERT_EQ(untracked.used, tracked.used);
+  ASSERT_EQ(untracked.peak(), tracked.peak());
+}
+
+TEST_F(AMemoryBudget, DisablesCopiesOfTheInputHypergraphUnderMemoryPressure) {
+  Hypergraph hg = largeHypergraph(100000);
+  context.coarsening.contraction_limit = 160;
+  const size_t peak_without_copies = memory_budget::estimate(hg, context).peak();
+  context.preprocessing.relabeling = RelabelingType::bfs;
+  context.preprocessing.use_identical_vertex_reduction = true;
+  // Budget only suffices without the copies
+  context.partition.max_memory = peak_without_copies / ( 1024 * 1024 ) + 1;
+  ASSERT_GT(memory_budget::estimate(hg, context).peak(), context.partition.max_memory * 1024 * 1024);
+  memory_budget::plan(hg, context);
+  ASSERT_EQ(RelabelingType::none, context.preprocessing.relabeling);
+  ASSERT_FALSE(context.preprocessing.use_identical_vertex_reduction);
+  ASSERT_FALSE(context.coarsening.spill_fine_levels);
+  ASSERT_EQ(UL(20), context.initial_partitioning.runs);
+}
+
+TEST_F(AMemoryBudget, EstimatesLessMemoryForSparseGainCache) {
+  Hypergraph hg = largeHypergraph(100000);
+  context.partition.k = 1024;
+  context.refinement.fm.algorithm = FMAlgorithm::kway_fm;
+  context.partition.gain_policy = GainPolicy::km1;
+  const memory_budget::Estimate dense = memory_budget::estimate(hg, context);
+  context.partition.gain_policy = GainPolicy::sparse_km1;
+  const memory_budget::Estimate sparse = memory_budget::estimate(hg, context);
+  ASSERT_LT(sparse.refinement, dense.refinement);
+  ASSERT_EQ(dense.refinement - sparse.refinement,
+    hg.initialNumNodes() * ( context.partition.k + 1 ) * sizeof(HyperedgeWeight) -
+    SparseKm1GainCache::size_in_bytes(hg.initialNumNodes(), hg.initialTotalVertexDegree(), context.partition.k));
+}
+
+TEST_F(AMemoryBudget, FailsIfBudgetCannotBeMet) {
+  Hypergraph hg = largeHypergraph(100000);
+  context.coarsening.contraction_limit = 160;
+  // The input hypergraph alone does not fit into the budget
+  context.partition.max_memory = 1;
+  context.initial_partitioning.runs = 1;
+  context.shared_memory.num_threads = 1;
+  const memory_budget::Estimate initial = memory_budget::estimate(hg, context);
+  ASSERT_GT(initial.peak() - initial.used, UL(1024 * 1024));
+  ASSERT_THROW(memory_budget::plan(hg, context), InvalidParameterException);
+}
+
+TEST_F(AMemoryBudget, SpillsFineLevelsDuringCoarsening) {
+  context.coarsening.spill_fine_levels = true;
+  UncoarseningData<TypeTraits> uncoarsening_data(false, hypergraph, context);
+  coarsen(uncoarsening_data);
+
+  ASSERT_EQ(UL(2), uncoarsening_data.hierarchy.size());
+  ASSERT_TRUE(uncoarsening_data.hierarchy[0].isSpilled());
+  ASSERT_FALSE(uncoarsening_data.hierarchy[1].isSpilled());
+  ASSERT_TRUE(std::filesystem::exists(uncoarsening_data.hierarchy[0].spillFile()));
+  ASSERT_EQ(2, uncoarsening_data.coarsestPartitionedHypergraph().initialNumNodes());
+}
+
+TEST_F(AMemoryBudget, DoesNotSpillLevelsWithoutMemoryPressure) {
+  UncoarseningData<TypeTraits> uncoarsening_data(false, hypergraph, context);
+  coarsen(uncoarsening_data);
+
+  ASSERT_EQ(UL(2), uncoarsening_data.hierarchy.size());
+  ASSERT_FALSE(uncoarsening_data.hierarchy[0].isSpilled());
+  ASSERT_TRUE(uncoarsening_data.hierarchy[0].spillFile().empty());
+}
+
+TEST_F(AMemoryBudget, ReloadsSpilledLevels) {
+  UncoarseningData<TypeTraits> expected(false, hypergraph, context);
+  coarsen(expected);
+  Hypergraph copy = hypergraph.copy();
+  context.coarsening.spill_fine_levels = true;
+  UncoarseningData<TypeTraits> actual(false, copy, context);
+  coarsen(actual);
+
+  actual.loadLevel(0);
+  ASSERT_FALSE(actual.hierarchy[0].isSpilled());
+  const Hypergraph& expected_hg = expected.hierarchy[0].contractedHypergraph();
+  const Hypergraph& actual_hg = actual.hierarchy[0].contractedHypergraph();
+  ASSERT_EQ(expected_hg.initialNumNodes(), actual_hg.initialNumNodes());
+  ASSERT_EQ(expected_hg.initialNumEdges(), actual_hg.initialNumEdges());
+  ASSERT_EQ(expected_hg.initialNumPins(), actual_hg.initialNumPins());
+  for ( const HypernodeID& hn : expected_hg.nodes() ) {
+    ASSERT_EQ(expected_hg.nodeWeight(hn), actual_hg.nodeWeight(hn));
+  }
+  for ( const HyperedgeID& he : expected_hg.edges() ) {
+    ASSERT_EQ(expected_hg.edgeWeight(he), actual_hg.edgeWeight(he));
+    verifyPins(actual_hg, { he }, { std::set<HypernodeID>(
+      expected_hg.pins(he).begin(), expected_hg.pins(he).end()) });
+  }
+
+  // Released levels are spilled again (without rewriting the file)
+  actual.releaseLevel(0);
+  ASSERT_TRUE(actual.hierarchy[0].isSpilled());
+}
+
+TEST_F(AMemoryBudget, RemovesSpillFilesAfterPartitioning) {
+  context.coarsening.spill_fine_levels = true;
+  std::string spill_file;
+  {
+    UncoarseningData<TypeTraits> uncoarsening_data(false, hypergraph, context);
+    coarsen(uncoarsening_data);
+    spill_file = uncoarsening_data.hierarchy[0].spillFile();
+    ASSERT_TRUE(std::filesystem::exists(spill_file));
+  }
+  ASSERT_FALSE(std::filesystem::exists(spill_file));
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,202 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/two_hop_clustering.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+template<typename Hypergraph>
+class ATwoHopClustering : public Test {
+
+  using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
+
+ public:
+  ATwoHopClustering() :
+    context(),
+    hypergraph(),
+    cluster_ids(),
+    cluster_weight() {
+    context.partition.ignore_hyperedge_size_threshold = 1000;
+    context.coarsening.max_allowed_node_weight = 4;
+    context.coarsening.two_hop_degree_threshold = 4;
+  }
+
+  void construct(const HypernodeID num_nodes,
+                 const vec<vec<HypernodeID>>& edges,
+                 const vec<HyperedgeWeight>& edge_weights = { }) {
+    hypergraph = Hypergraph::Factory::construct(num_nodes, edges.size(), edges,
+      edge_weights.empty() ? nullptr : edge_weights.data());
+    hypergraph.setCommunityIDs(ds::Clustering(num_nodes, 0));
+    cluster_ids.resize(num_nodes);
+    cluster_weight.resize(num_nodes);
+    for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+      cluster_ids[hn] = hn;
+      cluster_weight[hn] = AtomicWeight(hypergraph.nodeWeight(hn));
+    }
+  }
+
+  HypernodeID cluster(const HypernodeID max_contracted_nodes = std::numeric_limits<HypernodeID>::max()) {
+    TwoHopClustering<Hypergraph> two_hop_clustering(context);
+    return two_hop_clustering.performClustering(
+      hypergraph, cluster_ids, cluster_weight, max_contracted_nodes);
+  }
+
+  void join(const HypernodeID hn, const HypernodeID rep) {
+    cluster_ids[hn] = rep;
+    cluster_weight[rep].fetch_add(hypergraph.nodeWeight(hn));
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+  parallel::scalable_vector<HypernodeID> cluster_ids;
+  parallel::scalable_vector<AtomicWeight> cluster_weight;
+};
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+using HypergraphTypes = ::testing::Types<ds::StaticHypergraph, ds::StaticGraph>;
+#else
+using HypergraphTypes = ::testing::Types<ds::StaticHypergraph>;
+#endif
+
+TYPED_TEST_SUITE(ATwoHopClustering, HypergraphTypes);
+
+// ! Star with center 0 and leaves 1, ..., 9. For hypergraphs, the star consists of
+// ! one large hyperedge and several small hyperedges attached to the center.
+template<typename Hypergraph>
+vec<vec<HypernodeID>> star() {
+  if constexpr ( Hypergraph::is_graph ) {
+    return { {0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {0, 6}, {0, 7}, {0, 8}, {0, 9} };
+  } else {
+    return { {0, 1, 2, 3, 4, 5, 6, 7, 8, 9} };
+  }
+}
+
+TYPED_TEST(ATwoHopClustering, ClustersLeavesOfTheSameNeighbor) {
+  this->context.coarsening.max_allowed_node_weight = 10;
+  this->construct(10, star<TypeParam>());
+  // For hypergraphs, the center is also a leaf of the hyperedge
+  const HypernodeID first_leaf = TypeParam::is_graph ? 1 : 0;
+  ASSERT_EQ(9 - first_leaf, this->cluster());
+  for ( HypernodeID hn = first_leaf; hn < 10; ++hn ) {
+    ASSERT_EQ(first_leaf, this->cluster_ids[hn]);
+  }
+  ASSERT_EQ(10 - first_leaf, this->cluster_weight[first_leaf]);
+}
+
+TYPED_TEST(ATwoHopClustering, RespectsMaximumAllowedNodeWeight) {
+  this->construct(10, star<TypeParam>());
+  const HypernodeID first_leaf = TypeParam::is_graph ? 1 : 0;
+  this->cluster();
+  for ( HypernodeID hn = first_leaf; hn < 10; ++hn ) {
+    ASSERT_EQ(first_leaf + 4 * ( ( hn - first_leaf ) / 4 ), this->cluster_ids[hn]);
+    ASSERT_LE(this->cluster_weight[this->cluster_ids[hn]], 4);
+  }
+}
+
+TYPED_TEST(ATwoHopClustering, StopsClusteringOnceTheContractionLimitIsReached) {
+  this->context.coarsening.max_allowed_node_weight = 10;
+  this->construct(10, star<TypeParam>());
+  ASSERT_EQ(3, this->cluster(3));
+  HypernodeID num_nodes = 0;
+  HypernodeWeight total_weight = 0;
+  for ( HypernodeID hn = 0; hn < 10; ++hn ) {
+    if ( this->cluster_ids[hn] == hn ) {
+      ++num_nodes;
+      total_weight += this->cluster_weight[hn];
+    }
+  }
+  ASSERT_EQ(7, num_nodes);
+  ASSERT_EQ(10, total_weight);
+}
+
+TYPED_TEST(ATwoHopClustering, DoesNotClusterVerticesOfDifferentCommunities) {
+  this->context.coarsening.max_allowed_node_weight = 10;
+  this->construct(10, star<TypeParam>());
+  this->hypergraph.setCommunityIDs(ds::Clustering { 0, 0, 1, 0, 1, 0, 1, 0, 1, 0 });
+  this->cluster();
+  for ( HypernodeID hn = 1; hn < 10; ++hn ) {
+    ASSERT_EQ(hn % 2 == 0 ? 2 : TypeParam::is_graph ? 1 : 0, this->cluster_ids[hn]);
+  }
+}
+
+TYPED_TEST(ATwoHopClustering, IgnoresVerticesThatAreAlreadyClustered) {
+  this->context.coarsening.max_allowed_node_weight = 10;
+  this->construct(10, star<TypeParam>());
+  this->join(2, 1);
+  this->join(4, 3);
+  this->cluster();
+  ASSERT_EQ(1, this->cluster_ids[1]);
+  ASSERT_EQ(1, this->cluster_ids[2]);
+  ASSERT_EQ(3, this->cluster_ids[3]);
+  ASSERT_EQ(3, this->cluster_ids[4]);
+  ASSERT_EQ(2, this->cluster_weight[1]);
+  ASSERT_EQ(2, this->cluster_weight[3]);
+  for ( HypernodeID hn = 5; hn < 10; ++hn ) {
+    ASSERT_EQ(TypeParam::is_graph ? 5 : 0, this->cluster_ids[hn]);
+  }
+}
+
+TYPED_TEST(ATwoHopClustering, ClustersVerticesWithCommonHighDegreeNeighbor) {
+  this->context.coarsening.max_allowed_node_weight = 10;
+  if constexpr ( TypeParam::is_graph ) {
+    // Vertices 1, ..., 4 are attached to the high-degree vertex 0 and to the low-degree
+    // vertex 5 (ties between neighbors are broken in favor of smaller IDs)
+    this->construct(6, { {0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 5}, {2, 5}, {3, 5}, {4, 5} });
+  } else {
+    // Vertices 1, ..., 4 are part of the large (heavy) hyperedge {0, 1, 2, 3, 4}
+    // and of one small hyperedge each
+    this->construct(6, { {0, 1, 2, 3, 4}, {1, 5}, {2, 5}, {3, 5}, {4, 5} }, { 2, 1, 1, 1, 1 });
+  }
+  this->cluster();
+  // For hypergraphs, vertex 0 is a leaf of the large hyperedge
+  const HypernodeID rep = TypeParam::is_graph ? 1 : 0;
+  for ( HypernodeID hn = 1; hn < 5; ++hn ) {
+    ASSERT_EQ(rep, this->cluster_ids[hn]);
+  }
+  ASSERT_EQ(5, this->cluster_ids[5]);
+}
+
+TYPED_TEST(ATwoHopClustering, DoesNotClusterVerticesWithCommonLowDegreeNeighbor) {
+  this->context.coarsening.max_allowed_node_weight = 10;
+  this->context.coarsening.two_hop_degree_threshold = 10;
+  if constexpr ( TypeParam::is_graph ) {
+    this->construct(6, { {0, 1}, {0, 2}, {0, 3}, {0, 4}, {1, 5}, {2, 5}, {3, 5}, {4, 5} });
+  } else {
+    this->construct(6, { {0, 1, 2, 3, 4}, {1, 5}, {2, 5}, {3, 5}, {4, 5} });
+  }
+  ASSERT_EQ(0, this->cluster());
+  for ( HypernodeID hn = 0; hn < 6; ++hn ) {
+    ASSERT_EQ(hn, this->cluster_ids[hn]);
+  }
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,211 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <random>
+#include <set>
+
+#include "gmock/gmock.h"
+
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/multilevel_vertex_pair_rater.h"
+#include "mt-kahypar/partition/coarsening/rating_kernels.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  // Ties are broken by vertex ID instead of a (shared) random coin flip such that the
+  // scalar and the vectorized rater must select the same contraction partner
+  class BestRatingPreferringSmallerID {
+   public:
+    static bool acceptRating(const RatingType tmp,
+                             const RatingType max_rating,
+                             const HypernodeID old_target,
+                             const HypernodeID new_target,
+                             const int,
+                             const kahypar::ds::FastResetFlagArray<>&) {
+      return max_rating < tmp || (max_rating == tmp && new_target < old_target);
+    }
+  };
+
+  using Rater = MultilevelVertexPairRater<HeavyEdgeScore, NoWeightPenalty, BestRatingPreferringSmallerID>;
+  using AtomicWeight = parallel::IntegralAtomicWrapper<HypernodeWeight>;
+
+  std::vector<rating::InstructionSet> supportedInstructionSets() {
+    std::vector<rating::InstructionSet> instruction_sets = { rating::InstructionSet::scalar };
+    if ( rating::supportedInstructionSet() == rating::InstructionSet::avx2 ||
+         rating::supportedInstructionSet() == rating::InstructionSet::avx512 ) {
+      instruction_sets.push_back(rating::InstructionSet::avx2);
+    }
+    if ( rating::supportedInstructionSet() == rating::InstructionSet::avx512 ) {
+      instruction_sets.push_back(rating::InstructionSet::avx512);
+    }
+    return instruction_sets;
+  }
+}
+
+TEST(ARatingKernel, GathersClusterIDs) {
+  std::mt19937 gen(42);
+  const HypernodeID num_nodes = 1000;
+  std::vector<HypernodeID> cluster_ids(num_nodes);
+  for ( HypernodeID& id : cluster_ids ) {
+    id = gen() % num_nodes;
+  }
+  // Size is not a multiple of the vector width => scalar remainder loop is also tested
+  std::vector<HypernodeID> pins(99);
+  for ( HypernodeID& pin : pins ) {
+    pin = gen() % num_nodes;
+  }
+
+  for ( const rating::InstructionSet instruction_set : supportedInstructionSets() ) {
+    std::vector<HypernodeID> representatives(pins.size());
+    rating::gatherClusterIDs(pins.data(), pins.size(), cluster_ids.data(),
+      num_nodes, representatives.data(), instruction_set);
+    for ( size_t i = 0; i < pins.size(); ++i ) {
+      ASSERT_EQ(cluster_ids[pins[i]], representatives[i]) << V(instruction_set) << V(i);
+    }
+  }
+}
+
+TEST(ARatingKernel, FiltersFeasibleCandidates) {
+  std::mt19937 gen(42);
+  std::vector<HypernodeWeight> weights(77);
+  for ( HypernodeWeight& weight : weights ) {
+    weight = gen() % 20;
+  }
+  const HypernodeWeight weight_u = 5;
+  const HypernodeWeight max_allowed_node_weight = 15;
+  std::vector<uint32_t> expected;
+  for ( size_t i = 0; i < weights.size(); ++i ) {
+    if ( weight_u + weights[i] <= max_allowed_node_weight ) {
+      expected.push_back(i);
+    }
+  }
+
+  for ( const rating::InstructionSet instruction_set : supportedInstructionSets() ) {
+    std::vector<uint32_t> feasible(weights.size());
+    const size_t num_feasible = rating::filterFeasibleCandidates(weights.data(),
+      weights.size(), weight_u, max_allowed_node_weight, feasible.data(), instruction_set);
+    feasible.resize(num_feasible);
+    ASSERT_EQ(expected, feasible) << V(instruction_set);
+  }
+}
+
+template<typename Hypergraph>
+class AVectorizedRater : public Test {
+ public:
+  AVectorizedRater() :
+    context(),
+    hypergraph(),
+    cluster_ids(),
+    cluster_weight(),
+    fixed_vertices() {
+    context.partition.k = 2;
+    context.partition.ignore_hyperedge_size_threshold = 1000;
+    context.coarsening.use_adaptive_edge_size = true;
+
+    std::mt19937 gen(42);
+    const HypernodeID num_nodes = 2000;
+    vec<vec<HypernodeID>> edges;
+    // Random edge weights make ties between ratings unlikely
+    vec<HyperedgeWeight> edge_weights;
+    for ( size_t i = 0; i < 10000; ++i ) {
+      const HypernodeID edge_size = Hypergraph::is_graph ? 2 : 2 + gen() % 100;
+      std::set<HypernodeID> pins;
+      while ( pins.size() < edge_size ) {
+        pins.insert(gen() % num_nodes);
+      }
+      edges.emplace_back(pins.begin(), pins.end());
+      edge_weights.push_back(1 + gen() % 1000000);
+    }
+    hypergraph = Hypergraph::Factory::construct(num_nodes, edges.size(), edges, edge_weights.data());
+    hypergraph.setCommunityIDs(ds::Clustering(num_nodes, 0));
+
+    // Simulates a partially coarsened hypergraph
+    cluster_ids.resize(num_nodes);
+    cluster_weight.resize(num_nodes);
+    for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+      cluster_ids[u] = gen() % 4 == 0 ? u : gen() % num_nodes;
+    }
+    for ( HypernodeID u = 0; u < num_nodes; ++u ) {
+      cluster_ids[u] = cluster_ids[cluster_ids[u]];
+      cluster_weight[u] = AtomicWeight(1 + gen() % 10);
+    }
+    fixed_vertices = ds::FixedVertexSupport<Hypergraph>(num_nodes, 2);
+  }
+
+  void verifyRatingsAreEqualToScalarRating(const size_t vertex_degree_sampling_threshold) {
+    const HypernodeWeight max_allowed_node_weight = 12;
+    context.coarsening.vertex_degree_sampling_threshold = vertex_degree_sampling_threshold;
+    context.coarsening.rating.vectorization_threshold = std::numeric_limits<size_t>::max();
+    Rater scalar_rater(hypergraph.initialNumNodes(), hypergraph.maxEdgeSize(), context);
+    context.coarsening.rating.vectorization_threshold = 1;
+    Rater vectorized_rater(hypergraph.initialNumNodes(), hypergraph.maxEdgeSize(), context);
+
+    for ( const rating::InstructionSet instruction_set : supportedInstructionSets() ) {
+      vectorized_rater.setInstructionSet(instruction_set);
+      for ( const HypernodeID& hn : hypergraph.nodes() ) {
+        if ( cluster_ids[hn] != hn ) continue;
+        const auto expected = scalar_rater.template rate<false>(hypergraph, hn,
+          cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+        const auto actual = vectorized_rater.template rate<false>(hypergraph, hn,
+          cluster_ids, cluster_weight, fixed_vertices, max_allowed_node_weight);
+        ASSERT_EQ(expected.valid, actual.valid) << V(instruction_set) << V(hn);
+        ASSERT_EQ(expected.target, actual.target) << V(instruction_set) << V(hn);
+        ASSERT_DOUBLE_EQ(expected.value, actual.value) << V(instruction_set) << V(hn);
+      }
+    }
+  }
+
+  Context context;
+  Hypergraph hypergraph;
+  parallel::scalable_vector<HypernodeID> cluster_ids;
+  parallel::scalable_vector<AtomicWeight> cluster_weight;
+  ds::FixedVertexSupport<Hypergraph> fixed_vertices;
+};
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+using HypergraphTypes = ::testing::Types<ds::StaticHypergraph, ds::StaticGraph>;
+#else
+using HypergraphTypes = ::testing::Types<ds::StaticHypergraph>;
+#endif
+
+TYPED_TEST_SUITE(AVectorizedRater, HypergraphTypes);
+
+TYPED_TEST(AVectorizedRater, ComputesSameRatingsAsScalarRating) {
+  this->verifyRatingsAreEqualToScalarRating(std::numeric_limits<size_t>::max());
+}
+
+TYPED_TEST(AVectorizedRater, ComputesSameRatingsAsScalarRatingWithVertexDegreeSampling) {
+  this->verifyRatingsAreEqualToScalarRating(50);
+}
+
+}  // namespace mt_kahypar
@@ -0,0 +1,223 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <map>
+
+#include "gmock/gmock.h"
+
+#include "tests/datastructures/hypergraph_fixtures.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/preprocessing/sparsification/identical_vertex_reduction.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+  using Factory = typename Hypergraph::Factory;
+}
+
+class AnIdenticalVertexReduction : public ds::HypergraphFixture<Hypergraph> {
+
+ using Base = ds::HypergraphFixture<Hypergraph>;
+
+ public:
+  AnIdenticalVertexReduction() :
+    Base(),
+    context() {
+    context.partition.k = 2;
+    context.partition.objective = Objective::km1;
+    context.preprocessing.use_identical_vertex_reduction = true;
+    context.coarsening.max_allowed_node_weight = std::numeric_limits<HypernodeWeight>::max() / 2;
+  }
+
+  void verifyProjection(Hypergraph& original_hg) {
+    IdenticalVertexReduction<TypeTraits> reduction(context);
+    ASSERT_TRUE(reduction.isApplicable(original_hg));
+    Hypergraph reduced_hg;
+    ASSERT_TRUE(reduction.reduce(original_hg, reduced_hg));
+    ASSERT_EQ(original_hg.initialNumNodes() - reduction.numRemovedNodes(), reduced_hg.initialNumNodes());
+    ASSERT_EQ(original_hg.totalWeight(), reduced_hg.totalWeight());
+
+    // Partition the reduced hypergraph and project it to the original one
+    PartitionedHypergraph reduced_phg(context.partition.k, reduced_hg, parallel_tag_t { });
+    for ( const HypernodeID& hn : reduced_hg.nodes() ) {
+      reduced_phg.setOnlyNodePart(hn, (hn * 7 + 3) % 5 < 2 ? 0 : 1);
+    }
+    reduced_phg.initializePartition();
+    PartitionedHypergraph original_phg(context.partition.k, original_hg, parallel_tag_t { });
+    reduction.projectPartition(reduced_phg, original_phg);
+
+    for ( PartitionID block = 0; block < context.partition.k; ++block ) {
+      ASSERT_EQ(reduced_phg.partWeight(block), original_phg.partWeight(block));
+    }
+    ASSERT_EQ(metrics::quality(reduced_phg, Objective::km1),
+              metrics::quality(original_phg, Objective::km1));
+    ASSERT_EQ(metrics::quality(reduced_phg, Objective::cut),
+              metrics::quality(original_phg, Objective::cut));
+  }
+
+  using Base::hypergraph;
+  Context context;
+};
+
+TEST_F(AnIdenticalVertexReduction, IsNotApplicableIfDisabled) {
+  context.preprocessing.use_identical_vertex_reduction = false;
+  IdenticalVertexReduction<TypeTraits> reduction(context);
+  ASSERT_FALSE(reduction.isApplicable(hypergraph));
+}
+
+TEST_F(AnIdenticalVertexReduction, CollapsesTwinsAndIdenticalNets) {
+  Hypergraph hg = Factory::construct(6, 5, { {0, 1, 2}, {0, 1, 3}, {3, 4}, {4, 3}, {4, 5} });
+  IdenticalVertexReduction<TypeTraits> reduction(context);
+  Hypergraph reduced_hg;
+  ASSERT_TRUE(reduction.reduce(hg, reduced_hg));
+
+  ASSERT_EQ(1, reduction.numRemovedNodes());
+  ASSERT_EQ(1, reduction.numRemovedNets());
+  ASSERT_EQ(5, reduced_hg.initialNumNodes());
+  ASSERT_EQ(4, reduced_hg.initialNumEdges());
+  ASSERT_EQ(2, reduced_hg.nodeWeight(0));
+  ASSERT_EQ(1, reduced_hg.nodeWeight(1));
+  verifyPins(reduced_hg, { 0, 1, 2, 3 }, { {0, 1}, {0, 2}, {2, 3}, {3, 4} });
+  ASSERT_EQ(1, reduced_hg.edgeWeight(0));
+  ASSERT_EQ(1, reduced_hg.edgeWeight(1));
+  ASSERT_EQ(2, reduced_hg.edgeWeight(2));
+  ASSERT_EQ(1, reduced_hg.edgeWeight(3));
+}
+
+TEST_F(AnIdenticalVertexReduction, RemovesNetsThatOnlyContainTwins) {
+  Hypergraph hg = Factory::construct(4, 3, { {0, 1}, {0, 1, 2}, {2, 3} });
+  IdenticalVertexReduction<TypeTraits> reduction(context);
+  Hypergraph reduced_hg;
+  ASSERT_TRUE(reduction.reduce(hg, reduced_hg));
+
+  ASSERT_EQ(3, reduced_hg.initialNumNodes());
+  ASSERT_EQ(2, reduced_hg.initialNumEdges());
+  verifyPins(reduced_hg, { 0, 1 }, { {0, 1}, {1, 2} });
+}
+
+TEST_F(AnIdenticalVertexReduction, PreservesNumberOfRemovedHyperedges) {
+  Hypergraph hg = Factory::construct(4, 3, { {0, 1}, {0, 1, 2}, {2, 3} });
+  hg.setNumRemovedHyperedges(2);
+  IdenticalVertexReduction<TypeTraits> reduction(context);
+  Hypergraph reduced_hg;
+  ASSERT_TRUE(reduction.reduce(hg, reduced_hg));
+  ASSERT_EQ(2, reduced_hg.numRemovedHyperedges());
+}
+
+TEST_F(AnIdenticalVertexReduction, DoesNotExceedMaximumAllowedNodeWeight) {
+  context.coarsening.max_allowed_node_weight = 2;
+  Hypergraph hg = Factory::construct(5, 2, { {0, 1, 2, 3, 4}, {0, 1, 2, 3} });
+  IdenticalVertexReduction<TypeTraits> reduction(context);
+  Hypergraph reduced_hg;
+  ASSERT_TRUE(reduction.reduce(hg, reduced_hg));
+
+  ASSERT_EQ(3, reduced_hg.initialNumNodes());
+  for ( const HypernodeID& hn : reduced_hg.nodes() ) {
+    ASSERT_LE(reduced_hg.nodeWeight(hn), 2);
+  }
+}
+
+TEST_F(AnIdenticalVertexReduction, DoesNotReduceIfThereAreNoIdenticalVerticesAndNets) {
+  Hypergraph hg = Factory::construct(4, 3, { {0, 1}, {1, 2}, {2, 3} });
+  IdenticalVertexReduction<TypeTraits> reduction(context);
+  Hypergraph reduced_hg;
+  ASSERT_FALSE(reduction.reduce(hg, reduced_hg));
+  ASSERT_EQ(0, reduction.numRemovedNodes());
+  ASSERT_EQ(0, reduction.numRemovedNets());
+}
+
+TEST_F(AnIdenticalVertexReduction, PacksTwinsGreedilyIntoClasses) {
+  // Vertices 0, 1, 2 and 3 are twins => classes { 0, 1, 2 } and { 3 }
+  context.coarsening.max_allowed_node_weight = 3;
+  Hypergraph hg = Factory::construct(5, 2, { {0, 1, 2, 3, 4}, {0, 1, 2, 3} });
+  IdenticalVertexReduction<TypeTraits> reduction(context);
+  Hypergraph reduced_hg;
+  ASSERT_TRUE(reduction.reduce(hg, reduced_hg));
+
+  ASSERT_EQ(3, reduced_hg.initialNumNodes());
+  ASSERT_EQ(3, reduced_hg.nodeWeight(0));
+  ASSERT_EQ(1, reduced_hg.nodeWeight(1));
+  ASSERT_EQ(1, reduced_hg.nodeWeight(2));
+}
+
+TEST_F(AnIdenticalVertexReduction, ProjectsPartitionToTheOriginalHypergraph) {
+  verifyProjection(hypergraph);
+}
+
+TEST_F(AnIdenticalVertexReduction, ProjectsPartitionOfLargerInstance) {
+  Hypergraph ibm01 = io::readInputFile<Hypergraph>(
+    "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  verifyProjection(ibm01);
+}
+
+#ifdef KAHYPAR_ENABLE_GRAPH_PARTITIONING_FEATURES
+TEST_F(AnIdenticalVertexReduction, CollapsesNodesWithIdenticalNeighborsInGraphs) {
+  using Graph = typename StaticGraphTypeTraits::Hypergraph;
+  using PartitionedGraph = typename StaticGraphTypeTraits::PartitionedHypergraph;
+  context.partition.objective = Objective::cut;
+  // Nodes 0 and 1 are twins, since both are adjacent to 2 and 3
+  Graph graph = Graph::Factory::construct(5, 5, { {0, 2}, {0, 3}, {1, 2}, {1, 3}, {3, 4} });
+  IdenticalVertexReduction<StaticGraphTypeTraits> reduction(context);
+  ASSERT_TRUE(reduction.isApplicable(graph));
+  Graph reduced_graph;
+  ASSERT_TRUE(reduction.reduce(graph, reduced_graph));
+
+  // Edges {0,2} and {1,2} as well as {0,3} and {1,3} are merged
+  ASSERT_EQ(1, reduction.numRemovedNodes());
+  ASSERT_EQ(2, reduction.numRemovedNets());
+  ASSERT_EQ(4, reduced_graph.initialNumNodes());
+  ASSERT_EQ(6, reduced_graph.initialNumEdges());
+  ASSERT_EQ(2, reduced_graph.nodeWeight(0));
+  std::map<std::pair<HypernodeID, HypernodeID>, HyperedgeWeight> edge_weights;
+  for ( const HyperedgeID& he : reduced_graph.edges() ) {
+    edge_weights[{ reduced_graph.edgeSource(he), reduced_graph.edgeTarget(he) }] = reduced_graph.edgeWeight(he);
+  }
+  const std::map<std::pair<HypernodeID, HypernodeID>, HyperedgeWeight> expected_edge_weights = {
+    { { 0, 1 }, 2 }, { { 1, 0 }, 2 }, { { 0, 2 }, 2 }, { { 2, 0 }, 2 }, { { 2, 3 }, 1 }, { { 3, 2 }, 1 } };
+  ASSERT_EQ(expected_edge_weights, edge_weights);
+
+  PartitionedGraph reduced_phg(context.partition.k, reduced_graph, parallel_tag_t { });
+  for ( const HypernodeID& hn : reduced_graph.nodes() ) {
+    reduced_phg.setOnlyNodePart(hn, hn % 2);
+  }
+  reduced_phg.initializePartition();
+  PartitionedGraph original_phg(context.partition.k, graph, parallel_tag_t { });
+  reduction.projectPartition(reduced_phg, original_phg);
+  ASSERT_EQ(original_phg.partID(0), original_phg.partID(1));
+  ASSERT_EQ(metrics::quality(reduced_phg, Objective::cut),
+            metrics::quality(original_phg, Objective::cut));
+}
+#endif
+
+}  // namespace mt_kahypar
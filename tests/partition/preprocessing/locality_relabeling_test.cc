@@ -0,0 +1,252 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include "gmock/gmock.h"
+
+#include "tests/datastructures/hypergraph_fixtures.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/metrics.h"
+#include "mt-kahypar/partition/preprocessing/relabeling/locality_relabeling.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+
+using ::testing::Test;
+
+namespace mt_kahypar {
+
+namespace {
+  using TypeTraits = StaticHypergraphTypeTraits;
+  using Hypergraph = typename TypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename TypeTraits::PartitionedHypergraph;
+}
+
+class ALocalityRelabeling : public ds::HypergraphFixture<Hypergraph> {
+
+ using Base = ds::HypergraphFixture<Hypergraph>;
+
+ public:
+  ALocalityRelabeling() :
+    Base(),
+    context() {
+    context.partition.k = 2;
+    context.partition.objective = Objective::km1;
+  }
+
+  void verifyRelabeling(Hypergraph& original_hg, const RelabelingType type) {
+    context.preprocessing.relabeling = type;
+    LocalityRelabeling<TypeTraits> relabeling(context);
+    ASSERT_TRUE(relabeling.isApplicable(original_hg));
+    Hypergraph relabeled_hg = relabeling.relabel(original_hg);
+
+    ASSERT_EQ(original_hg.initialNumNodes(), relabeled_hg.initialNumNodes());
+    ASSERT_EQ(original_hg.initialNumEdges(), relabeled_hg.initialNumEdges());
+    ASSERT_EQ(original_hg.initialNumPins(), relabeled_hg.initialNumPins());
+    ASSERT_EQ(original_hg.totalWeight(), relabeled_hg.totalWeight());
+
+    // Partition the relabeled hypergraph and project it to the original one
+    PartitionedHypergraph relabeled_phg(context.partition.k, relabeled_hg, parallel_tag_t { });
+    for ( const HypernodeID& hn : relabeled_hg.nodes() ) {
+      relabeled_phg.setOnlyNodePart(hn, (hn * 7 + 3) % 5 < 2 ? 0 : 1);
+    }
+    relabeled_phg.initializePartition();
+    PartitionedHypergraph original_phg(context.partition.k, original_hg, parallel_tag_t { });
+    relabeling.projectPartition(relabeled_phg, original_phg);
+
+    for ( PartitionID block = 0; block < context.partition.k; ++block ) {
+      ASSERT_EQ(relabeled_phg.partWeight(block), original_phg.partWeight(block));
+    }
+    ASSERT_EQ(metrics::quality(relabeled_phg, Objective::km1),
+              metrics::quality(original_phg, Objective::km1));
+    ASSERT_EQ(metrics::quality(relabeled_phg, Objective::cut),
+              metrics::quality(original_phg, Objective::cut));
+  }
+
+  // Sequential BFS (or RCM) order, which the parallel level-synchronous BFS must reproduce
+  static vec<HypernodeID> sequentialBFSOrder(const Hypergraph& hg, const bool rcm) {
+    auto compare_degree = [&](const HypernodeID& lhs, const HypernodeID& rhs) {
+      return hg.nodeDegree(lhs) < hg.nodeDegree(rhs) ||
+        (hg.nodeDegree(lhs) == hg.nodeDegree(rhs) && lhs < rhs);
+    };
+    vec<HypernodeID> start_nodes(hg.initialNumNodes());
+    std::iota(start_nodes.begin(), start_nodes.end(), ID(0));
+    if ( rcm ) {
+      std::sort(start_nodes.begin(), start_nodes.end(), compare_degree);
+    }
+    vec<bool> visited_node(hg.initialNumNodes(), false);
+    vec<bool> visited_edge(hg.initialNumEdges(), false);
+    vec<HypernodeID> order;
+    size_t head = 0;
+    for ( const HypernodeID& start : start_nodes ) {
+      if ( visited_node[start] ) continue;
+      visited_node[start] = true;
+      order.push_back(start);
+      while ( head < order.size() ) {
+        const HypernodeID u = order[head++];
+        const size_t first_neighbor = order.size();
+        for ( const HyperedgeID& he : hg.incidentEdges(u) ) {
+          if ( visited_edge[he] ) continue;
+          visited_edge[he] = true;
+          for ( const HypernodeID& pin : hg.pins(he) ) {
+            if ( !visited_node[pin] ) {
+              visited_node[pin] = true;
+              order.push_back(pin);
+            }
+          }
+        }
+        if ( rcm ) {
+          std::sort(order.begin() + first_neighbor, order.end(), compare_degree);
+        }
+      }
+    }
+    if ( rcm ) {
+      std::reverse(order.begin(), order.end());
+    }
+    return order;
+  }
+
+  void verifyOrderIsEqualToSequentialBFS(const Hypergraph& original_hg, const RelabelingType type) {
+    context.preprocessing.relabeling = type;
+    LocalityRelabeling<TypeTraits> relabeling(context);
+    Hypergraph relabeled_hg = relabeling.relabel(original_hg);
+
+    const vec<HypernodeID> order = sequentialBFSOrder(original_hg, type == RelabelingType::rcm);
+    vec<HypernodeID> node_mapping(original_hg.initialNumNodes());
+    for ( HypernodeID pos = 0; pos < order.size(); ++pos ) {
+      node_mapping[order[pos]] = pos;
+    }
+    vec<std::pair<HypernodeID, HyperedgeID>> edge_order;
+    for ( const HyperedgeID& he : original_hg.edges() ) {
+      HypernodeID key = kInvalidHypernode;
+      for ( const HypernodeID& pin : original_hg.pins(he) ) {
+        key = std::min(key, node_mapping[pin]);
+      }
+      edge_order.emplace_back(key, he);
+    }
+    std::sort(edge_order.begin(), edge_order.end());
+    for ( HyperedgeID new_he = 0; new_he < edge_order.size(); ++new_he ) {
+      vec<HypernodeID> expected_pins;
+      for ( const HypernodeID& pin : original_hg.pins(edge_order[new_he].second) ) {
+        expected_pins.push_back(node_mapping[pin]);
+      }
+      vec<HypernodeID> actual_pins;
+      for ( const HypernodeID& pin : relabeled_hg.pins(new_he) ) {
+        actual_pins.push_back(pin);
+      }
+      ASSERT_EQ(expected_pins, actual_pins) << V(new_he);
+    }
+  }
+
+  using Base::hypergraph;
+  Context context;
+};
+
+TEST_F(ALocalityRelabeling, IsNotApplicableIfDisabled) {
+  context.preprocessing.relabeling = RelabelingType::none;
+  LocalityRelabeling<TypeTraits> relabeling(context);
+  ASSERT_FALSE(relabeling.isApplicable(hypergraph));
+}
+
+TEST_F(ALocalityRelabeling, PreservesStructureWithBFSOrder) {
+  verifyRelabeling(hypergraph, RelabelingType::bfs);
+}
+
+TEST_F(ALocalityRelabeling, PreservesStructureWithRCMOrder) {
+  verifyRelabeling(hypergraph, RelabelingType::rcm);
+}
+
+TEST_F(ALocalityRelabeling, PreservesStructureWithDegreeOrder) {
+  verifyRelabeling(hypergraph, RelabelingType::degree);
+}
+
+TEST_F(ALocalityRelabeling, SortsNodesByDecreasingDegree) {
+  context.preprocessing.relabeling = RelabelingType::degree;
+  LocalityRelabeling<TypeTraits> relabeling(context);
+  Hypergraph relabeled_hg = relabeling.relabel(hypergraph);
+  for ( HypernodeID hn = 1; hn < relabeled_hg.initialNumNodes(); ++hn ) {
+    ASSERT_GE(relabeled_hg.nodeDegree(hn - 1), relabeled_hg.nodeDegree(hn));
+  }
+}
+
+TEST_F(ALocalityRelabeling, PreservesNumberOfRemovedHyperedges) {
+  context.preprocessing.relabeling = RelabelingType::bfs;
+  hypergraph.setNumRemovedHyperedges(3);
+  LocalityRelabeling<TypeTraits> relabeling(context);
+  Hypergraph relabeled_hg = relabeling.relabel(hypergraph);
+  ASSERT_EQ(3, relabeled_hg.numRemovedHyperedges());
+}
+
+TEST_F(ALocalityRelabeling, PreservesStructureOfLargerInstance) {
+  Hypergraph ibm01 = io::readInputFile<Hypergraph>(
+    "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  verifyRelabeling(ibm01, RelabelingType::rcm);
+  ASSERT_LE(LocalityRelabeling<TypeTraits>::averageEdgeSpan(
+    LocalityRelabeling<TypeTraits>(context).relabel(ibm01)),
+    LocalityRelabeling<TypeTraits>::averageEdgeSpan(ibm01));
+}
+
+TEST_F(ALocalityRelabeling, ComputesSameOrderAsSequentialBFS) {
+  Hypergraph ibm01 = io::readInputFile<Hypergraph>(
+    "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  verifyOrderIsEqualToSequentialBFS(ibm01, RelabelingType::bfs);
+}
+
+TEST_F(ALocalityRelabeling, ComputesSameOrderAsSequentialRCM) {
+  Hypergraph ibm01 = io::readInputFile<Hypergraph>(
+    "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  verifyOrderIsEqualToSequentialBFS(ibm01, RelabelingType::rcm);
+}
+
+TEST_F(ALocalityRelabeling, RestoresInputHypergraph) {
+  Hypergraph ibm01 = io::readInputFile<Hypergraph>(
+    "../tests/instances/ibm01.hgr", FileFormat::hMetis, true);
+  context.preprocessing.relabeling = RelabelingType::rcm;
+  LocalityRelabeling<TypeTraits> relabeling(context);
+  Hypergraph relabeled_hg = relabeling.relabel(ibm01);
+  ASSERT_TRUE(relabeling.isRestorable());
+  Hypergraph restored_hg = relabeling.restore(relabeled_hg);
+
+  ASSERT_EQ(ibm01.initialNumNodes(), restored_hg.initialNumNodes());
+  ASSERT_EQ(ibm01.initialNumEdges(), restored_hg.initialNumEdges());
+  ASSERT_EQ(ibm01.numRemovedHyperedges(), restored_hg.numRemovedHyperedges());
+  for ( const HypernodeID& hn : ibm01.nodes() ) {
+    ASSERT_EQ(ibm01.nodeWeight(hn), restored_hg.nodeWeight(hn));
+    ASSERT_EQ(ibm01.nodeDegree(hn), restored_hg.nodeDegree(hn));
+  }
+  for ( const HyperedgeID& he : ibm01.edges() ) {
+    ASSERT_EQ(ibm01.edgeWeight(he), restored_hg.edgeWeight(he));
+    vec<HypernodeID> expected_pins;
+    for ( const HypernodeID& pin : ibm01.pins(he) ) {
+      expected_pins.push_back(pin);
+    }
+    vec<HypernodeID> actual_pins;
+    for ( const HypernodeID& pin : restored_hg.pins(he) ) {
+      actual_pins.push_back(pin);
+    }
+    ASSERT_EQ(expected_pins, actual_pins) << V(he);
+  }
+}
+
+}  // namespace mt_kahypar
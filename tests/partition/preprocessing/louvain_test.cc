@@ -203,4 +203,82 @@ TEST_F(ALouvain, KarateClubTest) {
             metrics::modularity(*karate_club_graph, expected_comm));
 }
 
+TEST_F(ALouvain, PredictsToSkipCommunityDetectionOnAGrid) {
+  const HypernodeID n = 20;
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID row = 0; row < n; ++row ) {
+    for ( HypernodeID col = 0; col < n; ++col ) {
+      if ( col + 1 < n ) {
+        edges.push_back({ row * n + col, row * n + col + 1 });
+      }
+      if ( row + 1 < n ) {
+        edges.push_back({ row * n + col, (row + 1) * n + col });
+      }
+    }
+  }
+  Hypergraph grid = Hypergraph::Factory::construct(n * n, edges.size(), edges);
+  const SampledGraphStructure structure = sampleGraphStructure(grid, context);
+  ASSERT_DOUBLE_EQ(0.0, structure.clustering_coefficient);
+  ASSERT_LE(structure.degree_variation, MESH_DEGREE_VARIATION);
+  ASSERT_EQ(CommunityDetectionDecision::skip, predictFromSample(structure, context));
+}
+
+TEST_F(ALouvain, SamplesNeighborsOfHighDegreeVerticesRandomly) {
+  // Each vertex of a clique has more than MAX_SAMPLED_NEIGHBORS neighbors,
+  // but every sampled pair of neighbors is connected
+  const HypernodeID n = 40;
+  vec<vec<HypernodeID>> edges;
+  for ( HypernodeID u = 0; u < n; ++u ) {
+    for ( HypernodeID v = u + 1; v < n; ++v ) {
+      edges.push_back({ u, v });
+    }
+  }
+  Hypergraph clique = Hypergraph::Factory::construct(n, edges.size(), edges);
+  const SampledGraphStructure structure = sampleGraphStructure(clique, context);
+  ASSERT_DOUBLE_EQ(1.0, structure.clustering_coefficient);
+  ASSERT_DOUBLE_EQ(0.0, structure.degree_variation);
+}
+
+TEST_F(ALouvain, PredictsToRunCommunityDetectionOnKarateClub) {
+  const SampledGraphStructure structure = sampleGraphStructure(karate_club_hg, context);
+  ASSERT_GT(structure.clustering_coefficient, context.preprocessing.community_detection.min_clustering_coefficient);
+  ASSERT_GT(structure.num_scanned_pins, UL(0));
+  ASSERT_EQ(CommunityDetectionDecision::full, predictFromSample(structure, context));
+}
+
+TEST_F(ALouvain, SkipsCommunityDetectionIfFirstRoundModularityGainIsSmall) {
+  context.preprocessing.community_detection.min_modularity_gain = 1.0;
+  CommunityDetectionDecision decision = CommunityDetectionDecision::full;
+  double estimated_time_saved = -1.0;
+  run_adaptive_parallel_louvain(*karate_club_graph, context, decision, estimated_time_saved);
+  ASSERT_EQ(CommunityDetectionDecision::skip, decision);
+  ASSERT_GE(estimated_time_saved, 0.0);
+}
+
+TEST_F(ALouvain, StopsAfterFirstLevelIfFirstRoundModularityGainIsModerate) {
+  context.preprocessing.community_detection.min_modularity_gain = 0.0;
+  context.preprocessing.community_detection.min_modularity_gain_for_contraction = 1.0;
+  CommunityDetectionDecision decision = CommunityDetectionDecision::full;
+  double estimated_time_saved = -1.0;
+  ds::Clustering communities = run_adaptive_parallel_louvain(
+    *karate_club_graph, context, decision, estimated_time_saved);
+  ASSERT_EQ(CommunityDetectionDecision::single_level, decision);
+  ASSERT_GT(estimated_time_saved, 0.0);
+  ASSERT_EQ(karate_club_graph->numNodes(), communities.size());
+}
+
+TEST_F(ALouvain, RunsAllLevelsIfFirstRoundModularityGainIsLarge) {
+  context.preprocessing.community_detection.min_modularity_gain = 0.0;
+  context.preprocessing.community_detection.min_modularity_gain_for_contraction = 0.0;
+  CommunityDetectionDecision decision = CommunityDetectionDecision::skip;
+  double estimated_time_saved = -1.0;
+  ds::Clustering communities = run_adaptive_parallel_louvain(
+    *karate_club_graph, context, decision, estimated_time_saved);
+  ASSERT_EQ(CommunityDetectionDecision::full, decision);
+  ASSERT_EQ(0.0, estimated_time_saved);
+  karate_club_graph = std::make_unique<Graph<Hypergraph>>(
+    karate_club_hg, LouvainEdgeWeight::uniform, true);
+  ASSERT_GT(metrics::modularity(*karate_club_graph, communities), 0.3);
+}
+
 }  // namespace mt_kahypar
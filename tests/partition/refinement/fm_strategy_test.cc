@@ -41,8 +41,8 @@ namespace mt_kahypar {
 namespace {
   using Hypergraph = typename StaticHypergraphTypeTraits::Hypergraph;
   using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
-  using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::MaxHeap<Gain, PartitionID> >;
-  using VertexPriorityQueue = ds::MaxHeap<Gain, HypernodeID>;    // these need external handles
+  using BlockPriorityQueue = ds::ExclusiveHandleHeap< ds::BucketOrHeapQueue<Gain, PartitionID> >;
+  using VertexPriorityQueue = ds::BucketOrHeapQueue<Gain, HypernodeID>;    // these need external handles
 }
 
 
@@ -25,6 +25,7 @@
  ******************************************************************************/
 
 #include <atomic>
+#include <numeric>
 #include "gmock/gmock.h"
 
 #include <tbb/parallel_for.h>
@@ -363,6 +364,14 @@ class AGainCache : public Test {
   }
 
   bool supportsAdjacentBlocks() const {
+    return GainCache::TYPE == GainPolicy::steiner_tree ||
+      GainCache::TYPE == GainPolicy::steiner_tree_for_graphs ||
+      GainCache::TYPE == GainPolicy::sparse_km1;
+  }
+
+  // The delta gain cache of the sparse gain cache returns
+  // the adjacent blocks of the shared gain cache
+  bool supportsAdjacentBlocksOfDeltaGainCache() const {
     return GainCache::TYPE == GainPolicy::steiner_tree ||
       GainCache::TYPE == GainPolicy::steiner_tree_for_graphs;
   }
@@ -391,7 +400,7 @@ class AGainCache : public Test {
   }
 
   void verifyAdjacentBlocksOfDeltaGainCache() {
-    if ( supportsAdjacentBlocks() ) {
+    if ( supportsAdjacentBlocksOfDeltaGainCache() ) {
       for ( const HypernodeID& hn : delta_phg->nodes() ) {
         ds::Bitset adjacent_blocks(delta_phg->k());
         ds::StaticBitset adjacent_blocks_view(
@@ -432,6 +441,7 @@ class AGainCache : public Test {
 
 typedef ::testing::Types<TestConfig<StaticHypergraphTypeTraits, Km1GainTypes>,
                          TestConfig<StaticHypergraphTypeTraits, CutGainTypes>
+                         ENABLE_LARGE_K(COMMA TestConfig<StaticHypergraphTypeTraits COMMA SparseKm1GainTypes>)
                          ENABLE_SOED(COMMA TestConfig<StaticHypergraphTypeTraits COMMA SoedGainTypes>)
                          ENABLE_STEINER_TREE(COMMA TestConfig<StaticHypergraphTypeTraits COMMA SteinerTreeGainTypes>)
                          ENABLE_GRAPHS(COMMA TestConfig<StaticGraphTypeTraits COMMA CutGainForGraphsTypes>)
@@ -444,6 +454,7 @@ typedef ::testing::Types<TestConfig<StaticHypergraphTypeTraits, Km1GainTypes>,
                          ENABLE_HIGHEST_QUALITY_FOR_GRAPHS(ENABLE_STEINER_TREE(COMMA TestConfig<DynamicGraphTypeTraits COMMA SteinerTreeForGraphsTypes>))
                          ENABLE_LARGE_K(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA Km1GainTypes>)
                          ENABLE_LARGE_K(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA CutGainTypes>)
+                         ENABLE_LARGE_K(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA SparseKm1GainTypes>)
                          ENABLE_LARGE_K(ENABLE_SOED(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA SoedGainTypes>))
                          ENABLE_LARGE_K(ENABLE_STEINER_TREE(COMMA TestConfig<LargeKHypergraphTypeTraits COMMA SteinerTreeGainTypes>))> TestConfigs;
 
@@ -498,6 +509,74 @@ TYPED_TEST(AGainCache, ComparesGainsWithAttributedGains) {
   }
 }
 
+#ifdef KAHYPAR_ENABLE_LARGE_K_PARTITIONING_FEATURES
+
+TEST(ASparseKm1GainCache, EnumeratesAdjacentBlocksStoredInTheExternalHashTable) {
+  using Hypergraph = typename LargeKHypergraphTypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename LargeKHypergraphTypeTraits::PartitionedHypergraph;
+  // Each pin of the net is assigned to a different block. Since the net contains more than
+  // c + 1 pins, not all adjacent blocks of a node fit into its entries.
+  const PartitionID k = 20;
+  vec<HypernodeID> pins(k);
+  std::iota(pins.begin(), pins.end(), 0);
+  Hypergraph hypergraph = Hypergraph::Factory::construct(k, 1, { pins });
+  PartitionedHypergraph partitioned_hg(k, hypergraph, parallel_tag_t { });
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    partitioned_hg.setOnlyNodePart(hn, hn);
+  }
+  partitioned_hg.initializePartition();
+
+  SparseKm1GainCache gain_cache;
+  gain_cache.initializeGainCache(partitioned_hg);
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    vec<bool> contained(k, false);
+    for ( const PartitionID& block : gain_cache.adjacentBlocks(hn) ) {
+      ASSERT_FALSE(contained[block]);
+      contained[block] = true;
+    }
+    for ( PartitionID block = 0; block < k; ++block ) {
+      ASSERT_TRUE(contained[block]) << V(hn) << V(block);
+      ASSERT_EQ(1, gain_cache.benefitTerm(hn, block));
+    }
+  }
+}
+
+TEST(ASparseKm1GainCache, EnumeratesAdjacentBlocksAfterRemovingBlocksFromTheExternalHashTable) {
+  using Hypergraph = typename LargeKHypergraphTypeTraits::Hypergraph;
+  using PartitionedHypergraph = typename LargeKHypergraphTypeTraits::PartitionedHypergraph;
+  const PartitionID k = 20;
+  vec<HypernodeID> pins(k);
+  std::iota(pins.begin(), pins.end(), 0);
+  Hypergraph hypergraph = Hypergraph::Factory::construct(k, 1, { pins });
+  PartitionedHypergraph partitioned_hg(k, hypergraph, parallel_tag_t { });
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    partitioned_hg.setOnlyNodePart(hn, hn);
+  }
+  partitioned_hg.initializePartition();
+
+  SparseKm1GainCache gain_cache;
+  gain_cache.initializeGainCache(partitioned_hg);
+  // Moving the nodes of the odd blocks to block 0 removes the odd blocks
+  // from the entries and the external hash table of all nodes
+  for ( PartitionID block = 1; block < k; block += 2 ) {
+    partitioned_hg.changeNodePart(gain_cache, block, block, 0);
+  }
+  for ( const HypernodeID& hn : partitioned_hg.nodes() ) {
+    vec<bool> contained(k, false);
+    for ( const PartitionID& block : gain_cache.adjacentBlocks(hn) ) {
+      ASSERT_FALSE(contained[block]);
+      contained[block] = true;
+    }
+    for ( PartitionID block = 0; block < k; ++block ) {
+      const bool is_adjacent = block % 2 == 0;
+      ASSERT_EQ(is_adjacent, contained[block]) << V(hn) << V(block);
+      ASSERT_EQ(is_adjacent ? 1 : 0, gain_cache.benefitTerm(hn, block));
+    }
+  }
+}
+
+#endif
+
 #ifdef KAHYPAR_ENABLE_HIGHEST_QUALITY_FEATURES
 
 TYPED_TEST(AGainCache, HasCorrectGainsAfterNLevelUncontraction) {
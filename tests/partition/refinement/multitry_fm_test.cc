@@ -187,6 +187,19 @@ TYPED_TEST(MultiTryFMTest, DoesNotWorsenSolutionQuality) {
   ASSERT_LE(this->metrics.quality, objective_before);
 }
 
+TYPED_TEST(MultiTryFMTest, AbortsIfGlobalTimeLimitIsExceeded) {
+  this->context.partition.time_limit = 1;
+  this->context.start_time -= std::chrono::seconds(2);
+  ASSERT_TRUE(this->context.isTimeLimitExceeded());
+  HyperedgeWeight objective_before = metrics::quality(this->partitioned_hypergraph, this->context.partition.objective);
+  mt_kahypar_partitioned_hypergraph_t phg = utils::partitioned_hg_cast(this->partitioned_hypergraph);
+  this->refiner->refine(phg, {}, this->metrics, std::numeric_limits<double>::max());
+  ASSERT_LE(this->metrics.quality, objective_before);
+  ASSERT_EQ(metrics::quality(this->partitioned_hypergraph, this->context.partition.objective),
+            this->metrics.quality);
+  ASSERT_LE(this->metrics.imbalance, this->context.partition.epsilon);
+}
+
 TYPED_TEST(MultiTryFMTest, AlsoWorksWithNonDefaultFeatures) {
   this->context.refinement.fm.obey_minimal_parallelism = true;
   this->context.refinement.fm.rollback_parallel = false;
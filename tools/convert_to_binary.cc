@@ -0,0 +1,91 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+int main(int argc, char* argv[]) {
+  std::string input_filename;
+  std::string output_filename;
+  FileFormat format = FileFormat::hMetis;
+
+  po::options_description options("Options");
+  options.add_options()
+    ("input,i",
+    po::value<std::string>(&input_filename)->value_name("<string>")->required(),
+    "Input (hyper)graph filename")
+    ("output,o",
+    po::value<std::string>(&output_filename)->value_name("<string>")->required(),
+    "Output filename of the binary (hyper)graph file")
+    ("input-file-format",
+    po::value<std::string>()->value_name("<string>")->notifier([&](const std::string& s) {
+      if (s == "hmetis") {
+        format = FileFormat::hMetis;
+      } else if (s == "metis") {
+        format = FileFormat::Metis;
+      }
+    }),
+    "Input file format: \n"
+    " - hmetis : hMETIS hypergraph file format \n"
+    " - metis : METIS graph file format");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  po::notify(cmd_vm);
+
+  // Graphs are stored as static graph, hypergraphs as static hypergraph.
+  // Single-pin hyperedges are removed before the hypergraph is written to disk.
+  // Incident nets are sorted so that the binary file is independent of scheduling.
+  HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+  if ( format == FileFormat::Metis ) {
+    ds::StaticGraph graph = io::readInputFile<ds::StaticGraph>(input_filename, format, true);
+    io::writeBinaryFile(graph, output_filename);
+    LOG << "Converted graph with" << graph.initialNumNodes() << "nodes and"
+        << graph.initialNumEdges() / 2 << "edges";
+  } else {
+    ds::StaticHypergraph hypergraph = io::readInputFile<ds::StaticHypergraph>(input_filename, format, true);
+    io::writeBinaryFile(hypergraph, output_filename);
+    LOG << "Converted hypergraph with" << hypergraph.initialNumNodes() << "nodes,"
+        << hypergraph.initialNumEdges() << "hyperedges and"
+        << hypergraph.initialNumPins() << "pins";
+  }
+  HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+  LOG << "Conversion time =" << std::chrono::duration<double>(end - start).count() << "s";
+
+  return 0;
+}
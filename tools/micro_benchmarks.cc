@@ -0,0 +1,500 @@
+/*******************************************************************************
+ * MIT License
+ *
+ * This file is part of Mt-KaHyPar.
+ *
+ * Copyright (C) 2023 Tobias Heuer <tobias.heuer@kit.edu>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ ******************************************************************************/
+
+#include <boost/program_options.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/global_control.h>
+#include <tbb/parallel_for.h>
+
+#include "mt-kahypar/macros.h"
+#include "mt-kahypar/definitions.h"
+#include "mt-kahypar/datastructures/pin_count_in_part.h"
+#include "mt-kahypar/io/hypergraph_factory.h"
+#include "mt-kahypar/io/hypergraph_io.h"
+#include "mt-kahypar/partition/context.h"
+#include "mt-kahypar/partition/coarsening/multilevel_vertex_pair_rater.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_acceptance_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_heavy_node_penalty_policy.h"
+#include "mt-kahypar/partition/coarsening/policies/rating_score_policy.h"
+#include "mt-kahypar/partition/refinement/gains/km1/km1_gain_cache.h"
+#include "mt-kahypar/utils/memory_tree.h"
+
+using namespace mt_kahypar;
+namespace po = boost::program_options;
+
+using Hypergraph = ds::StaticHypergraph;
+using HypergraphFactory = typename Hypergraph::Factory;
+using PartitionedHypergraph = typename StaticHypergraphTypeTraits::PartitionedHypergraph;
+using Rater = MultilevelVertexPairRater<HeavyEdgeScore, NoWeightPenalty, BestRatingPreferringUnmatched>;
+
+/*!
+ * Micro-benchmarks for the hot kernels of the partitioner. Each kernel is executed
+ * on each instance with 1, 2, 4, ..., t threads and we report the minimum running
+ * time over all repetitions in ns per operation, the parallel efficiency relative
+ * to the single-threaded run and the effective memory bandwidth. The bandwidth is
+ * based on a simple model of the bytes accessed by each kernel (see BenchmarkResult).
+ */
+struct BenchmarkConfig {
+  std::vector<std::string> instances;
+  HypernodeID generated_nodes = 0;
+  HyperedgeID generated_edges = 0;
+  HypernodeID max_generated_edge_size = 0;
+  PartitionID k = 0;
+  size_t max_threads = 0;
+  size_t repetitions = 0;
+  int seed = 0;
+  std::string filter;
+  std::string tmp_dir;
+  bool csv = false;
+};
+
+struct Instance {
+  std::string name;
+  std::string filename;
+  Hypergraph hypergraph;
+};
+
+struct BenchmarkResult {
+  std::string kernel;
+  std::string instance;
+  size_t num_threads;
+  // ! Number of operations executed by the kernel (e.g., moves or pins)
+  uint64_t num_operations;
+  // ! Estimation of the bytes read and written by the kernel
+  uint64_t num_bytes;
+  double time;
+};
+
+class BenchmarkRunner {
+
+ public:
+  explicit BenchmarkRunner(const BenchmarkConfig& config) :
+    _config(config),
+    _single_threaded_time(0.0),
+    _has_printed_header(false) { }
+
+  // ! Runs setup() before each repetition and measures the running time of kernel()
+  void run(const std::string& kernel,
+           const Instance& instance,
+           const uint64_t num_operations,
+           const uint64_t num_bytes,
+           const std::function<void()>& setup,
+           const std::function<void()>& benchmark) {
+    if ( !_config.filter.empty() && kernel.find(_config.filter) == std::string::npos ) {
+      return;
+    }
+
+    for ( size_t num_threads = 1; ; num_threads = std::min(2 * num_threads, _config.max_threads) ) {
+      tbb::global_control gc(tbb::global_control::max_allowed_parallelism, num_threads);
+      double time = std::numeric_limits<double>::max();
+      for ( size_t i = 0; i < _config.repetitions; ++i ) {
+        setup();
+        HighResClockTimepoint start = std::chrono::high_resolution_clock::now();
+        benchmark();
+        HighResClockTimepoint end = std::chrono::high_resolution_clock::now();
+        time = std::min(time, std::chrono::duration<double>(end - start).count());
+      }
+      print(BenchmarkResult { kernel, instance.name, num_threads, num_operations, num_bytes, time });
+      if ( num_threads == _config.max_threads ) {
+        break;
+      }
+    }
+  }
+
+ private:
+  void print(const BenchmarkResult& result) {
+    if ( result.num_threads == 1 ) {
+      _single_threaded_time = result.time;
+    }
+    const double ns_per_op = result.num_operations > 0 ?
+      1e9 * result.time / result.num_operations : 0.0;
+    const double efficiency = _single_threaded_time / (result.num_threads * result.time);
+    const double bandwidth = result.num_bytes / result.time / 1e9;
+
+    if ( _config.csv ) {
+      if ( !_has_printed_header ) {
+        std::cout << "kernel,instance,threads,operations,bytes,time,ns_per_op,efficiency,bandwidth_gb_s" << std::endl;
+        _has_printed_header = true;
+      }
+      std::cout << result.kernel << "," << result.instance << "," << result.num_threads << ","
+                << result.num_operations << "," << result.num_bytes << "," << result.time << ","
+                << ns_per_op << "," << efficiency << "," << bandwidth << std::endl;
+    } else {
+      if ( !_has_printed_header ) {
+        std::cout << std::left << std::setw(32) << "Kernel" << std::setw(24) << "Instance"
+                  << std::right << std::setw(8) << "Threads" << std::setw(14) << "Time [s]"
+                  << std::setw(12) << "ns/op" << std::setw(12) << "Efficiency"
+                  << std::setw(12) << "GB/s" << std::endl;
+        _has_printed_header = true;
+      }
+      std::cout << std::left << std::setw(32) << result.kernel << std::setw(24) << result.instance
+                << std::right << std::setw(8) << result.num_threads
+                << std::fixed << std::setprecision(6) << std::setw(14) << result.time
+                << std::setprecision(2) << std::setw(12) << ns_per_op
+                << std::setw(12) << efficiency << std::setw(12) << bandwidth << std::endl;
+    }
+  }
+
+  const BenchmarkConfig& _config;
+  double _single_threaded_time;
+  bool _has_printed_header;
+};
+
+Hypergraph generateRandomHypergraph(const BenchmarkConfig& config) {
+  std::mt19937 rng(config.seed);
+  std::uniform_int_distribution<HypernodeID> node_dist(0, config.generated_nodes - 1);
+  std::uniform_int_distribution<HypernodeID> size_dist(2, std::max(2U, config.max_generated_edge_size));
+  vec<vec<HypernodeID>> edges(config.generated_edges);
+  for ( vec<HypernodeID>& edge : edges ) {
+    const HypernodeID edge_size = std::min(size_dist(rng), config.generated_nodes);
+    while ( edge.size() < edge_size ) {
+      const HypernodeID pin = node_dist(rng);
+      if ( std::find(edge.begin(), edge.end(), pin) == edge.end() ) {
+        edge.push_back(pin);
+      }
+    }
+  }
+  return HypergraphFactory::construct(config.generated_nodes, config.generated_edges, edges);
+}
+
+uint64_t fileSize(const std::string& filename) {
+  std::error_code ec;
+  const uintmax_t size = std::filesystem::file_size(filename, ec);
+  return ec ? 0 : size;
+}
+
+void assignRandomPartition(PartitionedHypergraph& phg, const BenchmarkConfig& config) {
+  std::mt19937 rng(config.seed);
+  std::uniform_int_distribution<PartitionID> block_dist(0, config.k - 1);
+  for ( const HypernodeID& hn : phg.nodes() ) {
+    phg.setOnlyNodePart(hn, block_dist(rng));
+  }
+  phg.initializePartition();
+}
+
+void benchmarkInstance(BenchmarkRunner& runner, Instance& instance, const BenchmarkConfig& config) {
+  Hypergraph& hg = instance.hypergraph;
+  const uint64_t num_nodes = hg.initialNumNodes();
+  const uint64_t num_edges = hg.initialNumEdges();
+  const uint64_t num_pins = hg.initialNumPins();
+  uint64_t sum_of_squared_edge_sizes = 0;
+  for ( const HyperedgeID& he : hg.edges() ) {
+    sum_of_squared_edge_sizes += static_cast<uint64_t>(hg.edgeSize(he)) * hg.edgeSize(he);
+  }
+
+  // ####################### IO #######################
+
+  if ( !instance.filename.empty() ) {
+    runner.run("read_hmetis", instance, num_pins, fileSize(instance.filename), [] { }, [&] {
+      Hypergraph tmp = io::readInputFile<Hypergraph>(instance.filename, FileFormat::hMetis, true);
+      unused(tmp);
+    });
+  }
+
+  const std::string binary_file = (std::filesystem::path(config.tmp_dir) /
+    ("mt_kahypar_benchmark_" + instance.name + ".bin")).string();
+  runner.run("write_binary", instance, num_pins, num_pins * sizeof(HypernodeID) * 2, [] { }, [&] {
+    io::writeBinaryFile(hg, binary_file);
+  });
+  io::writeBinaryFile(hg, binary_file);
+  runner.run("read_binary", instance, num_pins, fileSize(binary_file), [] { }, [&] {
+    Hypergraph tmp = io::readInputFile<Hypergraph>(binary_file, FileFormat::Binary, true);
+    unused(tmp);
+  });
+  std::remove(binary_file.c_str());
+
+  // ####################### Coarsening #######################
+
+  {
+    Context context;
+    context.coarsening.vertex_degree_sampling_threshold = 200000;
+    Rater rater(hg.initialNumNodes(), hg.maxEdgeSize(), context);
+    parallel::scalable_vector<HypernodeID> cluster_ids(num_nodes);
+    parallel::scalable_vector<parallel::IntegralAtomicWrapper<HypernodeWeight>> cluster_weight(num_nodes);
+    ds::FixedVertexSupport<Hypergraph> fixed_vertices = hg.copyOfFixedVertexSupport();
+    tbb::enumerable_thread_specific<HypernodeID> num_valid_ratings(0);
+    // Each pin of an incident net of a node is visited once
+    runner.run("rate", instance, num_nodes,
+      sum_of_squared_edge_sizes * sizeof(HypernodeID) + num_pins * sizeof(HyperedgeID), [&] {
+        for ( const HypernodeID& hn : hg.nodes() ) {
+          cluster_ids[hn] = hn;
+          cluster_weight[hn].store(hg.nodeWeight(hn));
+        }
+      }, [&] {
+        tbb::parallel_for(ID(0), hg.initialNumNodes(), [&](const HypernodeID hn) {
+          const auto rating = rater.template rate<false>(hg, hn, cluster_ids,
+            cluster_weight, fixed_vertices, hg.totalWeight());
+          num_valid_ratings.local() += rating.valid;
+        });
+      });
+  }
+
+  {
+    parallel::scalable_vector<HypernodeID> communities;
+    // Contracts pairs of consecutive nodes
+    runner.run("contract", instance, num_pins, 2 * num_pins * sizeof(HypernodeID), [&] {
+        communities.resize(num_nodes);
+        for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+          communities[hn] = hn / 2;
+        }
+      }, [&] {
+        Hypergraph coarse_hg = hg.contract(communities);
+        unused(coarse_hg);
+      });
+  }
+
+  // ####################### Compressed Incidence Arrays #######################
+
+  {
+    // The reported bytes are the memory consumption of the respective hypergraph
+    // representation, which makes the memory and running time trade-off visible
+    auto memory_consumption = [&](const Hypergraph& hypergraph) {
+      utils::MemoryTreeNode root("hypergraph", utils::OutputType::BYTES);
+      hypergraph.memoryConsumption(&root);
+      root.finalize();
+      return static_cast<uint64_t>(root.sizeInBytes());
+    };
+
+    std::vector<Hypergraph*> hypergraphs = { &hg };
+    #ifdef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+    Hypergraph compressed_hg = hg.copy(parallel_tag_t { });
+    runner.run("compress_incidence_arrays", instance, 2 * num_pins,
+      2 * num_pins * (sizeof(HypernodeID) + sizeof(HyperedgeID)), [&] {
+        compressed_hg = hg.copy(parallel_tag_t { });
+      }, [&] {
+        compressed_hg.compress();
+      });
+    if ( compressed_hg.isCompressed() ) {
+      hypergraphs.push_back(&compressed_hg);
+    }
+    #endif
+
+    // Scanning the uncompressed hypergraph measures the overhead of the
+    // compressed representation on the iterators of uncompressed hypergraphs
+    tbb::enumerable_thread_specific<uint64_t> checksum(0);
+    for ( Hypergraph* hypergraph : hypergraphs ) {
+      const std::string suffix = hypergraph->isCompressed() ? "_compressed" : "";
+      const uint64_t num_bytes = memory_consumption(*hypergraph);
+      runner.run("scan_pins" + suffix, instance, num_pins, num_bytes, [] { }, [&] {
+        tbb::parallel_for(ID(0), hypergraph->initialNumEdges(), [&](const HyperedgeID he) {
+          uint64_t& local_sum = checksum.local();
+          for ( const HypernodeID& pin : hypergraph->pins(he) ) {
+            local_sum += pin;
+          }
+        });
+      });
+      runner.run("scan_incident_nets" + suffix, instance, num_pins, num_bytes, [] { }, [&] {
+        tbb::parallel_for(ID(0), hypergraph->initialNumNodes(), [&](const HypernodeID hn) {
+          uint64_t& local_sum = checksum.local();
+          for ( const HyperedgeID& he : hypergraph->incidentEdges(hn) ) {
+            local_sum += he;
+          }
+        });
+      });
+    }
+
+    #ifdef KAHYPAR_ENABLE_COMPRESSED_INCIDENCE_ARRAYS
+    if ( compressed_hg.isCompressed() ) {
+      parallel::scalable_vector<HypernodeID> communities;
+      runner.run("contract_compressed", instance, num_pins, 2 * num_pins * sizeof(HypernodeID), [&] {
+          communities.resize(num_nodes);
+          for ( HypernodeID hn = 0; hn < num_nodes; ++hn ) {
+            communities[hn] = hn / 2;
+          }
+        }, [&] {
+          Hypergraph coarse_hg = compressed_hg.contract(communities);
+          unused(coarse_hg);
+        });
+    }
+    #endif
+  }
+
+  // ####################### Refinement #######################
+
+  PartitionedHypergraph phg(config.k, hg, parallel_tag_t { });
+  assignRandomPartition(phg, config);
+
+  {
+    ds::PinCountInPart pin_counts(num_edges, config.k, hg.maxEdgeSize());
+    runner.run("pin_count_in_part_updates", instance, num_pins,
+      num_pins * sizeof(HypernodeID) + 2 * pin_counts.size_in_bytes(), [&] {
+        pin_counts.reset();
+      }, [&] {
+        tbb::parallel_for(ID(0), hg.initialNumEdges(), [&](const HyperedgeID he) {
+          for ( const HypernodeID& pin : hg.pins(he) ) {
+            pin_counts.incrementPinCountInPart(he, phg.partID(pin));
+          }
+        });
+      });
+  }
+
+  {
+    tbb::enumerable_thread_specific<uint64_t> sum_of_blocks(0);
+    const uint64_t blocks_per_edge = config.k / 64 + (config.k % 64 != 0);
+    runner.run("connectivity_set_iteration", instance, num_edges,
+      num_edges * blocks_per_edge * sizeof(uint64_t), [] { }, [&] {
+        tbb::parallel_for(ID(0), hg.initialNumEdges(), [&](const HyperedgeID he) {
+          uint64_t& local_sum = sum_of_blocks.local();
+          for ( const PartitionID& block : phg.connectivitySet(he) ) {
+            local_sum += block;
+          }
+        });
+      });
+  }
+
+  {
+    std::unique_ptr<Km1GainCache> gain_cache;
+    // Each pin is visited once and k + 1 entries are written for each node
+    runner.run("km1_initialize_gain_cache", instance, num_pins,
+      num_pins * (sizeof(HypernodeID) + sizeof(HyperedgeID)) +
+      num_nodes * (config.k + 1) * sizeof(HyperedgeWeight), [&] {
+        gain_cache = std::make_unique<Km1GainCache>();
+      }, [&] {
+        gain_cache->initializeGainCache(phg);
+      });
+  }
+
+  {
+    // Moves each node at most once to a random block
+    Km1GainCache gain_cache;
+    std::vector<std::pair<HypernodeID, PartitionID>> moves;
+    std::vector<PartitionID> initial_partition(num_nodes);
+    for ( const HypernodeID& hn : hg.nodes() ) {
+      initial_partition[hn] = phg.partID(hn);
+    }
+    std::mt19937 rng(config.seed);
+    std::uniform_int_distribution<PartitionID> block_dist(1, std::max(1, config.k - 1));
+    for ( const HypernodeID& hn : hg.nodes() ) {
+      moves.emplace_back(hn, (initial_partition[hn] + block_dist(rng)) % config.k);
+    }
+    std::shuffle(moves.begin(), moves.end(), rng);
+    uint64_t num_touched_pins = 0;
+    for ( const HypernodeID& hn : hg.nodes() ) {
+      num_touched_pins += hg.nodeDegree(hn);
+    }
+    runner.run("km1_change_node_part", instance, moves.size(),
+      num_touched_pins * (sizeof(HyperedgeID) + sizeof(uint64_t)), [&] {
+        phg.resetPartition();
+        for ( const HypernodeID& hn : hg.nodes() ) {
+          phg.setOnlyNodePart(hn, initial_partition[hn]);
+        }
+        phg.initializePartition();
+        gain_cache.reset();
+        gain_cache.initializeGainCache(phg);
+      }, [&] {
+        tbb::parallel_for(UL(0), moves.size(), [&](const size_t i) {
+          const HypernodeID hn = moves[i].first;
+          phg.changeNodePart(gain_cache, hn, phg.partID(hn), moves[i].second);
+        });
+      });
+  }
+}
+
+int main(int argc, char* argv[]) {
+  BenchmarkConfig config;
+
+  po::options_description options("Options");
+  options.add_options()
+    ("help", "show help message")
+    ("instances,i",
+    po::value<std::vector<std::string>>(&config.instances)->value_name("<string>")->multitoken()->default_value(
+      { "../tests/instances/ibm01.hgr", "../tests/instances/delaunay_n15.graph.hgr" }, "bundled instances"),
+    "Hypergraphs in hMETIS format (paths of the bundled instances are relative to the build directory)")
+    ("generated-nodes",
+    po::value<HypernodeID>(&config.generated_nodes)->value_name("<int>")->default_value(1000000),
+    "Number of nodes of the randomly generated hypergraph (0 = no generated instance)")
+    ("generated-edges",
+    po::value<HyperedgeID>(&config.generated_edges)->value_name("<int>")->default_value(1000000),
+    "Number of hyperedges of the randomly generated hypergraph")
+    ("generated-max-edge-size",
+    po::value<HypernodeID>(&config.max_generated_edge_size)->value_name("<int>")->default_value(10),
+    "Maximum size of a hyperedge of the randomly generated hypergraph")
+    ("blocks,k",
+    po::value<PartitionID>(&config.k)->value_name("<int>")->default_value(8),
+    "Number of blocks of the partition used by the refinement kernels")
+    ("threads,t",
+    po::value<size_t>(&config.max_threads)->value_name("<int>")->default_value(std::thread::hardware_concurrency()),
+    "Maximum number of threads (benchmarks run with 1, 2, 4, ..., t threads)")
+    ("repetitions,r",
+    po::value<size_t>(&config.repetitions)->value_name("<int>")->default_value(3),
+    "Number of repetitions (the minimum running time is reported)")
+    ("seed",
+    po::value<int>(&config.seed)->value_name("<int>")->default_value(0),
+    "Seed for the generated instance and the random partition")
+    ("filter",
+    po::value<std::string>(&config.filter)->value_name("<string>")->default_value(""),
+    "Only runs kernels whose name contains this string")
+    ("tmp-dir",
+    po::value<std::string>(&config.tmp_dir)->value_name("<string>")->default_value(
+      std::filesystem::temp_directory_path().string()),
+    "Directory for temporary binary files")
+    ("csv",
+    po::value<bool>(&config.csv)->value_name("<bool>")->default_value(false),
+    "Print results in CSV format");
+
+  po::variables_map cmd_vm;
+  po::store(po::parse_command_line(argc, argv, options), cmd_vm);
+  if ( cmd_vm.count("help") ) {
+    std::cout << options << std::endl;
+    return 0;
+  }
+  po::notify(cmd_vm);
+  config.max_threads = std::max(config.max_threads, UL(1));
+  config.repetitions = std::max(config.repetitions, UL(1));
+  config.k = std::max(config.k, 2);
+
+  BenchmarkRunner runner(config);
+  if ( config.generated_nodes > 0 && config.generated_edges > 0 ) {
+    Instance instance { "random", "", generateRandomHypergraph(config) };
+    benchmarkInstance(runner, instance, config);
+  }
+
+  for ( const std::string& filename : config.instances ) {
+    if ( !std::filesystem::exists(filename) ) {
+      WARNING("Instance" << filename << "does not exist and is skipped");
+      continue;
+    }
+    Instance instance { std::filesystem::path(filename).filename().string(), filename,
+      io::readInputFile<Hypergraph>(filename, FileFormat::hMetis, true) };
+    benchmarkInstance(runner, instance, config);
+  }
+
+  return 0;
+}